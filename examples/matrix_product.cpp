@@ -0,0 +1,90 @@
+//============================================================================
+//                                  I B E X
+// File        : matrix_product.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+// Last Update : Oct 16, 2026
+//============================================================================
+
+#include "ibex.h"
+#include <time.h>
+#include <stdlib.h>
+
+using namespace std;
+using namespace ibex;
+
+/*
+ * Compare the speed and the tightness of the two algorithms for
+ * the product of interval matrices (IntervalMatrix::INF_SUP and
+ * IntervalMatrix::MID_RAD), on random (n x n) matrices whose entries
+ * have a radius up to r.
+ *
+ * The first product is a preconditioning (real matrix times interval matrix),
+ * the second a product of two interval matrices.
+ */
+
+// random number in [a,b]
+double random_real(double a, double b) {
+	return a+(b-a)*rand()/RAND_MAX;
+}
+
+// sum of the diameters of the entries
+double total_diam(const IntervalMatrix& M) {
+	double d=0;
+	for (int i=0; i<M.nb_rows(); i++)
+		for (int j=0; j<M.nb_cols(); j++)
+			d+=M[i][j].diam();
+	return d;
+}
+
+// average time (in seconds) of "rep" products with a given algorithm
+template<class M1>
+double timing(const M1& A, const IntervalMatrix& B, IntervalMatrix::product_mode mode, int rep, IntervalMatrix& C) {
+	clock_t start=clock();
+	for (int k=0; k<rep; k++)
+		C=mul(A,B,mode);
+	return difftime(clock(),start) / CLOCKS_PER_SEC / rep;
+}
+
+template<class M1>
+void compare(const char* title, const M1& A, const IntervalMatrix& B, int rep) {
+	IntervalMatrix C1(A.nb_rows(),B.nb_cols());
+	IntervalMatrix C2(A.nb_rows(),B.nb_cols());
+
+	double t1=timing(A,B,IntervalMatrix::INF_SUP,rep,C1);
+	double t2=timing(A,B,IntervalMatrix::MID_RAD,rep,C2);
+
+	cout << title << " : INF_SUP=" << t1 << "s  MID_RAD=" << t2 << "s";
+	cout << "  (width ratio=" << total_diam(C2)/total_diam(C1) << ")" << endl;
+}
+
+int main(int argc, char** argv) {
+
+	if (argc<3) {
+		cerr << "usage: matrix_product n r" << endl;
+		exit(1);
+	}
+
+	int n=atoi(argv[1]);
+	double r=atof(argv[2]);
+	int rep=4000000/n/n/n+1;
+
+	srand(1);
+
+	IntervalMatrix A(n,n);
+	Matrix C(n,n);
+	for (int i=0; i<n; i++) {
+		for (int j=0; j<n; j++) {
+			double m=random_real(-0.5,0.5);
+			A[i][j]=Interval(m-random_real(0,r),m+random_real(0,r));
+			C[i][j]=random_real(-0.5,0.5);
+		}
+	}
+
+	compare("Matrix*IntervalMatrix        ",C,A,rep);
+	compare("IntervalMatrix*IntervalMatrix",A,A,rep);
+
+	return 0;
+}
@@ -0,0 +1,75 @@
+#include "ibex.h"
+#include <sstream>
+
+using namespace std;
+using namespace ibex;
+
+double convert(const char* argname, const char* arg) {
+	char* endptr;
+	double val = strtod(arg,&endptr);
+	if (endptr!=arg+strlen(arg)*sizeof(char)) {
+		stringstream s;
+		s << "\"" << argname << "\" must be a real number";
+		ibex_error(s.str().c_str());
+	}
+	return val;
+}
+
+int main(int argc, char** argv) {
+
+	try {
+
+		// check the number of arguments
+		if (argc<5) {
+			ibex_error("usage: paralleloptimizer filename prec goal_prec timelimit [nb_threads]");
+		}
+
+		double prec       = convert("prec",argv[2]);
+		double goal_prec  = convert("goal_prec",argv[3]);  // the required precision for the objective
+		double time_limit = convert("timelimit",argv[4]);
+		int nb_threads    = argc>5 ? (int) convert("nb_threads",argv[5]) : Thread::nb_cores();
+
+		// Each worker needs its own copy of the system
+		// (and its own optimizer)
+		// ------------------------------------------------
+		vector<System*> sys(nb_threads);
+		Array<Optimizer> opt(nb_threads);
+
+		for (int i=0; i<nb_threads; i++) {
+			sys[i] = new System(argv[1]);
+			if (!sys[i]->goal) {
+				ibex_error(" input file has not goal (it is not an optimization problem).");
+			}
+			opt.set_ref(i, *new DefaultOptimizer(*sys[i],prec,goal_prec));
+		}
+
+		cout << "load file " << argv[1] << " (" << nb_threads << " threads)." << endl;
+
+		ParallelOptimizer o(opt);
+
+		// This option limits the search time
+		o.timeout=time_limit;
+
+		// This option prints each better feasible point when it is found
+		o.trace=0;
+
+		// display solutions with up to 12 decimals
+		cout.precision(12);
+
+		// Search for the optimum
+		o.optimize(sys[0]->box);
+
+		// Report some information (computation time, etc.)
+		o.report();
+
+		for (int i=0; i<nb_threads; i++) {
+			delete &opt[i];
+			delete sys[i];
+		}
+		return 0;
+
+	}
+	catch(ibex::SyntaxError& e) {
+		cout << e << endl;
+	}
+}
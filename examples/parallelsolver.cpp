@@ -0,0 +1,68 @@
+#include "ibex.h"
+#include <sstream>
+
+using namespace std;
+using namespace ibex;
+
+
+double convert(const char* argname, const char* arg) {
+	char* endptr;
+	double val = strtod(arg,&endptr);
+	if (endptr!=arg+strlen(arg)*sizeof(char)) {
+		stringstream s;
+		s << "\"" << argname << "\" must be a real number";
+		ibex_error(s.str().c_str());
+	}
+	return val;
+}
+
+int main(int argc, char** argv){
+	try{
+
+		// check the number of arguments
+		if (argc<4) {
+			ibex_error("usage: parallelsolver filename prec timelimit [nb_threads]");
+		}
+
+		double prec       = convert("prec",argv[2]);
+		double time_limit = convert("timelimit",argv[3]);
+		int nb_threads    = argc>4 ? (int) convert("nb_threads",argv[4]) : Thread::nb_cores();
+
+		// Each worker needs its own copy of the system
+		// (and its own contractor/bisector)
+		// ------------------------------------------------
+		vector<System*> sys(nb_threads);
+		vector<DefaultSolver*> s(nb_threads);
+		Array<Ctc> ctc(nb_threads);
+		Array<Bsc> bsc(nb_threads);
+
+		for (int i=0; i<nb_threads; i++) {
+			sys[i] = new System(argv[1]);
+			s[i] = new DefaultSolver(*sys[i],prec);
+			ctc.set_ref(i,s[i]->Solver::ctc);
+			bsc.set_ref(i,s[i]->bsc);
+		}
+		cout << "load file " << argv[1] << " (" << nb_threads << " threads)." << endl;
+
+		ParallelSolver solver(ctc,bsc);
+		solver.time_limit=time_limit;
+		solver.trace=1;  // the solutions are printed when they are found
+		cout.precision(12);
+
+		// Get the solutions
+		vector<IntervalVector> sols=solver.solve(sys[0]->box);
+		cout << "number of solutions=" << sols.size() << endl;
+
+		cout << "real time used=" << solver.time << "s."<< endl;
+		cout << "number of cells=" << solver.nb_cells << endl;
+		cout << "number of steals=" << solver.nb_steals << endl;
+
+		for (int i=0; i<nb_threads; i++) {
+			delete s[i];
+			delete sys[i];
+		}
+	}
+	catch(ibex::SyntaxError& e) {
+		cout << e << endl;
+	}
+}
@@ -21,6 +21,7 @@
 #include "ibex_Affine2_fAF2.h"
 #include "ibex_Affine2_iAF.h"
 #include "ibex_Affine2_fAF2_fma.h"
+#include "ibex_Affine2_fAF2_sparse.h"
 #include "ibex_Affine2_sAF.h"
 #include "ibex_Affine2_No.h"
 
@@ -43,6 +44,7 @@ class Affine2MatrixArray;
 //typedef AF_fAF1  AF_Default;
 typedef AF_fAF2  AF_Default;
 //typedef AF_fAF2_fma  AF_Default;
+//typedef AF_fAF2_sparse  AF_Default;
 //typedef AF_iAF  AF_Default;
 //typedef AF_sAF  AF_Default;
 //typedef AF_No  AF_Default;
@@ -26,7 +26,7 @@ IntervalVector& IntervalVector::operator=(const Affine2Vector& x) {
 }
 
 
-IntervalVector::IntervalVector(const Affine2Vector& x) : n(x.size()), vec(new Interval[x.size()]) {
+IntervalVector::IntervalVector(const Affine2Vector& x) : n(x.size()), vec(alloc(x.size())), borrowed(false) {
 	for (int i=0; i<n; i++) vec[i]=x[i].itv();
 }
 
@@ -75,6 +75,15 @@ Affine2Vector::Affine2Vector(const Affine2Vector& x) :
 
 }
 
+#if __cplusplus >= 201103L
+Affine2Vector::Affine2Vector(Affine2Vector&& x) :
+		_n(x._n),
+		_vec(x._vec) {
+	x._n=0;
+	x._vec=NULL;
+}
+#endif
+
 Affine2Vector::Affine2Vector(int n, double bounds[][2], bool b) :
 		_n(n),
 		_vec(new Affine2[n]) {
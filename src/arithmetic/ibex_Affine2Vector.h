@@ -68,6 +68,15 @@ public:
 	 */
 //	Affine2Vector(const Affine2Vector& x);
 
+#if __cplusplus >= 201103L
+	/**
+	 * \brief Move \a x into *this.
+	 *
+	 * The components of \a x are stolen. \a x must not be used anymore.
+	 */
+	Affine2Vector(Affine2Vector&& x);
+#endif
+
 
 	/**
 	 * \brief Create  a copy of  { \a  x if !(\a b)  else -(\a x) }.
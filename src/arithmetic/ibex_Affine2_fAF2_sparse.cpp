@@ -0,0 +1,739 @@
+/* ============================================================================
+ * I B E X - Implementation of the Affine2Main<AF_fAF2_sparse> class based on fAF version 2
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 16, 2026
+ * ---------------------------------------------------------------------------- */
+#include "ibex_Affine2_fAF2_sparse.h"
+#include "ibex_Affine2.h"
+
+
+namespace ibex {
+
+int AF_fAF2_sparse::align(const AF_fAF2_sparse& x, const AF_fAF2_sparse& y, int* ind, double* xv, double* yv) {
+	int i=0, j=0, k=0;
+	while (i<x._nb || j<y._nb) {
+		if (j==y._nb || (i<x._nb && x._ind[i]<y._ind[j])) {
+			ind[k] = x._ind[i];
+			xv[k]  = x._val[i++];
+			yv[k]  = 0.0;
+		} else if (i==x._nb || y._ind[j]<x._ind[i]) {
+			ind[k] = y._ind[j];
+			xv[k]  = 0.0;
+			yv[k]  = y._val[j++];
+		} else {
+			ind[k] = x._ind[i];
+			xv[k]  = x._val[i++];
+			yv[k]  = y._val[j++];
+		}
+		k++;
+	}
+	return k;
+}
+
+void AF_fAF2_sparse::set(double* val, int* ind, int nb) {
+	clear();
+	_val = val;
+	_ind = ind;
+	_nb  = nb;
+}
+
+
+template<>
+Affine2Main<AF_fAF2_sparse>& Affine2Main<AF_fAF2_sparse>::operator=(const Interval& x) {
+
+	if (x.is_empty()) {
+		_n = -1;
+		_elt._err = 0.0;
+		_elt.clear();
+	} else if (x.ub()>= POS_INFINITY && x.lb()<= NEG_INFINITY ) {
+		_n = -2;
+		_elt._err = 0.0;
+		_elt.clear();
+	} else if (x.ub()>= POS_INFINITY ) {
+		_n = -3;
+		_elt._err = x.lb();
+		_elt.clear();
+	} else if (x.lb()<= NEG_INFINITY ) {
+		_n = -4;
+		_elt._err = x.ub();
+		_elt.clear();
+	} else  {
+		_n = 0;
+		_elt.alloc(1);
+		_elt._ind[0] = 0;
+		_elt._val[0] = x.mid();
+		_elt._err	= x.rad();
+	}
+	return *this;
+}
+
+
+
+template<>
+Affine2Main<AF_fAF2_sparse>::Affine2Main() :
+		 _n		(-2		),
+		 _elt	(POS_INFINITY)	{
+ }
+
+template<>
+Affine2Main<AF_fAF2_sparse>::Affine2Main(int n, int m, const Interval& itv) :
+			_n 		(n),
+			_elt	(0.0)
+{
+	assert((n>=0) && (m>=0) && (m<=n));
+	if (!(itv.is_unbounded()||itv.is_empty())) {
+		// the noise symbol is not stored if the radius is zero
+		_elt.alloc((m==0 || itv.rad()==0)? 1 : 2);
+		_elt._ind[0] = 0;
+		_elt._val[0] = itv.mid();
+
+		if (m == 0) {
+			_elt._err = itv.rad();
+		} else if (_elt._nb==2) {
+			_elt._ind[1] = m;
+			_elt._val[1] = itv.rad();
+		}
+	} else {
+		*this = itv;
+	}
+}
+
+
+template<>
+Affine2Main<AF_fAF2_sparse>::Affine2Main(const double d) :
+			_n 		(0),
+			_elt	(0.0) {
+	if (fabs(d)<POS_INFINITY) {
+		_elt.alloc(1);
+		_elt._err = 0.0;
+		_elt._ind[0] = 0;
+		_elt._val[0] = d;
+	} else {
+		_n=-1;
+		_elt._err = d;
+	}
+}
+
+
+template<>
+Affine2Main<AF_fAF2_sparse>::Affine2Main(const Interval & itv):
+			_n 		(0),
+			_elt	(0.0) {
+	*this = itv;
+}
+
+
+template<>
+Affine2Main<AF_fAF2_sparse>::Affine2Main(const Affine2Main<AF_fAF2_sparse>& x) :
+		_n		(x._n),
+		_elt	(x._elt._err ) {
+	if (is_actif()) {
+		_elt.alloc(x._elt._nb);
+		for (int k = 0; k < x._elt._nb; k++){
+			_elt._ind[k] = x._elt._ind[k];
+			_elt._val[k] = x._elt._val[k];
+		}
+	}
+}
+
+
+
+template<>
+double Affine2Main<AF_fAF2_sparse>::val(int i) const{
+	assert((0<=i) && (i<=_n));
+	// binary search of the noise symbol
+	int lo=0, hi=_elt._nb-1;
+	while (lo<=hi) {
+		int k=(lo+hi)/2;
+		if (_elt._ind[k]==i) return _elt._val[k];
+		else if (_elt._ind[k]<i) lo=k+1;
+		else hi=k-1;
+	}
+	return 0.0;
+}
+
+template<>
+double Affine2Main<AF_fAF2_sparse>::err() const{
+	return _elt._err;
+}
+
+
+
+template<>
+const Interval Affine2Main<AF_fAF2_sparse>::itv() const {
+
+	if (is_actif()) {
+		Interval res(_elt._val[0]);
+		Interval pmOne(-1.0, 1.0);
+		for (int k = 1; k < _elt._nb; k++){
+			res += (_elt._val[k] * pmOne);
+		}
+		res += _elt._err * pmOne;
+		return res;
+	} else if (_n==-1) {
+		return Interval::EMPTY_SET;
+	} else if (_n==-2) {
+		return Interval::ALL_REALS;
+	} else if (_n==-3) {
+		return Interval(_elt._err,POS_INFINITY);
+	} else  {  //if (_n==-4)
+		return Interval(NEG_INFINITY,_elt._err);
+	}
+
+}
+
+
+template<>
+double Affine2Main<AF_fAF2_sparse>::mid() const{
+	return (is_actif())? _elt._val[0] : itv().mid();
+}
+
+
+
+template<>
+Affine2Main<AF_fAF2_sparse>& Affine2Main<AF_fAF2_sparse>::operator=(const Affine2Main<AF_fAF2_sparse>& x) {
+	if (this != &x) {
+		_n = x._n;
+		_elt._err = x._elt._err;
+		if (x.is_actif()) {
+			if (_elt._nb!=x._elt._nb) _elt.alloc(x._elt._nb);
+
+			for (int k = 0; k < x._elt._nb; k++) {
+				_elt._ind[k] = x._elt._ind[k];
+				_elt._val[k] = x._elt._val[k];
+			}
+		} else {
+			_elt.clear();
+		}
+	}
+	return *this;
+
+}
+
+template<>
+Affine2Main<AF_fAF2_sparse>& Affine2Main<AF_fAF2_sparse>::operator=(double d) {
+
+	if (fabs(d)<POS_INFINITY) {
+		_n = 0;
+		_elt.alloc(1);
+		_elt._err = 0.0;
+		_elt._ind[0] = 0;
+		_elt._val[0] = d;
+	} else {
+		if (d>0) {
+			_n = -3;
+		} else {
+			_n = -4;
+		}
+		_elt._err = d;
+		_elt.clear();
+	}
+	return *this;
+}
+
+
+
+/** \brief Return (-x) */
+template<>
+Affine2Main<AF_fAF2_sparse> Affine2Main<AF_fAF2_sparse>::operator-() const {
+	Affine2Main<AF_fAF2_sparse> res;
+	res._n = _n;
+	res._elt._err = _elt._err;
+	if (is_actif()) {
+		res._elt.alloc(_elt._nb);
+		for (int k = 0; k < _elt._nb; k++) {
+			res._elt._ind[k] = _elt._ind[k];
+			res._elt._val[k] = (-_elt._val[k]);
+		}
+	}
+	return res;
+}
+
+
+
+template<>
+Affine2Main<AF_fAF2_sparse>& Affine2Main<AF_fAF2_sparse>::saxpy(double alpha, const Affine2Main<AF_fAF2_sparse>& y, double beta, double ddelta, bool B1, bool B2, bool B3, bool B4) {
+	double temp, ttt, sss, eee;
+	int k;
+
+	if (is_actif()) {
+		if (B1) {  // multiply by a scalar alpha
+			if (alpha==0.0) {
+				_elt._nb = 1;
+				_elt._val[0] = 0;
+				_elt._err = 0;
+			}
+			else if ((fabs(alpha)) < POS_INFINITY) {
+				ttt= 0.0;
+				sss= 0.0;
+				for (k=0; k<_elt._nb; k++) {
+					eee = _elt.twoProd(_elt._val[k], alpha, &temp);
+					_elt._val[k] = temp;
+					ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+					if (fabs(_elt._val[k])<AF_EC()) {
+						sss = (1+2*AF_EM())*(sss+ fabs(_elt._val[k]));
+						_elt._val[k] = 0.0;
+					}
+				}
+				_elt.compact();
+
+				_elt._err = (1+2*AF_EM())*(
+						((1+2*AF_EM())*fabs(alpha)*_elt._err) +
+						((AF_EE()*ttt) +
+						(AF_EE()*sss))
+						);
+
+			}
+			else {
+				*this = itv()*alpha;
+			}
+		}
+
+		if (B2) {  // add a affine2 form y
+
+			if (y.is_actif()) {
+				if (_n==y.size()) {
+					// the noise symbols of the result are those of *this and y
+					int nb = _elt._nb + y._elt._nb - 1;
+					int* ind = new int[nb];
+					double* xv = new double[nb];
+					double* yv = new double[nb];
+					nb = AF_fAF2_sparse::align(_elt, y._elt, ind, xv, yv);
+
+					ttt=0.0;
+					sss=0.0;
+					for(k=0; k<nb; k++) {
+						eee = _elt.twoSum(xv[k], yv[k], &temp);
+						ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+						if (fabs(temp)<AF_EC()) {
+							sss = (1+2*AF_EM())*(sss+ fabs(temp));
+							xv[k] = 0.0;
+						}
+						else {
+							xv[k]=temp;
+						}
+					}
+					_elt._err = (1+2*AF_EM())*(
+							(_elt._err+y._elt._err) +
+							((AF_EE()*(ttt)) +
+							(AF_EE()*sss))
+							);
+
+					delete[] yv;
+					_elt.set(xv, ind, nb);
+					_elt.compact();
+
+				} else  {
+					if (_n>y.size()) {
+						*this += y.itv();
+					} else {
+						Interval tmp1 = itv();
+						*this = y;
+						*this += tmp1;
+					}
+				}
+			}
+			else { // y is not a valid affine2 form. So we add y.itv() such as an interval
+				*this = itv()+y.itv();
+			}
+		}
+		if (B3) {  //add a constant beta
+			if ((fabs(beta))<POS_INFINITY) {
+				ttt=0.0;
+				sss=0.0;
+				eee = _elt.twoSum(_elt._val[0],beta,&temp);
+				ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+				if (fabs(temp)<AF_EC()) {
+					sss = (1+2*AF_EM())*(sss+fabs(temp));
+					_elt._val[0] = 0.0;
+				}
+				else {
+					_elt._val[0]=temp;
+				}
+				_elt._err = (1+2*AF_EM())*(
+						_elt._err +
+						(AF_EE()*(ttt)+
+						AF_EE()*sss)
+						);
+
+			}
+			else {
+				*this = itv()+beta;
+			}
+		}
+
+		if (B4) {  // add an error  ddelta
+
+			if ((fabs(ddelta))<POS_INFINITY) {
+				ttt=0.0;
+				sss=0.0;
+				eee = _elt.twoSum(_elt._err,fabs(ddelta), &temp);
+				ttt = (1+2*AF_EM())*(fabs(eee));
+				if (fabs(temp)<AF_EC()) {
+					sss = (1+2*AF_EM())*(fabs(temp));
+					temp =0;
+				}
+				_elt._err = (1+2*AF_EM())*(
+						temp +
+						(AF_EE()*(ttt) +
+						AF_EE()*sss)
+						);
+
+			}
+			else {
+				*this = itv()+Interval(-1,1)*ddelta;
+			}
+		}
+
+		if (_elt._val != NULL) {
+			bool b = (_elt._err<POS_INFINITY);
+			for (k=0; k<_elt._nb; k++) {
+				b &= (fabs(_elt._val[k])<POS_INFINITY);
+			}
+			if (!b) {
+				*this = Interval::ALL_REALS;
+			}
+		}
+
+	} else {
+		if (B1) {  //scalar alpha
+			*this = itv()* alpha;
+		}
+		if (B2) {  // add y
+			*this = itv()+ y.itv();
+		}
+		if (B3) {  //constant beta
+			*this = itv()+ beta;
+		}
+		if (B4) {  // error  delta
+			*this = itv()+Interval(-1,1)*ddelta;
+		}
+	}
+	return *this;
+
+}
+
+
+template<>
+Affine2Main<AF_fAF2_sparse>& Affine2Main<AF_fAF2_sparse>::operator*=(const Interval& y) {
+	if (	(!is_actif())||
+			y.is_empty()||
+			y.is_unbounded() ) {
+		*this = itv()*y;
+
+	} else {
+		double  ttt, sss,  yVal0, eee, temp;
+		int k;
+
+		ttt=0.0; sss=0.0;  yVal0=0.0; eee=0.0;
+		yVal0 = y.mid();
+		// RES = X%(0) * res
+		for (k=0; k<_elt._nb; k++) {
+			eee = _elt.twoProd(_elt._val[k], yVal0, &temp);
+			_elt._val[k] = temp;
+			ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+			if (fabs(_elt._val[k])<AF_EC()) {
+				sss = (1+2*AF_EM())*(sss+ fabs(_elt._val[k]));
+				_elt._val[k] = 0.0;
+			}
+		}
+		_elt.compact();
+
+		_elt._err = (1+2*AF_EM())*(
+				(1+2*AF_EM())*(abs(y).ub())*_elt._err +
+				((AF_EE()*ttt) +
+				(AF_EE()*sss))
+				);
+
+		{
+			bool b = (_elt._err<POS_INFINITY);
+			for (k=0; k<_elt._nb; k++) {
+				b &= (fabs(_elt._val[k])<POS_INFINITY);
+			}
+			if (!b) {
+				*this = Interval::ALL_REALS;
+			}
+		}
+
+	}
+	return *this;
+}
+
+
+
+template<>
+Affine2Main<AF_fAF2_sparse>& Affine2Main<AF_fAF2_sparse>::operator*=(const Affine2Main<AF_fAF2_sparse>& y) {
+
+	if (is_actif() && (y.is_actif())) {
+
+		if (_n==y.size()) {
+			double Sx, Sy, Sxy, Sz, ttt, sss, ppp, tmp, xVal0, eee;
+			int k;
+
+			// the noise symbols of the result are those of *this and y
+			int nb = _elt._nb + y._elt._nb - 1;
+			int* ind = new int[nb];
+			double* xv = new double[nb];
+			double* yv = new double[nb];
+			nb = AF_fAF2_sparse::align(_elt, y._elt, ind, xv, yv);
+			double* xTmp = new double[nb];
+
+			Sx=0.0; Sy=0.0; Sxy=0.0; Sz=0.0; ttt=0.0; sss=0.0; ppp=0.0; tmp=0.0; xVal0=0.0; eee=0.0;
+
+			for (k = 1; k < nb; k++) {
+				eee = _elt.twoProd(xv[k],yv[k], &ppp);
+				ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+
+				eee = _elt.twoSum(Sz,ppp, &tmp);
+				ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+				Sz = tmp;
+
+				if (fabs(Sz) < AF_EC()) {
+					sss = (1+2*AF_EM())*(sss+ fabs(Sz));
+					Sz = 0.0;
+				}
+
+				eee = _elt.twoSum(Sxy,fabs(ppp), &tmp);
+				ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+				Sxy = tmp;
+
+				if (fabs(Sxy) < AF_EC()) {
+					sss = (1+2*AF_EM())*(sss+ fabs(Sxy));
+					Sxy = 0.0;
+				}
+
+				eee = _elt.twoSum(Sx,fabs(xv[k]), &tmp);
+				ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+				Sx = tmp;
+
+				if (fabs(Sx) < AF_EC()) {
+					sss = (1+2*AF_EM())*(sss+ fabs(Sx));
+					Sx = 0.0;
+				}
+				eee = _elt.twoSum(Sy,fabs(yv[k]), &tmp);
+				ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+				Sy = tmp;
+
+				if (fabs(Sy) < AF_EC()) {
+					sss = (1+2*AF_EM())*(sss+ fabs(Sy));
+					Sy = 0.0;
+				}
+
+			}
+
+			xVal0 = xv[0];
+			// RES = X%T(0) * res
+			for (k = 0; k < nb; k++) {
+				eee = _elt.twoProd(xv[k],yv[0], &ppp);
+				ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+				xv[k] = ppp;
+
+				if (fabs(xv[k]) < AF_EC()) {
+					sss = (1+2*AF_EM())*(sss+ fabs(xv[k]));
+					xv[k] = 0.0;
+				}
+			}
+
+			// Xtmp = X%T(0) * Y
+			xTmp[0] = 0.0;
+			for (k = 1; k < nb; k++) {
+				eee = _elt.twoProd(xVal0,yv[k], &ppp);
+				ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+				xTmp[k] = ppp;
+
+				if (fabs(xTmp[k]) < AF_EC()) {
+					sss = (1+2*AF_EM())*(sss+ fabs(xTmp[k]));
+					xTmp[k] = 0.0;
+				}
+
+			}
+
+			//RES =  RES + Xtmp = ( Y%(0) * X ) + ( X%T(0) * Y - X%T(0)*Y%(0) )
+			for (k = 0; k < nb; k++) {
+
+				eee = _elt.twoSum(xv[k],xTmp[k], &tmp);
+				ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+				xv[k] = tmp;
+
+				if (fabs(xv[k]) < AF_EC()) {
+					sss = (1+2*AF_EM())*(sss+ fabs(xv[k]));
+					xv[k] = 0.0;
+				}
+
+			}
+
+			eee = _elt.twoProd(0.5,Sz, &ppp);
+			ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+
+			eee = _elt.twoSum(xv[0],ppp, &tmp);
+			ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+			xv[0] = tmp;
+
+			if (fabs(xv[0]) < AF_EC()) {
+				sss = (1+2*AF_EM())*(sss+ fabs(xv[0]));
+				xv[0] = 0.0;
+			}
+
+			eee = _elt.twoSum(_elt._err,Sx, &tmp);
+			ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+
+			eee = _elt.twoSum(y._elt._err,Sy, &ppp);
+			ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+
+
+			_elt._err = (1+ 2*AF_EM()) * (
+					((1+ 2*AF_EM()) *fabs(yv[0]) * _elt._err)  +
+					((1+ 2*AF_EM()) *fabs(xVal0) * y._elt._err)  +
+					((1+ 2*AF_EM()) *(tmp * ppp)) +
+					((1- 2*AF_EM()) *(-0.5) *  Sxy)  +
+					(AF_EE() * (ttt))  +
+					(AF_EE() * sss)
+					);
+
+			delete[] yv;
+			delete[] xTmp;
+			_elt.set(xv, ind, nb);
+			_elt.compact();
+
+			{
+				bool b = (_elt._err<POS_INFINITY);
+				for (k=0; k<_elt._nb; k++) {
+					b &= (fabs(_elt._val[k])<POS_INFINITY);
+				}
+				if (!b) {
+					*this = Interval::ALL_REALS;
+				}
+			}
+
+		} else {
+			if (_n>y.size()) {
+				*this *= y.itv();
+			} else {
+				Interval tmp1 = this->itv();
+				*this = y;
+				*this *= tmp1;
+			}
+		}
+
+
+	} else {
+		*this = itv()*y.itv();
+	}
+
+	return *this;
+}
+
+
+template<>
+Affine2Main<AF_fAF2_sparse>& Affine2Main<AF_fAF2_sparse>::sqr(const Interval itv) {
+
+	if (	(!is_actif())||
+			itv.is_empty()||
+			itv.is_unbounded()||
+			(itv.diam() < AF_EC())  ) {
+		*this = pow(itv,2);
+
+	} else  {
+
+		double Sx, Sx2, ttt, sss, ppp, x0, eee,tmp;
+		Sx = 0; Sx2 = 0; ttt = 0; sss = 0; ppp = 0; x0 = 0; eee =0.0; tmp =0.0;
+
+		// compute the error
+		for (int k = 1; k < _elt._nb; k++) {
+
+			eee = _elt.twoProd(_elt._val[k],_elt._val[k], &ppp);
+			ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+
+			eee = _elt.twoSum(Sx2,ppp, &tmp);
+			ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+			Sx2 = tmp;
+
+			if (fabs(Sx2) < AF_EC()) {
+				sss = (1+2*AF_EM())*(sss+ fabs(Sx2));
+				Sx2 = 0.0;
+			}
+
+			eee = _elt.twoSum(Sx,fabs(_elt._val[k]), &tmp);
+			ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+			Sx = tmp;
+
+			if (fabs(Sx) < AF_EC()) {
+				sss = (1+2*AF_EM())*(sss+ fabs(Sx));
+				Sx = 0.0;
+			}
+
+		}
+		// compute 2*_elt._val[0]*(*this)
+		x0 = _elt._val[0];
+
+		eee = _elt.twoProd(x0,x0, &ppp);
+		ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+		_elt._val[0] = ppp;
+
+		if (fabs(_elt._val[0]) < AF_EC()) {
+			sss = (1+2*AF_EM())*(sss+ fabs(_elt._val[0]));
+			_elt._val[0] = 0.0;
+		}
+
+		// compute 2*_elt._val[0]*(*this)
+		for (int k = 1; k < _elt._nb; k++) {
+
+			eee = _elt.twoProd((2*x0),_elt._val[k], &ppp);
+			ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+			_elt._val[k] = ppp;
+
+			if (fabs(_elt._val[k]) < AF_EC()) {
+				sss = (1+2*AF_EM())*(sss+ fabs(_elt._val[k]));
+				_elt._val[k] = 0.0;
+			}
+
+		}
+		_elt.compact();
+
+		eee = _elt.twoProd(0.5,Sx2, &ppp);
+		ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+
+		eee = _elt.twoSum(_elt._val[0],ppp, &tmp);
+		ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+		_elt._val[0] = tmp;
+
+		if (fabs(_elt._val[0]) < AF_EC()) {
+			sss = (1+2*AF_EM())*(sss+ fabs(_elt._val[0]));
+			_elt._val[0] = 0.0;
+		}
+
+		eee = _elt.twoSum(_elt._err,Sx, &tmp);
+		ttt = (1+2*AF_EM())*(ttt+fabs(eee));
+
+		_elt._err = (1+ 2*AF_EM()) * (
+				((1+ 2*AF_EM()) *2*fabs(x0) * _elt._err)  +
+				((1+ 2*AF_EM()) *(tmp * tmp)) +
+				((1- 2*AF_EM()) *(-0.5) *  Sx2)  +
+				(AF_EE() * (ttt))  +
+				(AF_EE() * sss)
+				);
+
+		{
+			bool b = (_elt._err<POS_INFINITY);
+			for (int k=0; k<_elt._nb; k++) {
+				b &= (fabs(_elt._val[k])<POS_INFINITY);
+			}
+			if (!b) {
+				*this = Interval::ALL_REALS;
+			}
+		}
+
+	}
+
+	return *this;
+}
+
+
+
+
+}// end namespace ibex
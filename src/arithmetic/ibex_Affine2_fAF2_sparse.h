@@ -0,0 +1,184 @@
+/* ============================================================================
+ * I B E X - Definition of the Affine2 class based on fAF version 2 (sparse)
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 16, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef IBEX_AFFINE2_FAF2_SPARSE_H_
+#define IBEX_AFFINE2_FAF2_SPARSE_H_
+
+#include "ibex_Interval.h"
+
+
+namespace ibex {
+
+/**
+ * \brief fAF version 2 with a sparse representation of the affine form.
+ *
+ * Same arithmetic as #AF_fAF2 but only the non-zero coefficients are stored,
+ * as (index, coefficient) pairs sorted by increasing index. The cost of an
+ * operation is proportional to the number of noise symbols that actually
+ * appear in the operands, not to the total number of variables.
+ */
+class AF_fAF2_sparse {
+
+	friend class Affine2Main<AF_fAF2_sparse>;
+
+private:
+	/**
+	 * Code for the particular case:
+	 * if the affine form is actif, _n>1  and _n is the size of the affine form
+	 * if the set is degenerate, _n = 0 or itv().diam()< AF_EC()
+	 * if the set is empty, _n = -1
+	 * if the set is ]-oo,+oo[, _n = -2
+	 * if the set is [a, +oo[ , _n = -3 and _err= a
+	 * if the set is ]-oo, a] , _n = -4 and _err= a
+	 *
+	 */
+
+	double * _val; 		// non-zero coefficients; _val[0] is the center (possibly 0)
+	int * _ind;			// noise symbols of the coefficients: _ind[0]=0 < _ind[1] < ... < _ind[_nb-1]
+	int _nb;			// number of coefficients stored (0 if the form is not actif)
+	double _err; 		// error of the affine form, corresponded to the last term
+
+	/**
+	 * \brief Allocate nb coefficients (the previous ones are lost)
+	 */
+	void alloc(int nb);
+
+	/**
+	 * \brief Delete the coefficients
+	 */
+	void clear();
+
+	/**
+	 * \brief Replace the coefficients by the arrays val and ind (not copied)
+	 */
+	void set(double* val, int* ind, int nb);
+
+	/**
+	 * \brief Remove the zero coefficients (except the center)
+	 */
+	void compact();
+
+	/**
+	 * \brief Align the coefficients of x and y on the union of their noise symbols
+	 *
+	 * The arrays must be of size x._nb+y._nb-1 (at least). Return the size of the union.
+	 */
+	static int align(const AF_fAF2_sparse& x, const AF_fAF2_sparse& y, int* ind, double* xv, double* yv);
+
+	/**
+	 * \brief return the exact rounding error of the addition of 2 floating-point numbers
+	 */
+	double twoSum(double a, double b, double *res);
+
+	/**
+	 * \brief return the exact rounding error of the multiplication of 2 floating-point numbers
+	 */
+	double twoProd(double a, double b, double *res);
+	void Split(double x, int sp, double *x_high, double *x_low);
+
+public:
+	/** \brief Create an empty affine form. */
+	AF_fAF2_sparse(double err);
+
+	/** \brief  Delete the affine form */
+	virtual ~AF_fAF2_sparse();
+
+};
+
+
+inline AF_fAF2_sparse::AF_fAF2_sparse(double err) :
+	_val	(NULL),
+	_ind	(NULL),
+	_nb		(0),
+	_err	(err) {
+
+}
+
+inline AF_fAF2_sparse::~AF_fAF2_sparse() {
+	clear();
+}
+
+inline void AF_fAF2_sparse::alloc(int nb) {
+	clear();
+	_val = new double[nb];
+	_ind = new int[nb];
+	_nb  = nb;
+}
+
+inline void AF_fAF2_sparse::clear() {
+	if (_val!=NULL) {
+		delete[] _val;
+		delete[] _ind;
+		_val = NULL;
+		_ind = NULL;
+	}
+	_nb = 0;
+}
+
+inline void AF_fAF2_sparse::compact() {
+	if (_nb==0) return;
+	int j=1;
+	for (int k=1; k<_nb; k++) {
+		if (_val[k]!=0.0) {
+			_val[j]=_val[k];
+			_ind[j]=_ind[k];
+			j++;
+		}
+	}
+	_nb = j;
+}
+
+
+/////////////////////
+// CODE extract from "Handbook of Floating-Point Arithmetic" p.132-139
+inline void AF_fAF2_sparse::Split(double x, int sp, double *x_high, double *x_low)
+{
+	unsigned long C = (1UL << sp) + 1;
+	double gamma = (C * x);
+	double delta = (x - gamma);
+	*x_high= (gamma + delta);
+	*x_low= (x - *x_high);
+}
+
+inline double AF_fAF2_sparse::twoProd(double x, double y, double *r_1)
+{
+	int SHIFT_POW = 27; //  53 / 2 for double precision.
+	double x_high, x_low;
+	double y_high, y_low;
+	double t_1;
+	double t_2;
+	double t_3;
+	Split(x, SHIFT_POW, &x_high, &x_low);
+	Split(y, SHIFT_POW, &y_high, &y_low);
+	*r_1 = (x * y);
+	t_1 = (-*r_1 + x_high * y_high);
+	t_2 =   (t_1 + x_high * y_low );
+	t_3 =	(t_2 + x_low  * y_high);
+	return  (t_3 + x_low  * y_low );
+}
+
+
+
+// CODE extract from "Handbook of Floating-Point Arithmetic" p.130
+inline double AF_fAF2_sparse::twoSum(double a, double b, double *res) {
+	*res = (a+b);
+	double a2 = (*res - b);
+	double b2 = (*res - a2);
+	double delta_a = (a - a2);
+	double delta_b = (b - b2);
+	return (delta_a + delta_b);
+}
+
+//////////////////////
+
+}
+
+#endif /* IBEX_AFFINE2_FAF2_SPARSE_H_ */
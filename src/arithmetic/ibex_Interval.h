@@ -18,7 +18,7 @@
 /* ========================================================*/
 /* The following header file is automatically generated by
  * the compilation. It only contains the definition of
- * _IBEX_WITH_GAOL_ or _IBEX_WITH_BIAS_ */
+ * _IBEX_WITH_GAOL_, _IBEX_WITH_BIAS_, _IBEX_WITH_FILIB_ or _IBEX_WITH_NATIVE_ */
 #include "ibex_Setting.h"
 /* ======================================================= */
 
@@ -62,6 +62,35 @@
 //	#define POS_INFINITY filib::primitive::compose(0,0x7FE,(1 << 21)-1,0xffffffff)
 	/** \brief IBEX_NAN: <double> representation of NaN */
 	#define IBEX_NAN filib::primitive::compose(0,0x7FF,1 << 19,0)
+#else
+#ifdef _IBEX_WITH_NATIVE_
+	#include <cmath>
+	/** \brief NEG_INFINITY: double representation of -oo */
+	#define NEG_INFINITY (-HUGE_VAL)
+	/** \brief POS_INFINITY: double representation of +oo */
+	#define POS_INFINITY HUGE_VAL
+
+namespace ibex {
+
+/**
+ * \brief Interval of the native implementation.
+ *
+ * The interval [a,b] is stored as the pair (-a,b) so that both
+ * bounds are computed in the upward rounding mode (see ibex_native_Interval.h_).
+ * The empty set is (NaN,NaN).
+ */
+struct NATIVE_INTERVAL {
+	NATIVE_INTERVAL() { }
+	NATIVE_INTERVAL(double a, double b) : nlb(-a), ub(b) { }
+	NATIVE_INTERVAL& operator=(double x) { nlb=-x; ub=x; return *this; }
+	/** \brief Opposite of the lower bound. */
+	double nlb;
+	/** \brief Upper bound. */
+	double ub;
+};
+
+} // end namespace ibex
+#endif
 #endif
 #endif
 #endif
@@ -126,7 +155,7 @@ double next_float(double x);
  * \brief Interval
  *
  * This class defines the interval interface of IBEX and encapsulates an interval "itv" whose
- * type depends on the chosen implementation (currently: Gaol, Bias of filib).
+ * type depends on the chosen implementation (currently: Gaol, Bias, filib or native).
  *
  * Note that some functions of the Gaol interval interface do not appear here (like "possibly relations")
  * because there are not used by ibex; while other have been introduced (like "ratio_delta"). Some
@@ -528,6 +557,15 @@ class Interval {
 
     FI_INTERVAL itv;
 
+#else
+#ifdef _IBEX_WITH_NATIVE_
+	/* \brief Wrap the native interval [x]. */
+    Interval(const NATIVE_INTERVAL& x);
+    /* \brief Assign this to the native interval [x]. */
+    Interval& operator=(const NATIVE_INTERVAL& x);
+
+    NATIVE_INTERVAL itv;
+#endif
 #endif
 #endif
 #endif
@@ -847,6 +885,10 @@ bool bwd_integer(Interval& x);
 #else
 #ifdef _IBEX_WITH_FILIB_
 #include "ibex_filib_Interval.h_"
+#else
+#ifdef _IBEX_WITH_NATIVE_
+#include "ibex_native_Interval.h_"
+#endif
 #endif
 #endif
 #endif
@@ -955,6 +997,10 @@ inline double distance(const Interval &x1, const Interval &x2) {
 #else
 #ifdef _IBEX_WITH_FILIB_
     	return x1.itv.dist(x2.itv);
+#else
+#ifdef _IBEX_WITH_NATIVE_
+    	return hausdorff(x1,x2);
+#endif
 #endif
 #endif
 #endif
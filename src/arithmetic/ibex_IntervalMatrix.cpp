@@ -15,6 +15,8 @@
 
 namespace ibex {
 
+IntervalMatrix::product_mode IntervalMatrix::default_product_mode=IntervalMatrix::INF_SUP;
+
 IntervalMatrix::IntervalMatrix() : _nb_rows(0), _nb_cols(0), M(NULL) {
 
 }
@@ -63,6 +65,14 @@ IntervalMatrix::IntervalMatrix(const IntervalMatrix& m) : _nb_rows(m.nb_rows()),
 	}
 }
 
+#if __cplusplus >= 201103L
+IntervalMatrix::IntervalMatrix(IntervalMatrix&& m) : _nb_rows(m._nb_rows), _nb_cols(m._nb_cols), M(m.M) {
+	m.M=NULL;
+	m._nb_rows=0;
+	m._nb_cols=0;
+}
+#endif
+
 
 IntervalMatrix::IntervalMatrix(const Matrix& m) : _nb_rows(m.nb_rows()), _nb_cols(m.nb_cols()){
 	M = new IntervalVector[_nb_rows];
@@ -82,6 +92,18 @@ IntervalMatrix& IntervalMatrix::operator=(const IntervalMatrix& x) {
 	return _assign(*this,x);
 }
 
+#if __cplusplus >= 201103L
+IntervalMatrix& IntervalMatrix::operator=(IntervalMatrix&& x) {
+	// like operator=(const IntervalMatrix&), the dimension can change
+	IntervalVector* tmp=M;
+	M=x.M;
+	x.M=tmp;
+	int r=_nb_rows; _nb_rows=x._nb_rows; x._nb_rows=r;
+	int c=_nb_cols; _nb_cols=x._nb_cols; x._nb_cols=c;
+	return *this;
+}
+#endif
+
 IntervalMatrix& IntervalMatrix::operator&=(const IntervalMatrix& m) {
 	assert(nb_rows()==m.nb_rows());
 	assert(nb_cols()==m.nb_cols());
@@ -30,6 +30,20 @@ class Affine2Matrix;
 class IntervalMatrix {
 
 public:
+	/**
+	 * \brief Algorithms for the product of two interval matrices.
+	 *
+	 * INF_SUP: each entry is a sum of interval products (the tightest
+	 * enclosure, up to the rounding of the sums).
+	 *
+	 * MID_RAD: the matrices are put in midpoint-radius form and the product
+	 * is enclosed with four products of real matrices, computed with upward
+	 * rounding (Rump's algorithm). This is much faster on large matrices but
+	 * the radius of the result can be overestimated, by a factor 1.5 at most.
+	 * Matrices with infinite bounds are multiplied with INF_SUP.
+	 */
+	typedef enum { INF_SUP, MID_RAD } product_mode;
+
 	/**
 	 * \brief Create a (nb_rows x nb_cols) matrix.
 	 */
@@ -46,6 +60,15 @@ public:
 	 */
 	IntervalMatrix(const IntervalMatrix& m);
 
+#if __cplusplus >= 201103L
+	/**
+	 * \brief Move \a m into *this.
+	 *
+	 * The rows of \a m are stolen. \a m must not be used anymore.
+	 */
+	IntervalMatrix(IntervalMatrix&& m);
+#endif
+
 	/**
 	 * \brief Create a degenerated interval matrix.
 	 */
@@ -85,6 +108,13 @@ public:
 	 */
 	IntervalMatrix& operator=(const IntervalMatrix& x);
 
+#if __cplusplus >= 201103L
+	/**
+	 * \brief Set *this to m, by exchanging their rows.
+	 */
+	IntervalMatrix& operator=(IntervalMatrix&& x);
+#endif
+
 	/**
 	 * \brief Set *this to m.
 	 */
@@ -450,6 +480,13 @@ public:
      */
     operator const ExprConstant&() const;
 
+    /**
+     * \brief The algorithm used by the operators "*" and "*=" between matrices.
+     *
+     * INF_SUP by default.
+     */
+    static product_mode default_product_mode;
+
 private:
 	friend class IntervalMatrixArray;
 
@@ -558,6 +595,21 @@ IntervalMatrix operator*(const Matrix& m1, const IntervalMatrix& m2);
  */
 IntervalMatrix operator*(const IntervalMatrix& m1, const IntervalMatrix& m2);
 
+/**
+ * \brief $[m]_1*[m]_2$ with a given algorithm.
+ */
+IntervalMatrix mul(const IntervalMatrix& m1, const Matrix& m2, IntervalMatrix::product_mode mode);
+
+/**
+ * \brief $[m]_1*[m]_2$ with a given algorithm.
+ */
+IntervalMatrix mul(const Matrix& m1, const IntervalMatrix& m2, IntervalMatrix::product_mode mode);
+
+/**
+ * \brief $[m]_1*[m]_2$ with a given algorithm.
+ */
+IntervalMatrix mul(const IntervalMatrix& m1, const IntervalMatrix& m2, IntervalMatrix::product_mode mode);
+
 /**
  * \brief Outer product (multiplication of a column vector by a row vector).
  */
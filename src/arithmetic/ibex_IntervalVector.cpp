@@ -16,28 +16,43 @@
 #include <math.h>
 #include <float.h>
 #include <algorithm>
+#include <new>
 
 
 #include "ibex_TemplateVector.cpp_"
 
 namespace ibex {
 
-IntervalVector::IntervalVector(int nn) : n(nn), vec(new Interval[nn]) {
+IntervalVector::IntervalVector(int nn) : n(nn), vec(alloc(nn)), borrowed(false) {
 	assert(nn>=1);
 	for (int i=0; i<nn; i++) vec[i]=Interval::ALL_REALS;
 }
 
-IntervalVector::IntervalVector(int n1, const Interval& x) : n(n1), vec(new Interval[n1]) {
+IntervalVector::IntervalVector(int n1, const Interval& x) : n(n1), vec(alloc(n1)), borrowed(false) {
 	assert(n1>=1);
 	for (int i=0; i<n1; i++) vec[i]=x;
 }
 
-IntervalVector::IntervalVector(const IntervalVector& x) : n(x.n), vec(new Interval[x.n]) {
+IntervalVector::IntervalVector(const IntervalVector& x) : n(x.n), vec(alloc(x.n)), borrowed(false) {
 	assert(x.vec!=NULL); // forbidden to copy uninitialized boxes
 	for (int i=0; i<n; i++) vec[i]=x[i];
 }
 
-IntervalVector::IntervalVector(int n1, double bounds[][2]) : n(n1), vec(new Interval[n1]) {
+#if __cplusplus >= 201103L
+IntervalVector::IntervalVector(IntervalVector&& x) : n(x.n), vec(NULL), borrowed(false) {
+	assert(x.vec!=NULL); // forbidden to move uninitialized boxes
+	if (x.is_inline() || x.borrowed) { // the components of x cannot be taken
+		vec=alloc(n);
+		for (int i=0; i<n; i++) vec[i]=x[i];
+	} else {
+		vec=x.vec;
+		x.vec=NULL;
+		x.n=0;
+	}
+}
+#endif
+
+IntervalVector::IntervalVector(int n1, double bounds[][2]) : n(n1), vec(alloc(n1)), borrowed(false) {
 	if (bounds==0) // probably, the user called IntervalVector(n,0) and 0 is interpreted as NULL!
 		for (int i=0; i<n1; i++)
 			vec[i]=Interval::ZERO;
@@ -46,7 +61,7 @@ IntervalVector::IntervalVector(int n1, double bounds[][2]) : n(n1), vec(new Inte
 			vec[i]=Interval(bounds[i][0],bounds[i][1]);
 }
 
-IntervalVector::IntervalVector(const Vector& x) : n(x.size()), vec(new Interval[n]) {
+IntervalVector::IntervalVector(const Vector& x) : n(x.size()), vec(alloc(n)), borrowed(false) {
 	for (int i=0; i<n; i++) vec[i]=x[i];
 }
 
@@ -56,20 +71,37 @@ void IntervalVector::init(const Interval& x) {
 }
 
 
+Interval* IntervalVector::alloc(int n) {
+	if (n<=INLINE_SIZE) {
+		Interval* v=(Interval*) buf.bytes;
+		for (int i=0; i<n; i++) new (&v[i]) Interval();
+		return v;
+	} else
+		return new Interval[n];
+}
+
 void IntervalVector::resize(int n2) {
 	assert(n2>=1);
 	assert((vec==NULL && n==0) || (n!=0 && vec!=NULL));
 
 	if (n2==size()) return;
 
-	Interval* newVec=new Interval[n2];
-	int i=0;
-	for (; i<size() && i<n2; i++)
+	if (borrowed)
+		throw InvalidIntervalVectorOp("Cannot resize a vector whose components are not owned (e.g., the box of a cell)");
+
+	if (is_inline() && n2<=INLINE_SIZE) {
+		// the components remain in place
+		for (int i=n; i<n2; i++) new (&vec[i]) Interval();
+		for (int i=n2; i<n; i++) vec[i].~Interval();
+		n = n2;
+		return;
+	}
+
+	// note: if the new vector is inline, the old one is not.
+	Interval* newVec=alloc(n2); // (-oo,+oo) by default
+	for (int i=0; i<size() && i<n2; i++)
 		newVec[i]=vec[i];
-	for (; i<n2; i++)
-		newVec[i]=Interval::ALL_REALS;
-	if (vec!=NULL) // vec==NULL happens when default constructor is used (n==0)
-		delete[] vec;
+	release(); // vec==NULL happens when default constructor is used (n==0)
 
 	n   = n2;
 	vec = newVec;
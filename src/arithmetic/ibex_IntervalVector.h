@@ -33,6 +33,9 @@ class Affine2Vector;
  * By convention an empty vector has a dimension. A vector becomes empty
  * when one of its component becomes empty and all the components
  * are set to the empty Interval.
+ *
+ * The components of a vector of size at most #INLINE_SIZE are stored inside
+ * the object itself (no dynamic allocation).
  */
 class IntervalVector {
 
@@ -58,6 +61,17 @@ public:
 	 * \brief Create a copy of \a x.
 	 */
 	IntervalVector(const IntervalVector& x);
+
+#if __cplusplus >= 201103L
+	/**
+	 * \brief Move \a x into *this.
+	 *
+	 * The components of \a x are stolen (if they are not stored inline, see
+	 * #INLINE_SIZE). \a x is left with no component and must not be used anymore.
+	 */
+	IntervalVector(IntervalVector&& x);
+#endif
+
 	explicit IntervalVector(const Affine2Vector& x);
 
 	/**
@@ -84,6 +98,11 @@ public:
 	 */
 	static IntervalVector empty(int n);
 
+	/**
+	 * \brief Maximal size of a vector whose components are stored inline.
+	 */
+	static const int INLINE_SIZE=16;
+
 	/**
 	 * \brief Delete this vector
 	 */
@@ -140,6 +159,9 @@ public:
 	 * modified and the new ones are set to (-inf,+inf), even if
 	 * (*this) is the empty Interval (however, in this case, the status of
 	 * (*this) remains "empty").
+	 *
+	 * \throw InvalidIntervalVectorOp - if the components are not owned
+	 *        by *this (the box of a #ibex::Cell stored in an arena).
 	 */
 	void resize(int n2);
 
@@ -542,12 +564,46 @@ public:
 private:
 	friend class IntervalMatrix;
 	friend class Affine2Vector;
+	friend class Cell;
+
+	IntervalVector() : n(0), vec(NULL), borrowed(false) { } // for IntervalMatrix, complementary() & Cell
 
-	IntervalVector() : n(0), vec(NULL) { } // for IntervalMatrix & complementary()
+	// Allocate n components set to (-oo,+oo), inline if n<=INLINE_SIZE.
+	// Does not modify *this.
+	Interval* alloc(int n);
 
+	// Destroy the components (does not modify n and vec)
+	void release();
+
+	// true if the components are stored inline
+	bool is_inline() const;
 
 	int n;             // dimension (size of vec)
 	Interval *vec;	   // vector of elements
+
+	// true if vec is owned by another object (e.g., the box of a cell
+	// stored in an arena, see Cell). Such a vector cannot be resized
+	// and its components are neither freed nor taken by a move.
+	bool borrowed;
+
+	// storage of the components for n<=INLINE_SIZE,
+	// aligned as an Interval (which may require more than a double, e.g.,
+	// with an SSE-based interval type).
+#if __cplusplus >= 201103L
+	struct {
+		alignas(Interval) char bytes[INLINE_SIZE*sizeof(Interval)];
+	} buf;
+#elif defined(__GNUC__)
+	struct {
+		char bytes[INLINE_SIZE*sizeof(Interval)] __attribute__((aligned(__alignof__(Interval))));
+	} buf;
+#else
+	union {
+		long double align;
+		double* align_ptr;
+		char bytes[INLINE_SIZE*sizeof(Interval)];
+	} buf;
+#endif
 };
 
 /** \ingroup arithmetic */
@@ -707,7 +763,18 @@ inline IntervalVector IntervalVector::empty(int n) {
 }
 
 inline IntervalVector::~IntervalVector() {
-	delete[] vec;
+	release();
+}
+
+inline bool IntervalVector::is_inline() const {
+	return vec==(const Interval*) buf.bytes;
+}
+
+inline void IntervalVector::release() {
+	if (is_inline())
+		for (int i=0; i<n; i++) vec[i].~Interval();
+	else if (!borrowed)
+		delete[] vec;
 }
 
 inline void IntervalVector::set_empty() {
@@ -11,6 +11,7 @@
 
 #include "ibex_Affine2Matrix.h"
 #include "ibex_IntervalMatrix.h"
+#include "ibex_LinearKernel.h"
 
 namespace ibex {
 
@@ -42,6 +43,12 @@ inline void set_empty(Affine2Matrix& m) { m.set_empty(); }
 
 inline double abs(const double& x) { return fabs(x); }
 
+// true if the kernels (see ibex_LinearKernel.h) can be called
+template<class X, class Y>
+inline bool use_kernel(int n, const X& x, const Y& y) {
+	return n>=LinearKernel::MIN_SIZE && !is_empty(x) && !is_empty(y);
+}
+
 template<typename V>
 inline V minusV(const V& v) {
 	const int n=v.size();
@@ -249,6 +256,17 @@ inline Mout mulMM(const Min1& m1, const Min2& m2) {
 	return m3;
 }
 
+// product of interval matrices with the kernels, if possible
+template<class M1, class M2>
+inline IntervalMatrix mulMM_kernel(const M1& m1, const M2& m2, IntervalMatrix::product_mode mode) {
+	if (!is_empty(m1) && !is_empty(m2)) {
+		IntervalMatrix m3(m1.nb_rows(),m2.nb_cols());
+		if (mode==IntervalMatrix::MID_RAD && LinearKernel::gemm_midrad(m1,m2,m3)) return m3;
+		if (m1.nb_cols()>=LinearKernel::MIN_SIZE && LinearKernel::gemm(m1,m2,m3)) return m3;
+	}
+	return mulMM<M1,M2,IntervalMatrix>(m1,m2);
+}
+
 template<typename V>
 inline V absV(const V& v) {
 	V res(v.size());
@@ -472,14 +490,21 @@ double operator*(const Vector& v1, const Vector& v2) {
 }
 
 Interval operator*(const Vector& v1, const IntervalVector& v2) {
+	Interval y;
+	if (use_kernel(v1.size(),v1,v2) && LinearKernel::dot(v1,v2,y)) return y;
 	return mulVV<Vector,IntervalVector,Interval>(v1,v2);
 }
 
 Interval operator*(const IntervalVector& v1, const Vector& v2) {
+	Interval y;
+	// note: the product is commutative
+	if (use_kernel(v1.size(),v1,v2) && LinearKernel::dot(v2,v1,y)) return y;
 	return mulVV<IntervalVector,Vector,Interval>(v1,v2);
 }
 
 Interval operator*(const IntervalVector& v1, const IntervalVector& v2) {
+	Interval y;
+	if (use_kernel(v1.size(),v1,v2) && LinearKernel::dot(v1,v2,y)) return y;
 	return mulVV<IntervalVector,IntervalVector,Interval>(v1,v2);
 }
 
@@ -520,14 +545,20 @@ Vector operator*(const Matrix& m, const Vector& v) {
 }
 
 IntervalVector operator*(const Matrix& m, const IntervalVector& v) {
+	IntervalVector y(m.nb_rows());
+	if (use_kernel(v.size(),m,v) && LinearKernel::gemv(m,v,y)) return y;
 	return mulMV<Matrix,IntervalVector,IntervalVector>(m,v);
 }
 
 IntervalVector operator*(const IntervalMatrix& m, const Vector& v) {
+	IntervalVector y(m.nb_rows());
+	if (use_kernel(v.size(),m,v) && LinearKernel::gemv(m,v,y)) return y;
 	return mulMV<IntervalMatrix,Vector,IntervalVector>(m,v);
 }
 
 IntervalVector operator*(const IntervalMatrix& m, const IntervalVector& v) {
+	IntervalVector y(m.nb_rows());
+	if (use_kernel(v.size(),m,v) && LinearKernel::gemv(m,v,y)) return y;
 	return mulMV<IntervalMatrix,IntervalVector,IntervalVector>(m,v);
 }
 
@@ -552,15 +583,27 @@ Matrix operator*(const Matrix& m1, const Matrix& m2) {
 }
 
 IntervalMatrix operator*(const Matrix& m1, const IntervalMatrix& m2) {
-	return mulMM<Matrix,IntervalMatrix,IntervalMatrix>(m1,m2);
+	return mul(m1,m2,IntervalMatrix::default_product_mode);
+}
+
+IntervalMatrix mul(const Matrix& m1, const IntervalMatrix& m2, IntervalMatrix::product_mode mode) {
+	return mulMM_kernel(m1,m2,mode);
 }
 
 IntervalMatrix operator*(const IntervalMatrix& m1, const Matrix& m2) {
-	return mulMM<IntervalMatrix,Matrix,IntervalMatrix>(m1,m2);
+	return mul(m1,m2,IntervalMatrix::default_product_mode);
+}
+
+IntervalMatrix mul(const IntervalMatrix& m1, const Matrix& m2, IntervalMatrix::product_mode mode) {
+	return mulMM_kernel(m1,m2,mode);
 }
 
 IntervalMatrix operator*(const IntervalMatrix& m1, const IntervalMatrix& m2) {
-	return mulMM<IntervalMatrix,IntervalMatrix,IntervalMatrix>(m1,m2);
+	return mul(m1,m2,IntervalMatrix::default_product_mode);
+}
+
+IntervalMatrix mul(const IntervalMatrix& m1, const IntervalMatrix& m2, IntervalMatrix::product_mode mode) {
+	return mulMM_kernel(m1,m2,mode);
 }
 
 Vector abs(const Vector& v) {
@@ -0,0 +1,427 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_LinearKernel.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+// Last Update : Oct 16, 2026
+//============================================================================
+
+#include "ibex_LinearKernel.h"
+
+#include <cassert>
+#include <cfloat>
+#include <cmath>
+#include <fenv.h>
+
+#if defined(__SSE2__) && !defined(_IBEX_DISABLE_SSE2_)
+#include <emmintrin.h>
+#define _IBEX_KERNEL_SSE2_
+#endif
+
+namespace ibex {
+
+int LinearKernel::MIN_SIZE=3;
+
+int LinearKernel::BLOCK_SIZE=128;
+
+namespace {
+
+// An interval [a,b] is represented by the pair (-a,b).
+// All the operations below must be performed in round-up mode.
+
+#ifdef _IBEX_KERNEL_SSE2_
+
+typedef __m128d pair;
+
+inline pair load(const double* p)     { return _mm_loadu_pd(p); }
+
+inline void store(double* p, pair x)  { _mm_storeu_pd(p,x); }
+
+inline pair zero()                    { return _mm_setzero_pd(); }
+
+inline pair add(pair x, pair y)       { return _mm_add_pd(x,y); }
+
+// exchange the two bounds
+inline pair swap(pair x)              { return _mm_shuffle_pd(x,x,1); }
+
+inline pair neg(pair x)               { return _mm_xor_pd(x,_mm_set1_pd(-0.0)); }
+
+// the upper bound of x*y is the max of the four products of the bounds rounded upward,
+// and the opposite of the lower bound, the max of their four opposites rounded upward.
+inline pair mul(pair x, pair y) {
+	pair sy=swap(y);
+	pair nx=neg(x);
+	pair u=_mm_max_pd(_mm_mul_pd(x,y),_mm_mul_pd(nx,sy));  // products for the upper bound
+	pair l=_mm_max_pd(_mm_mul_pd(nx,y),_mm_mul_pd(x,sy));  // (opposite) products for the lower bound
+	return _mm_max_pd(_mm_unpacklo_pd(l,u),_mm_unpackhi_pd(l,u));
+}
+
+#else
+
+struct pair { double l, u; };  // l is the opposite of the lower bound
+
+inline pair make(double l, double u)  { pair x; x.l=l; x.u=u; return x; }
+
+inline pair load(const double* p)     { return make(p[0],p[1]); }
+
+inline void store(double* p, pair x)  { p[0]=x.l; p[1]=x.u; }
+
+inline pair zero()                    { return make(0,0); }
+
+inline pair add(pair x, pair y)       { return make(x.l+y.l,x.u+y.u); }
+
+inline double max(double a, double b) { return a>b? a : b; }
+
+inline pair mul(pair x, pair y) {
+	// x=[-x.l,x.u], y=[-y.l,y.u]
+	double u=max(max(x.l*y.l,x.u*y.u),max((-x.l)*y.u,(-x.u)*y.l));
+	double l=max(max((-x.l)*y.l,(-x.u)*y.u),max(x.l*y.u,x.u*y.l));
+	return make(l,u);
+}
+
+#endif
+
+// Forbid the compiler to move the memory accesses to the
+// arrays (and then the operations) across a change of the
+// rounding mode.
+inline void barrier(const double* x) {
+	__asm__ __volatile__("" : : "r"(x) : "memory");
+}
+
+// Change the rounding mode (upward) on construction,
+// restore it on destruction
+class RoundUp {
+public:
+	RoundUp(const double* x, const double* y, const double* z) : x(x), y(y), z(z), mode(fegetround()) {
+		barrier(x); barrier(y); barrier(z);
+		fesetround(FE_UPWARD);
+		barrier(x); barrier(y); barrier(z);
+	}
+
+	~RoundUp() {
+		barrier(x); barrier(y); barrier(z);
+		fesetround(mode);
+		barrier(x); barrier(y); barrier(z);
+	}
+
+	const double *x, *y, *z;
+	const int mode;
+};
+
+inline bool is_finite(double x) {
+	return fabs(x)<=DBL_MAX;
+}
+
+inline bool is_real(const Matrix&)         { return true; }
+inline bool is_real(const IntervalMatrix&) { return false; }
+
+// Copy of the bounds of a vector or a matrix
+class Packed {
+public:
+	Packed(int n) : x(new double[2*n]), finite(true) { }
+
+	Packed(const IntervalVector& v) : x(new double[2*v.size()]), finite(true) {
+		set(v,0);
+	}
+
+	Packed(const Vector& v) : x(new double[2*v.size()]), finite(true) {
+		set(v,0);
+	}
+
+	Packed(const IntervalMatrix& m) : x(new double[2*m.nb_rows()*m.nb_cols()]), finite(true) {
+		for (int i=0; i<m.nb_rows(); i++) set(m[i],i*m.nb_cols());
+	}
+
+	Packed(const Matrix& m) : x(new double[2*m.nb_rows()*m.nb_cols()]), finite(true) {
+		for (int i=0; i<m.nb_rows(); i++) set(m[i],i*m.nb_cols());
+	}
+
+	~Packed() {
+		delete[] x;
+	}
+
+	void set(const IntervalVector& v, int start) {
+		double* p=x+2*start;
+		for (int i=0; i<v.size(); i++) {
+			*(p++)=-v[i].lb();
+			*(p++)=v[i].ub();
+			finite &= is_finite(v[i].lb()) && is_finite(v[i].ub());
+		}
+	}
+
+	void set(const Vector& v, int start) {
+		double* p=x+2*start;
+		for (int i=0; i<v.size(); i++) {
+			*(p++)=-v[i];
+			*(p++)=v[i];
+			finite &= is_finite(v[i]);
+		}
+	}
+
+	void get(IntervalVector& v, int start) const {
+		const double* p=x+2*start;
+		for (int i=0; i<v.size(); i++, p+=2)
+			v[i]=Interval(-p[0],p[1]);
+	}
+
+	double* x;
+
+	bool finite;
+
+private:
+	Packed(const Packed&); // forbidden
+};
+
+// z=x*y
+void dot(int n, const double* x, const double* y, double* z) {
+	pair s=zero();
+	for (int i=0; i<2*n; i+=2)
+		s=add(s,mul(load(x+i),load(y+i)));
+	store(z,s);
+}
+
+// C=A*B where A is (m x p) and B is (p x n), row by row
+void gemm(int m, int p, int n, const double* A, const double* B, double* C) {
+	for (int i=0; i<m; i++) {
+		double* c=C+2*i*n;
+		for (int j=0; j<2*n; j+=2) store(c+j,zero());
+
+		for (int k=0; k<p; k++) {
+			pair a=load(A+2*(i*p+k));
+			const double* b=B+2*k*n;
+			for (int j=0; j<2*n; j+=2)
+				store(c+j,add(load(c+j),mul(a,load(b+j))));
+		}
+	}
+}
+
+// Array of n doubles initialized to 0
+class Buffer {
+public:
+	Buffer(int n) : x(new double[n]()) { }
+
+	~Buffer() {
+		delete[] x;
+	}
+
+	double* x;
+
+private:
+	Buffer(const Buffer&); // forbidden
+};
+
+// C+=A*B where A is (m x p) and B is (p x n) are real matrices.
+// The loops on k and j are split by blocks so that a block of B
+// stays in the cache while all the rows of A are visited.
+void gemm_real(int m, int p, int n, const double* A, const double* B, double* C) {
+	const int bs=LinearKernel::BLOCK_SIZE;
+
+	for (int k0=0; k0<p; k0+=bs) {
+		const int k1=k0+bs<p? k0+bs : p;
+		for (int j0=0; j0<n; j0+=bs) {
+			const int j1=j0+bs<n? j0+bs : n;
+			for (int i=0; i<m; i++) {
+				const double* a=A+i*p;
+				double* c=C+i*n;
+				for (int k=k0; k<k1; k++) {
+					const double aik=a[k];
+					const double* b=B+k*n;
+					for (int j=j0; j<j1; j++)
+						c[j]+=aik*b[j];
+				}
+			}
+		}
+	}
+}
+
+// Midpoint and radius of the n intervals stored as pairs in x.
+// If rad is NULL, the intervals are degenerated.
+// Return false if a midpoint or a radius is not finite.
+bool midrad(int n, const double* x, double* mid, double* rad) {
+	for (int i=0; i<n; i++) {
+		const double l=x[2*i]; // opposite of the lower bound
+		const double u=x[2*i+1];
+		if (rad) {
+			mid[i]=(-l)+0.5*(u+l);  // lb+(ub-lb)/2 rounded upward
+			rad[i]=mid[i]+l;        // mid-lb rounded upward
+			if (!is_finite(mid[i]) || !is_finite(rad[i])) return false;
+		} else
+			mid[i]=u;
+	}
+	return true;
+}
+
+// C=A*B in midpoint-radius arithmetic.
+// If A (resp. B) is real, its radius is not taken into account.
+//
+// The exact product mA*mB is enclosed by [C1,C2] with C2=mA*mB
+// and C1=-((-mA)*mB), both calculated with upward rounding.
+// Then A*B is enclosed by [C1-T,C2+T] with T=|mA|*rB+rA*(|mB|+rB).
+//
+// Must be called in round-up mode.
+bool gemm_midrad(int m, int p, int n, const double* A, bool realA, const double* B, bool realB, double* C) {
+	Buffer mA(m*p), rA(realA? 0 : m*p);
+	Buffer mB(p*n), rB(realB? 0 : p*n);
+
+	if (!midrad(m*p,A,mA.x,realA? NULL : rA.x)) return false;
+	if (!midrad(p*n,B,mB.x,realB? NULL : rB.x)) return false;
+
+	Buffer C2(m*n), C1(m*n), T(m*n);
+
+	gemm_real(m,p,n,mA.x,mB.x,C2.x);
+
+	for (int i=0; i<m*p; i++) mA.x[i]=-mA.x[i];
+	gemm_real(m,p,n,mA.x,mB.x,C1.x);      // C1 contains -C1
+
+	if (!realB) {
+		for (int i=0; i<m*p; i++) mA.x[i]=fabs(mA.x[i]);
+		gemm_real(m,p,n,mA.x,rB.x,T.x);
+	}
+
+	if (!realA) {
+		for (int i=0; i<p*n; i++) mB.x[i]=fabs(mB.x[i]) + (realB? 0 : rB.x[i]);
+		gemm_real(m,p,n,rA.x,mB.x,T.x);
+	}
+
+	for (int i=0; i<m*n; i++) {
+		C[2*i]=C1.x[i]+T.x[i];
+		C[2*i+1]=C2.x[i]+T.x[i];
+	}
+	return true;
+}
+
+template<class V>
+inline bool dotV(const V& x, const IntervalVector& y, Interval& z) {
+	assert(x.size()==y.size());
+
+	const int n=x.size();
+	Packed px(x);
+	Packed py(y);
+	if (!px.finite || !py.finite) return false;
+
+	double res[2];
+	{
+		RoundUp r(px.x,py.x,res);
+		dot(n,px.x,py.x,res);
+	}
+	z=Interval(-res[0],res[1]);
+	return true;
+}
+
+template<class M, class V>
+inline bool gemvMV(const M& A, const V& x, IntervalVector& y) {
+	assert(A.nb_cols()==x.size());
+	assert(A.nb_rows()==y.size());
+
+	const int m=A.nb_rows();
+	const int n=A.nb_cols();
+	Packed pA(A);
+	Packed px(x);
+	if (!pA.finite || !px.finite) return false;
+
+	Packed py(m);
+	{
+		RoundUp r(pA.x,px.x,py.x);
+		for (int i=0; i<m; i++)
+			dot(n,pA.x+2*i*n,px.x,py.x+2*i);
+	}
+	py.get(y,0);
+	return true;
+}
+
+template<class M1, class M2>
+inline bool gemmMM(const M1& A, const M2& B, IntervalMatrix& C) {
+	assert(A.nb_cols()==B.nb_rows());
+	assert(C.nb_rows()==A.nb_rows() && C.nb_cols()==B.nb_cols());
+
+	const int m=A.nb_rows();
+	const int p=A.nb_cols();
+	const int n=B.nb_cols();
+	Packed pA(A);
+	Packed pB(B);
+	if (!pA.finite || !pB.finite) return false;
+
+	Packed pC(m*n);
+	{
+		RoundUp r(pA.x,pB.x,pC.x);
+		gemm(m,p,n,pA.x,pB.x,pC.x);
+	}
+	for (int i=0; i<m; i++)
+		pC.get(C[i],i*n);
+	return true;
+}
+
+template<class M1, class M2>
+inline bool gemmMidRad(const M1& A, const M2& B, IntervalMatrix& C) {
+	assert(A.nb_cols()==B.nb_rows());
+	assert(C.nb_rows()==A.nb_rows() && C.nb_cols()==B.nb_cols());
+
+	const int m=A.nb_rows();
+	const int p=A.nb_cols();
+	const int n=B.nb_cols();
+	Packed pA(A);
+	Packed pB(B);
+	if (!pA.finite || !pB.finite) return false;
+
+	Packed pC(m*n);
+	bool ok;
+	{
+		RoundUp r(pA.x,pB.x,pC.x);
+		ok=gemm_midrad(m,p,n,pA.x,is_real(A),pB.x,is_real(B),pC.x);
+	}
+	if (!ok) return false;
+
+	for (int i=0; i<m; i++)
+		pC.get(C[i],i*n);
+	return true;
+}
+
+} // end anonymous namespace
+
+bool LinearKernel::dot(const IntervalVector& x, const IntervalVector& y, Interval& z) {
+	return dotV(x,y,z);
+}
+
+bool LinearKernel::dot(const Vector& x, const IntervalVector& y, Interval& z) {
+	return dotV(x,y,z);
+}
+
+bool LinearKernel::gemv(const IntervalMatrix& A, const IntervalVector& x, IntervalVector& y) {
+	return gemvMV(A,x,y);
+}
+
+bool LinearKernel::gemv(const Matrix& A, const IntervalVector& x, IntervalVector& y) {
+	return gemvMV(A,x,y);
+}
+
+bool LinearKernel::gemv(const IntervalMatrix& A, const Vector& x, IntervalVector& y) {
+	return gemvMV(A,x,y);
+}
+
+bool LinearKernel::gemm(const IntervalMatrix& A, const IntervalMatrix& B, IntervalMatrix& C) {
+	return gemmMM(A,B,C);
+}
+
+bool LinearKernel::gemm(const Matrix& A, const IntervalMatrix& B, IntervalMatrix& C) {
+	return gemmMM(A,B,C);
+}
+
+bool LinearKernel::gemm(const IntervalMatrix& A, const Matrix& B, IntervalMatrix& C) {
+	return gemmMM(A,B,C);
+}
+
+bool LinearKernel::gemm_midrad(const IntervalMatrix& A, const IntervalMatrix& B, IntervalMatrix& C) {
+	return gemmMidRad(A,B,C);
+}
+
+bool LinearKernel::gemm_midrad(const Matrix& A, const IntervalMatrix& B, IntervalMatrix& C) {
+	return gemmMidRad(A,B,C);
+}
+
+bool LinearKernel::gemm_midrad(const IntervalMatrix& A, const Matrix& B, IntervalMatrix& C) {
+	return gemmMidRad(A,B,C);
+}
+
+} // end namespace ibex
@@ -0,0 +1,121 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_LinearKernel.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+// Last Update : Oct 16, 2026
+//============================================================================
+
+#ifndef __IBEX_LINEAR_KERNEL_H__
+#define __IBEX_LINEAR_KERNEL_H__
+
+#include "ibex_IntervalMatrix.h"
+
+namespace ibex {
+
+/**
+ * \ingroup arithmetic
+ *
+ * \brief Kernels of the interval linear algebra (products).
+ *
+ * The bounds of the operands are copied in contiguous arrays where each interval [a,b]
+ * is stored as the pair (-a,b). A lower bound rounded downward is then the opposite of
+ * a number rounded upward: a whole kernel is run in the upward rounding mode, without
+ * switching the rounding mode at each operation. The pairs are processed with SSE2
+ * instructions (two bounds at once) unless ibex is configured with --disable-sse2,
+ * in which case a scalar version of the same algorithm is used.
+ *
+ * The result is the same as with the operators of #ibex::Interval (each bound
+ * is correctly rounded and the sums are performed in the same order).
+ *
+ * These functions are called by the operators of #ibex::IntervalVector and
+ * #ibex::IntervalMatrix when the operands are large enough (see #LinearKernel::MIN_SIZE).
+ * They return false (and do nothing) if they cannot be applied, i.e., if a product
+ * involves an infinite bound (0*oo must give 0). The operands must not be empty.
+ *
+ * Note: there is no kernel for the sum of two vectors. The copy of the bounds costs
+ * more than the operation itself.
+ */
+class LinearKernel {
+public:
+	/**
+	 * \brief z=x*y (dot product).
+	 */
+	static bool dot(const IntervalVector& x, const IntervalVector& y, Interval& z);
+
+	/**
+	 * \brief z=x*y (dot product).
+	 */
+	static bool dot(const Vector& x, const IntervalVector& y, Interval& z);
+
+	/**
+	 * \brief y=A*x.
+	 */
+	static bool gemv(const IntervalMatrix& A, const IntervalVector& x, IntervalVector& y);
+
+	/**
+	 * \brief y=A*x.
+	 */
+	static bool gemv(const Matrix& A, const IntervalVector& x, IntervalVector& y);
+
+	/**
+	 * \brief y=A*x.
+	 */
+	static bool gemv(const IntervalMatrix& A, const Vector& x, IntervalVector& y);
+
+	/**
+	 * \brief C=A*B.
+	 */
+	static bool gemm(const IntervalMatrix& A, const IntervalMatrix& B, IntervalMatrix& C);
+
+	/**
+	 * \brief C=A*B.
+	 */
+	static bool gemm(const Matrix& A, const IntervalMatrix& B, IntervalMatrix& C);
+
+	/**
+	 * \brief C=A*B.
+	 */
+	static bool gemm(const IntervalMatrix& A, const Matrix& B, IntervalMatrix& C);
+
+	/**
+	 * \brief C=A*B in midpoint-radius arithmetic.
+	 *
+	 * See #ibex::IntervalMatrix::MID_RAD. The products of the real matrices
+	 * are computed by blocks of #BLOCK_SIZE x #BLOCK_SIZE entries.
+	 */
+	static bool gemm_midrad(const IntervalMatrix& A, const IntervalMatrix& B, IntervalMatrix& C);
+
+	/**
+	 * \brief C=A*B in midpoint-radius arithmetic.
+	 */
+	static bool gemm_midrad(const Matrix& A, const IntervalMatrix& B, IntervalMatrix& C);
+
+	/**
+	 * \brief C=A*B in midpoint-radius arithmetic.
+	 */
+	static bool gemm_midrad(const IntervalMatrix& A, const Matrix& B, IntervalMatrix& C);
+
+	/**
+	 * \brief Minimal size of the vectors (number of components) for
+	 * which the operators call the kernels.
+	 *
+	 * Below this size, the cost of copying the bounds is not amortized.
+	 * The product of two matrices is faster from n=3.
+	 */
+	static int MIN_SIZE;
+
+	/**
+	 * \brief Size of the blocks in the products of real matrices.
+	 *
+	 * A block of the right operand (BLOCK_SIZE^2 doubles) should fit
+	 * in the L2 cache. Default value is 128.
+	 */
+	static int BLOCK_SIZE;
+};
+
+} // end namespace ibex
+
+#endif // __IBEX_LINEAR_KERNEL_H__
@@ -64,6 +64,14 @@ Matrix::Matrix(const Matrix& m) : _nb_rows(m.nb_rows()), _nb_cols(m.nb_cols()){
 	}
 }
 
+#if __cplusplus >= 201103L
+Matrix::Matrix(Matrix&& m) : _nb_rows(m._nb_rows), _nb_cols(m._nb_cols), M(m.M) {
+	m.M=NULL;
+	m._nb_rows=0;
+	m._nb_cols=0;
+}
+#endif
+
 Matrix::~Matrix() {
 	delete[] M;
 }
@@ -72,6 +80,16 @@ Matrix& Matrix::operator=(const Matrix& x) {
 	return _assign(*this,x);
 }
 
+#if __cplusplus >= 201103L
+Matrix& Matrix::operator=(Matrix&& x) {
+	assert(_nb_rows==x._nb_rows && _nb_cols==x._nb_cols);
+	Vector* tmp=M;
+	M=x.M;
+	x.M=tmp;
+	return *this;
+}
+#endif
+
 bool Matrix::operator==(const Matrix& m) const {
 	return _equals(*this,m);
 }
@@ -43,6 +43,15 @@ public:
 	 */
 	Matrix(const Matrix& m);
 
+#if __cplusplus >= 201103L
+	/**
+	 * \brief Move \a m into *this.
+	 *
+	 * The rows of \a m are stolen. \a m must not be used anymore.
+	 */
+	Matrix(Matrix&& m);
+#endif
+
 	/**
 	 * \brief Create a matrix from an array of doubles.
 	 *
@@ -67,6 +76,13 @@ public:
 	 */
 	Matrix& operator=(const Matrix& x);
 
+#if __cplusplus >= 201103L
+	/**
+	 * \brief Set *this to m, by exchanging their rows.
+	 */
+	Matrix& operator=(Matrix&& x);
+#endif
+
 	/**
 	 * \brief True if the entries of (*this) coincide with m.
 	 *
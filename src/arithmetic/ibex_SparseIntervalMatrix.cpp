@@ -0,0 +1,291 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SparseIntervalMatrix.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+// Last Update : Oct 16, 2026
+//============================================================================
+
+#include "ibex_SparseIntervalMatrix.h"
+
+#include <cassert>
+#include <vector>
+#include <algorithm>
+
+using namespace std;
+
+namespace ibex {
+
+SparseIntervalMatrix::SparseIntervalMatrix(int nb_rows, int nb_cols, const int* row_start, const int* col) :
+		_nb_rows(nb_rows), _nb_cols(nb_cols) {
+	assert(nb_rows>0);
+	assert(nb_cols>0);
+
+	_row_start = new int[nb_rows+1];
+	for (int i=0; i<=nb_rows; i++) _row_start[i]=row_start[i];
+
+	int nnz=_row_start[nb_rows];
+	_col = new int[nnz];
+	for (int k=0; k<nnz; k++) {
+		assert(col[k]>=0 && col[k]<nb_cols);
+		_col[k]=col[k];
+	}
+
+	_val = new Interval[nnz>0? nnz : 1];
+	init(Interval::ZERO);
+}
+
+SparseIntervalMatrix::SparseIntervalMatrix(const IntervalMatrix& A) :
+		_nb_rows(A.nb_rows()), _nb_cols(A.nb_cols()) {
+
+	_row_start = new int[_nb_rows+1];
+	int nnz=0;
+	for (int i=0; i<_nb_rows; i++) {
+		_row_start[i]=nnz;
+		for (int j=0; j<_nb_cols; j++)
+			if (A[i][j]!=Interval::ZERO) nnz++;
+	}
+	_row_start[_nb_rows]=nnz;
+
+	_col = new int[nnz];
+	_val = new Interval[nnz>0? nnz : 1];
+	_val[0]=A.is_empty()? Interval::EMPTY_SET : Interval::ZERO;
+
+	int k=0;
+	for (int i=0; i<_nb_rows; i++) {
+		for (int j=0; j<_nb_cols; j++)
+			if (A[i][j]!=Interval::ZERO) {
+				_col[k]=j;
+				_val[k++]=A[i][j];
+			}
+	}
+}
+
+SparseIntervalMatrix::SparseIntervalMatrix(const SparseIntervalMatrix& A) :
+		_nb_rows(A._nb_rows), _nb_cols(A._nb_cols) {
+
+	int nnz=A.nb_nonzeros();
+
+	_row_start = new int[_nb_rows+1];
+	_col = new int[nnz];
+	_val = new Interval[nnz>0? nnz : 1];
+
+	for (int i=0; i<=_nb_rows; i++) _row_start[i]=A._row_start[i];
+	for (int k=0; k<nnz; k++) _col[k]=A._col[k];
+	for (int k=0; k<(nnz>0? nnz : 1); k++) _val[k]=A._val[k];
+}
+
+SparseIntervalMatrix::~SparseIntervalMatrix() {
+	delete[] _row_start;
+	delete[] _col;
+	delete[] _val;
+}
+
+SparseIntervalMatrix& SparseIntervalMatrix::operator=(const SparseIntervalMatrix& A) {
+	if (this==&A) return *this;
+
+	int nnz=A.nb_nonzeros();
+
+	if (_nb_rows!=A._nb_rows || nb_nonzeros()!=nnz) {
+		delete[] _row_start;
+		delete[] _col;
+		delete[] _val;
+		_row_start = new int[A._nb_rows+1];
+		_col = new int[nnz];
+		_val = new Interval[nnz>0? nnz : 1];
+	}
+
+	_nb_rows=A._nb_rows;
+	_nb_cols=A._nb_cols;
+
+	for (int i=0; i<=_nb_rows; i++) _row_start[i]=A._row_start[i];
+	for (int k=0; k<nnz; k++) _col[k]=A._col[k];
+	for (int k=0; k<(nnz>0? nnz : 1); k++) _val[k]=A._val[k];
+
+	return *this;
+}
+
+int SparseIntervalMatrix::index(int i, int j) const {
+	assert(i>=0 && i<_nb_rows);
+	assert(j>=0 && j<_nb_cols);
+
+	// binary search (the columns of a row are sorted)
+	int l=_row_start[i];
+	int u=_row_start[i+1]-1;
+	while (l<=u) {
+		int k=(l+u)/2;
+		if (_col[k]==j) return k;
+		else if (_col[k]<j) l=k+1;
+		else u=k-1;
+	}
+	return -1;
+}
+
+Interval SparseIntervalMatrix::operator()(int i, int j) const {
+	if (is_empty()) return Interval::EMPTY_SET;
+	int k=index(i,j);
+	return k==-1? Interval::ZERO : _val[k];
+}
+
+void SparseIntervalMatrix::init(const Interval& x) {
+	int nnz=nb_nonzeros();
+	for (int k=0; k<(nnz>0? nnz : 1); k++) _val[k]=x;
+}
+
+void SparseIntervalMatrix::set_empty() {
+	init(Interval::EMPTY_SET);
+}
+
+IntervalMatrix SparseIntervalMatrix::dense() const {
+	IntervalMatrix A(_nb_rows,_nb_cols,Interval::ZERO);
+
+	if (is_empty()) {
+		A.set_empty();
+		return A;
+	}
+
+	for (int i=0; i<_nb_rows; i++)
+		for (int k=_row_start[i]; k<_row_start[i+1]; k++)
+			A[i][_col[k]]=_val[k];
+	return A;
+}
+
+Matrix SparseIntervalMatrix::lb() const {
+	assert(!is_empty());
+
+	Matrix A(_nb_rows,_nb_cols,0.0);
+	for (int i=0; i<_nb_rows; i++)
+		for (int k=_row_start[i]; k<_row_start[i+1]; k++)
+			A[i][_col[k]]=_val[k].lb();
+	return A;
+}
+
+Matrix SparseIntervalMatrix::ub() const {
+	assert(!is_empty());
+
+	Matrix A(_nb_rows,_nb_cols,0.0);
+	for (int i=0; i<_nb_rows; i++)
+		for (int k=_row_start[i]; k<_row_start[i+1]; k++)
+			A[i][_col[k]]=_val[k].ub();
+	return A;
+}
+
+Matrix SparseIntervalMatrix::mid() const {
+	assert(!is_empty());
+
+	Matrix A(_nb_rows,_nb_cols,0.0);
+	for (int i=0; i<_nb_rows; i++)
+		for (int k=_row_start[i]; k<_row_start[i+1]; k++)
+			A[i][_col[k]]=_val[k].mid();
+	return A;
+}
+
+IntervalVector operator*(const SparseIntervalMatrix& A, const IntervalVector& x) {
+	assert(A.nb_cols()==x.size());
+
+	IntervalVector y(A.nb_rows());
+
+	if (A.is_empty() || x.is_empty()) {
+		y.set_empty();
+		return y;
+	}
+
+	for (int i=0; i<A.nb_rows(); i++) {
+		y[i]=Interval::ZERO;
+		for (int k=A.row_start(i); k<A.row_start(i+1); k++)
+			y[i]+=A.val(k)*x[A.col(k)];
+	}
+	return y;
+}
+
+IntervalMatrix operator*(const Matrix& C, const SparseIntervalMatrix& A) {
+	assert(C.nb_cols()==A.nb_rows());
+
+	IntervalMatrix P(C.nb_rows(),A.nb_cols(),Interval::ZERO);
+
+	if (A.is_empty()) {
+		P.set_empty();
+		return P;
+	}
+
+	// P[i][j] = sum_k C[i][k]*A[k][j] where (k,j) is a nonzero entry of A
+	for (int k=0; k<A.nb_rows(); k++) {
+		for (int l=A.row_start(k); l<A.row_start(k+1); l++) {
+			int j=A.col(l);
+			for (int i=0; i<C.nb_rows(); i++) {
+				if (C[i][k]!=0) P[i][j]+=C[i][k]*A.val(l);
+			}
+		}
+	}
+	return P;
+}
+
+SparseIntervalMatrix sparse_mul(const Matrix& C, const SparseIntervalMatrix& A) {
+	assert(C.nb_cols()==A.nb_rows());
+
+	int m=A.nb_cols();
+
+	vector<int> row_start(C.nb_rows()+1);
+	vector<int> col;
+	vector<Interval> val;
+
+	// the ith row of C*A is accumulated in "acc", on the columns "cols"
+	vector<Interval> acc(m);
+	vector<int> mark(m,-1);   // mark[j]==i iff j is in cols
+	vector<int> cols;
+
+	for (int i=0; i<C.nb_rows(); i++) {
+		row_start[i]=col.size();
+		cols.clear();
+
+		for (int k=0; k<A.nb_rows(); k++) {
+			if (C[i][k]==0) continue;
+			for (int l=A.row_start(k); l<A.row_start(k+1); l++) {
+				int j=A.col(l);
+				if (mark[j]!=i) {
+					mark[j]=i;
+					acc[j]=Interval::ZERO;
+					cols.push_back(j);
+				}
+				acc[j]+=C[i][k]*A.val(l);
+			}
+		}
+
+		sort(cols.begin(),cols.end());
+		for (vector<int>::iterator it=cols.begin(); it!=cols.end(); it++) {
+			if (acc[*it]!=Interval::ZERO) {
+				col.push_back(*it);
+				val.push_back(acc[*it]);
+			}
+		}
+	}
+	row_start[C.nb_rows()]=col.size();
+
+	SparseIntervalMatrix P(C.nb_rows(),m,&row_start[0],col.empty()? NULL : &col[0]);
+	for (int k=0; k<P.nb_nonzeros(); k++)
+		P.val(k)=val[k];
+
+	if (A.is_empty()) P.set_empty();
+	return P;
+}
+
+std::ostream& operator<<(std::ostream& os, const SparseIntervalMatrix& A) {
+	if (A.is_empty()) return os << "empty matrix";
+
+	os << "(";
+	for (int i=0; i<A.nb_rows(); i++) {
+		os << "(";
+		for (int k=A.row_start(i); k<A.row_start(i+1); k++) {
+			os << A.col(k) << ":" << A.val(k);
+			if (k<A.row_start(i+1)-1) os << " ; ";
+		}
+		os << ")";
+		if (i<A.nb_rows()-1) os << std::endl;
+	}
+	os << ")";
+	return os;
+}
+
+} // namespace ibex
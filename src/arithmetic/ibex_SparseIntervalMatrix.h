@@ -0,0 +1,222 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_SparseIntervalMatrix.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+// Last Update : Oct 16, 2026
+//============================================================================
+
+#ifndef __IBEX_SPARSE_INTERVAL_MATRIX_H__
+#define __IBEX_SPARSE_INTERVAL_MATRIX_H__
+
+#include <iostream>
+#include "ibex_IntervalMatrix.h"
+
+namespace ibex {
+
+/**
+ * \ingroup arithmetic
+ *
+ * \brief Sparse interval matrix.
+ *
+ * The matrix is stored row by row ("compressed sparse row" format): the
+ * structural nonzero entries of the ith row are the entries k with
+ * row_start(i)<=k<row_start(i+1), in increasing order of their column col(k).
+ * All the other entries are 0.
+ *
+ * The structure is fixed at construction. It is typically the structure of
+ * the Jacobian matrix of a function (see #ibex::Function::jacobian_structure() const).
+ */
+class SparseIntervalMatrix {
+
+public:
+	/**
+	 * \brief Create a (nb_rows x nb_cols) sparse matrix.
+	 *
+	 * The column indices of the nonzero entries of the ith row are col[row_start[i]],
+	 * ..., col[row_start[i+1]-1] and must be in increasing order. The arrays are copied.
+	 * All the entries are initialized to 0.
+	 */
+	SparseIntervalMatrix(int nb_rows, int nb_cols, const int* row_start, const int* col);
+
+	/**
+	 * \brief Create a sparse matrix from a dense one.
+	 *
+	 * The structure is made of the entries of \a A that are not 0.
+	 */
+	explicit SparseIntervalMatrix(const IntervalMatrix& A);
+
+	/**
+	 * \brief Copy A.
+	 */
+	SparseIntervalMatrix(const SparseIntervalMatrix& A);
+
+	/**
+	 * \brief Delete *this.
+	 */
+	~SparseIntervalMatrix();
+
+	/**
+	 * \brief Assign A to *this (the structure is copied).
+	 */
+	SparseIntervalMatrix& operator=(const SparseIntervalMatrix& A);
+
+	/**
+	 * \brief Return the number of rows.
+	 */
+	int nb_rows() const;
+
+	/**
+	 * \brief Return the number of columns.
+	 */
+	int nb_cols() const;
+
+	/**
+	 * \brief Return the number of (structural) nonzero entries.
+	 */
+	int nb_nonzeros() const;
+
+	/**
+	 * \brief Index of the first nonzero entry of the ith row.
+	 *
+	 * row_start(nb_rows()) is nb_nonzeros().
+	 */
+	int row_start(int i) const;
+
+	/**
+	 * \brief Column of the kth nonzero entry.
+	 */
+	int col(int k) const;
+
+	/**
+	 * \brief Value of the kth nonzero entry.
+	 */
+	Interval& val(int k);
+
+	/**
+	 * \brief Value of the kth nonzero entry (const version).
+	 */
+	const Interval& val(int k) const;
+
+	/**
+	 * \brief Index of the entry (i,j) among the nonzero entries.
+	 *
+	 * Return -1 if (i,j) is not in the structure.
+	 */
+	int index(int i, int j) const;
+
+	/**
+	 * \brief Value of the entry (i,j) (0 if (i,j) is not in the structure).
+	 */
+	Interval operator()(int i, int j) const;
+
+	/**
+	 * \brief Set all the nonzero entries to x.
+	 */
+	void init(const Interval& x);
+
+	/**
+	 * \brief Set *this to the empty matrix.
+	 *
+	 * The dimensions and the structure remain the same.
+	 */
+	void set_empty();
+
+	/**
+	 * \brief Return true iff *this is empty.
+	 */
+	bool is_empty() const;
+
+	/**
+	 * \brief Return the dense matrix.
+	 */
+	IntervalMatrix dense() const;
+
+	/**
+	 * \brief Return the lower bound matrix (dense).
+	 */
+	Matrix lb() const;
+
+	/**
+	 * \brief Return the upper bound matrix (dense).
+	 */
+	Matrix ub() const;
+
+	/**
+	 * \brief Return the midpoint matrix (dense).
+	 */
+	Matrix mid() const;
+
+protected:
+	int _nb_rows;
+	int _nb_cols;
+	int* _row_start;
+	int* _col;
+	Interval* _val; // values (one more unused entry if there is no nonzero)
+};
+
+/**
+ * \brief Return A*x.
+ */
+IntervalVector operator*(const SparseIntervalMatrix& A, const IntervalVector& x);
+
+/**
+ * \brief Return C*A (dense).
+ *
+ * The product is calculated with the nonzero entries of A only.
+ */
+IntervalMatrix operator*(const Matrix& C, const SparseIntervalMatrix& A);
+
+/**
+ * \brief Return C*A (sparse).
+ *
+ * Same as #operator*(const Matrix&, const SparseIntervalMatrix&) but the product
+ * is calculated row by row and stored in a sparse matrix (no dense matrix is built):
+ * the structure of the result is made of the entries that are not exactly 0.
+ */
+SparseIntervalMatrix sparse_mul(const Matrix& C, const SparseIntervalMatrix& A);
+
+/**
+ * \brief Stream out A.
+ */
+std::ostream& operator<<(std::ostream& os, const SparseIntervalMatrix& A);
+
+/*================================== inline implementations ========================================*/
+
+inline int SparseIntervalMatrix::nb_rows() const {
+	return _nb_rows;
+}
+
+inline int SparseIntervalMatrix::nb_cols() const {
+	return _nb_cols;
+}
+
+inline int SparseIntervalMatrix::nb_nonzeros() const {
+	return _row_start[_nb_rows];
+}
+
+inline int SparseIntervalMatrix::row_start(int i) const {
+	return _row_start[i];
+}
+
+inline int SparseIntervalMatrix::col(int k) const {
+	return _col[k];
+}
+
+inline Interval& SparseIntervalMatrix::val(int k) {
+	return _val[k];
+}
+
+inline const Interval& SparseIntervalMatrix::val(int k) const {
+	return _val[k];
+}
+
+inline bool SparseIntervalMatrix::is_empty() const {
+	return _val[0].is_empty();
+}
+
+} // namespace ibex
+
+#endif // __IBEX_SPARSE_INTERVAL_MATRIX_H__
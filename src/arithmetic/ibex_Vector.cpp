@@ -15,27 +15,48 @@
 
 namespace ibex {
 
-Vector::Vector(int nn) : n(nn), vec(new double[nn]) {
+Vector::Vector(int nn) : n(nn), vec(alloc(nn)) {
 	assert(nn>=1);
 	for (int i=0; i<nn; i++) vec[i]=0;
 }
 
-Vector::Vector(int nn, double x) : n(nn), vec(new double[nn]) {
+Vector::Vector(int nn, double x) : n(nn), vec(alloc(nn)) {
 	assert(nn>=1);
 	for (int i=0; i<nn; i++) vec[i]=x;
 }
 
-Vector::Vector(const Vector& x) : n(x.n), vec(new double[x.n]) {
+Vector::Vector(const Vector& x) : n(x.n), vec(alloc(x.n)) {
 	for (int i=0; i<n; i++) vec[i]=x[i];
 }
 
-Vector::Vector(int nn, double x[]) : n(nn), vec(new double[nn]) {
+#if __cplusplus >= 201103L
+Vector::Vector(Vector&& x) : n(x.n), vec(NULL) {
+	if (x.vec==x.buf) {
+		vec=alloc(n);
+		for (int i=0; i<n; i++) vec[i]=x[i];
+	} else {
+		vec=x.vec;
+		x.vec=NULL;
+		x.n=0;
+	}
+}
+#endif
+
+Vector::Vector(int nn, double x[]) : n(nn), vec(alloc(nn)) {
 	assert(nn>=1);
 	for (int i=0; i<nn; i++) vec[i]=x[i];
 }
 
 Vector::~Vector() {
-	delete[] vec;
+	release();
+}
+
+double* Vector::alloc(int n) {
+	return n<=INLINE_SIZE? buf : new double[n];
+}
+
+void Vector::release() {
+	if (vec!=buf) delete[] vec;
 }
 
 void Vector::resize(int n2) {
@@ -44,14 +65,21 @@ void Vector::resize(int n2) {
 
 	if (n2==size()) return;
 
-	double* newVec=new double[n2];
+	if (vec==buf && n2<=INLINE_SIZE) {
+		// the components remain in place
+		for (int i=n; i<n2; i++) vec[i]=0.0;
+		n = n2;
+		return;
+	}
+
+	// note: if the new vector is inline, the old one is not.
+	double* newVec=alloc(n2);
 	int i=0;
 	for (; i<size() && i<n2; i++)
 		newVec[i]=vec[i];
 	for (; i<n2; i++)
 		newVec[i]=0.0;
-	if (vec!=NULL) // vec==NULL happens when default constructor is used (n==0)
-		delete[] vec;
+	release(); // vec==NULL happens when default constructor is used (n==0)
 
 	n   = n2;
 	vec = newVec;
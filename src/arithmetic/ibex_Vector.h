@@ -24,6 +24,8 @@ class ExprConstant;
  *
  * \brief Vector of reals
  *
+ * The components of a vector of size at most #INLINE_SIZE are stored inside
+ * the object itself (no dynamic allocation).
  */
 class Vector {
 public:
@@ -49,6 +51,15 @@ public:
 	 */
 	Vector(const Vector& x);
 
+#if __cplusplus >= 201103L
+	/**
+	 * \brief Move \a x into *this.
+	 *
+	 * \a x is left with no component and must not be used anymore.
+	 */
+	Vector(Vector&& x);
+#endif
+
 	/**
 	 * \brief Create the Vector [x[0]; ..; x[n]]
 	 *
@@ -163,6 +174,11 @@ public:
 	 */
 	static Vector ones(int n);
 
+	/**
+	 * \brief Maximal size of a vector whose components are stored inline.
+	 */
+	static const int INLINE_SIZE=16;
+
 	/**
 	 * \brief Cast the vector to an expression
 	 */
@@ -173,8 +189,16 @@ private:
 
 	Vector() : n(0), vec(NULL) { } // for Matrix
 
+	// Allocate n components, inline if n<=INLINE_SIZE.
+	// Does not modify *this.
+	double* alloc(int n);
+
+	// Free the components (does not modify n and vec)
+	void release();
+
 	int n;             // dimension (size of vec)
 	double *vec;	   // vector of elements
+	double buf[INLINE_SIZE]; // storage of the components for n<=INLINE_SIZE
 };
 
 /** \ingroup arithmetic */
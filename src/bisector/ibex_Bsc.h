@@ -140,6 +140,14 @@ public:
 		return std::pair<Backtrackable*,Backtrackable*>(new BisectedVar(var),new BisectedVar(var));
 	}
 
+	void write(std::ostream& os) const {
+		os.write((char*) &var, sizeof(int));
+	}
+
+	void read(std::istream& is) {
+		is.read((char*) &var, sizeof(int));
+	}
+
 	int var;
 };
 
@@ -48,6 +48,39 @@ void Ctc::contract(IntervalVector& box, const BitSet& impact, BitSet& flags) {
 	_output_flags = NULL;
 }
 
+bool Ctc::try_contract(IntervalVector& box) {
+	try {
+		contract(box);
+	}
+	catch(EmptyBoxException&) {
+		box.set_empty();
+		return false;
+	}
+	return true;
+}
+
+bool Ctc::try_contract(IntervalVector& box, const BitSet& impact) {
+	_impact = &impact;
+
+	bool ok=try_contract(box);
+
+	_impact = NULL;
+	return ok;
+}
+
+bool Ctc::try_contract(IntervalVector& box, const BitSet& impact, BitSet& flags) {
+	_impact = &impact;
+	_output_flags = &flags;
+
+	flags.clear();
+
+	bool ok=try_contract(box);
+
+	_impact = NULL;
+	_output_flags = NULL;
+	return ok;
+}
+
 bool Ctc::check_nb_var_ctc_list (const Array<Ctc>& l)  {
 	int i=1, n=l[0].nb_var;
 	while (i<l.size() && l[i].nb_var==n) {
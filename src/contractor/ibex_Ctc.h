@@ -72,6 +72,37 @@ public:
 	 */
 	void contract(IntervalVector& box, const BitSet& impact, BitSet& flags);
 
+	/**
+	 * \brief Contraction, without exception.
+	 *
+	 * Same as #contract(IntervalVector&) except that an empty result is
+	 * not signaled by an EmptyBoxException: the box is set to the empty
+	 * set and false is returned.
+	 *
+	 * By default, this function calls contract(box) and catches the exception.
+	 * The contractors involved in constraint propagation (#ibex::CtcFwdBwd,
+	 * #ibex::CtcPropag, #ibex::CtcCompo, #ibex::CtcFixPoint) override it so that
+	 * no exception is raised at all (in branch & prune, most of the boxes end up
+	 * empty and unwinding the stack each time is costly).
+	 */
+	virtual bool try_contract(IntervalVector& box);
+
+	/**
+	 * \brief Contraction with specified impact, without exception.
+	 *
+	 * \see #contract(IntervalVector&, const BitSet&).
+	 * \see #try_contract(IntervalVector&).
+	 */
+	bool try_contract(IntervalVector& box, const BitSet& impact);
+
+	/**
+	 * \brief Contraction with specified impact and output flags, without exception.
+	 *
+	 * \see #contract(IntervalVector&, const BitSet&, BitSet&).
+	 * \see #try_contract(IntervalVector&).
+	 */
+	bool try_contract(IntervalVector& box, const BitSet& impact, BitSet& flags);
+
 	/**
 	 * \brief The number of variables this contractor works with.
 	 */
@@ -55,6 +55,10 @@ bool Ctc3BCid::equalBoxes (int var, IntervalVector &box1, IntervalVector &box2)
 }
 
 void Ctc3BCid::contract(IntervalVector& box) {
+	if (!try_contract(box)) throw EmptyBoxException();
+}
+
+bool Ctc3BCid::try_contract(IntervalVector& box) {
 	int var;                                           // [gch] variable to be carCIDed
 
 	start_var=nb_var-1;                                //  patch pour l'optim  A RETIRER ??
@@ -67,10 +71,11 @@ void Ctc3BCid::contract(IntervalVector& box) {
 		var3BCID(box,var);
 		impact.remove(var);                           // [gch]
 
-		if(box.is_empty()) throw EmptyBoxException();
+		if(box.is_empty()) return false;
 	}
 
 	//	start_var=(start_var+vhandled)%nb_var;             //  en contradiction avec le patch pour l'optim
+	return true;
 }
 
 
@@ -104,18 +109,17 @@ bool Ctc3BCid::var3BCID_dicho(IntervalVector& box, int var, double w3b) {
 
 	bool r0= shave_bound_dicho(box, var, w3b, true);    // left shaving , after box contains the left slide
 
+	if (box.is_empty()) return true;                   // the whole domain has been removed
+
 	if (box[var].ub() == initbox[var].ub())
 		return true;                                   // the left slide reaches the right bound : nothing more to do
 
 	IntervalVector leftbox=box;
 	box=initbox;
 	box[var]= Interval(leftbox[var].lb(),initbox[var].ub());
-	bool r1=false;
-	try {
-		r1= shave_bound_dicho (box, var,  w3b, false); // may throw EmptyBoxException
-	}
-	catch (EmptyBoxException& e) {
-		box=leftbox; return true;                      // in case of EmptyBoxException of the right shaving,
+	bool r1= shave_bound_dicho (box, var,  w3b, false);
+	if (box.is_empty()) {
+		box=leftbox; return true;                      // in case of empty box after the right shaving,
 		// the contracted box becomes the left box
 	}
 
@@ -159,8 +163,7 @@ bool Ctc3BCid::shave_bound_dicho(IntervalVector& box, int var,  double wv, bool
 			//      cout << "  inf=" << inf << " lb=" << lb << " rb=" << rb << " sup=" << sup << endl;
 			box[var] = Interval(inf,lb);
 
-			try {
-				ctc.contract(box,impact);              // [gch] only "var" is set in "impact".
+			if (ctc.try_contract(box,impact)) {        // [gch] only "var" is set in "impact".
 				inf=box[var].lb();
 				volatile double mid = (inf+lb)/2;      // we must subdivide the current slice (declared volatile to prevent
 				//   the compiler from expanding mid in the next line and using higher
@@ -169,11 +172,11 @@ bool Ctc3BCid::shave_bound_dicho(IntervalVector& box, int var,  double wv, bool
 					break;
 				else lb=mid;                           // useless to restore domains (we divide the same slice)
 
-			} catch(EmptyBoxException& e) {            // the current slice has been cut off
+			} else {                                   // the current slice has been cut off
 				//	cout << "      slice removed.\n";
 				if (inf==lb) {                         // border is degenerated and current=border
 					if (inf==sup)                      // current=border=the whole interval itself:
-						throw e;                       //   in this case the box must remain entirely emptied
+						return true;                   //   in this case the box must remain entirely emptied
 					else break;                        // return anyway (no more to do).
 				}
 				tmp = inf;                             // current value of inf is used two lines below, save it
@@ -193,8 +196,7 @@ bool Ctc3BCid::shave_bound_dicho(IntervalVector& box, int var,  double wv, bool
 			//      cout << "  inf=" << inf << " lb=" << lb << " rb=" << rb << " sup=" << sup << endl;
 			box[var] = Interval(rb,sup);
 
-			try {
-				ctc.contract(box,impact);              // [gch] only "var" is set in "impact".
+			if (ctc.try_contract(box,impact)) {        // [gch] only "var" is set in "impact".
 				sup=box[var].ub();
 				volatile double mid = (rb+sup)/2;      // we must subdivide the current interval (declared volatile to prevent
 				//   the compiler from expanding mid in the next line and using higher
@@ -203,11 +205,11 @@ bool Ctc3BCid::shave_bound_dicho(IntervalVector& box, int var,  double wv, bool
 					break;
 				else rb=mid;                           // useless to restore domains (we divide the same slice)
 
-			} catch(EmptyBoxException& e) {            // the current slice has been cut off
+			} else {                                   // the current slice has been cut off
 				//cout << "      slice removed.\n";
 				if (sup==rb) {                         // border is degenerated and current=border
 					if (inf==sup)                      // current=border=the whole interval itself:
-						throw e;                       //   in this case the box must remain entirely emptied
+						return true;                   //   in this case the box must remain entirely emptied
 					else break;                        // return anyway (no more to do).
 				}
 				tmp = sup;                             // current value of sup is used two lines below, save it
@@ -246,9 +248,7 @@ bool Ctc3BCid::var3BCID_slices(IntervalVector& box, int var, int locs3b, double
 		dom = Interval(inf_k, sup_k);
 
 		// Try to refute this slice
-		try {
-			ctc.contract(box,impact);                  // [gch] only "var" is set in "impact".
-		} catch(EmptyBoxException& e) {
+		if (!ctc.try_contract(box,impact)) {           // [gch] only "var" is set in "impact".
 			leftBound = sup_k;
 			k++;
 			continue;
@@ -262,7 +262,7 @@ bool Ctc3BCid::var3BCID_slices(IntervalVector& box, int var, int locs3b, double
 
 	if (!stopLeft) {                                   // all slices give an empty box
 		box.set_empty();
-		throw EmptyBoxException();
+		return true;
 	} else if (k == locs3b) {
 		// Only the last slice gives a non-empty box : box is reduced to this last slice
 		return true;
@@ -288,9 +288,7 @@ bool Ctc3BCid::var3BCID_slices(IntervalVector& box, int var, int locs3b, double
 			dom = Interval(inf_k, sup_k);
 
 			// Try to refute the slice
-			try {
-				ctc.contract(box,impact);                  // [gch] only "var" is set in "impact".
-			} catch(EmptyBoxException& e) {
+			if (!ctc.try_contract(box,impact)) {           // [gch] only "var" is set in "impact".
 				rightBound = sup_k;
 				k2--;
 				continue;
@@ -351,12 +349,9 @@ bool Ctc3BCid::varCID(int var, IntervalVector &varcid_box, IntervalVector &var3B
 		if (sup_k > dom.ub() || (k == scid-1 && sup_k < dom.ub())) sup_k = dom.ub();
 		dom = Interval(inf_k, sup_k);
 
-		try {
-			ctc.contract(box,impact);                  // [gch] only "var" is set in "impact".
-		}
-		catch(EmptyBoxException& e) {
+		if (!ctc.try_contract(box,impact))             // [gch] only "var" is set in "impact".
 			continue;                                  // the current slice is infeasible : nothing to add to the hull
-		}
+
 
 		var3Bcid_box |= box;                           // add box to the hull
 		if(equalBoxes (var, varcid_box, var3Bcid_box))
@@ -113,6 +113,13 @@ class Ctc3BCid : public Ctc {
 	 */
 	virtual void contract(IntervalVector& box);
 
+	/**
+	 * \brief Apply contraction (without exception).
+	 *
+	 * \see #contract(IntervalVector&).
+	 */
+	virtual bool try_contract(IntervalVector& box);
+
 	/** The variables to which var3BCID is applied **/
 	BitSet cid_vars;
 
@@ -181,7 +188,7 @@ class Ctc3BCid : public Ctc {
 	 * 3B dicho applies 3B left or right contraction
 	 * returns in box  the left or right non empty slide.
 	 *
-	 * \throw EmptyBoxException.
+	 * The box is set to the empty set if the whole domain of var is removed.
 	 */
 	bool shave_bound_dicho(IntervalVector& box, int var, double wv, bool left);
 
@@ -80,6 +80,13 @@ public :
 	 */
 	virtual void contract(IntervalVector& box);
 
+	/**
+	 * \brief The contraction function (without exception).
+	 *
+	 * \see #contract(IntervalVector&).
+	 */
+	virtual bool try_contract(IntervalVector& box);
+
 	double nbvar_stat();
 
 	/** the handled constraint system */
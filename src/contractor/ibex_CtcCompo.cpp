@@ -178,6 +178,10 @@ CtcCompo::~CtcCompo() {
 
 
 void CtcCompo::contract(IntervalVector& box) {
+	if (!try_contract(box)) throw EmptyBoxException();
+}
+
+bool CtcCompo::try_contract(IntervalVector& box) {
 
 	// TODO: wrong algorithm here
 //	if (incremental) {
@@ -197,9 +201,10 @@ void CtcCompo::contract(IntervalVector& box) {
 //	}
 
 	for (int i=0; i<list.size(); i++) {
-		list[i].contract(box);
+		if (!list[i].try_contract(box)) return false;
 	}
 
+	return true;
 }
 
 } // end namespace ibex
@@ -82,6 +82,11 @@ public:
 	 */
 	virtual void contract(IntervalVector& box);
 
+	/**
+	 * \brief Contract a box (without exception).
+	 */
+	virtual bool try_contract(IntervalVector& box);
+
 	/** The list of sub-contractors */
 	Array<Ctc> list;
 
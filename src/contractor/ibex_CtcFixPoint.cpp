@@ -22,12 +22,18 @@ CtcFixPoint::~CtcFixPoint(){
 }
 
 void CtcFixPoint::contract(IntervalVector& box) {
+	if (!try_contract(box)) throw EmptyBoxException();
+}
+
+bool CtcFixPoint::try_contract(IntervalVector& box) {
 
 	IntervalVector old_box(box);
 	do {
 		old_box=box;
-		ctc.contract(box);
+		if (!ctc.try_contract(box)) return false;
 	} while (old_box.rel_distance(box)>ratio);
+
+	return true;
 }
 
 } // end namespace ibex
@@ -41,6 +41,11 @@ public:
 	 */
 	virtual void contract(IntervalVector& box);
 
+	/**
+	 * \brief Contract a box (without exception).
+	 */
+	virtual bool try_contract(IntervalVector& box);
+
 	/** The sub-contractor */
 	Ctc& ctc;
 
@@ -101,18 +101,22 @@ void CtcFwdBwd::init() {
 }
 
 void CtcFwdBwd::contract(IntervalVector& box) {
+	if (!try_contract(box)) throw EmptyBoxException();
+}
+
+bool CtcFwdBwd::try_contract(IntervalVector& box) {
 
 	assert(box.size()==f.nb_var());
 
-	try {
-		if (hc4r.proj(f,d,box)) {
-			set_flag(INACTIVE); // TODO: incorrect in general
-			set_flag(FIXPOINT); // TODO: incorrect if multiple occurrences
-		}
-	} catch (EmptyBoxException& e) {
-		box.set_empty();
-		throw e;
+	bool inactive=hc4r.try_proj(f,d,box);
+
+	if (box.is_empty()) return false;
+
+	if (inactive) {
+		set_flag(INACTIVE); // TODO: incorrect in general
+		set_flag(FIXPOINT); // TODO: incorrect if multiple occurrences
 	}
+	return true;
 }
 
 } // namespace ibex
@@ -70,6 +70,11 @@ public:
 	 */
 	virtual void contract(IntervalVector& box);
 
+	/**
+	 * \brief Contract the box (without exception).
+	 */
+	virtual bool try_contract(IntervalVector& box);
+
 	/*
 	 * \brief Whether this contractor is idempotent (optional)
 	 */
@@ -78,7 +78,7 @@ bool hc4r_ev(const Function& f, const Domain& y, IntervalVector& x, Interval& z)
 
 	Eval().eval(f,x);
 
-	Domain& root=*f.expr().deco.d;
+	Domain& root=*f.expr_label().d;
 	assert(root.dim.type()==Dim::SCALAR);
 
     z=root.i();
@@ -997,7 +997,7 @@ Interval Function_OG::eval(IntervalVector& box){
 Interval Function_OG::eval(IntervalVector& box, bool minrevise){
    _eval_leaves(box, minrevise);
    Eval().eval(_f,_box);
-   return _f.expr().deco.d->i();
+   return _f.expr_label().d->i();
 }
 
 Interval Function_OG::revise(IntervalVector& box, bool minrevise){
@@ -329,7 +329,16 @@ public:
 	static const double ADAPTIVE;
 
 	/** Contract the box using <i>Mohc</i> in the set of constraints \a csp. */
-	virtual void contract(IntervalVector& box){
+	virtual void contract(IntervalVector& box){
+		if (!try_contract(box)) throw EmptyBoxException();
+	}
+
+	/**
+	 * \brief Contract the box using <i>Mohc</i> (without exception).
+	 *
+	 * \see #contract(IntervalVector&) and #ibex::Ctc::try_contract(IntervalVector&).
+	 */
+	virtual bool try_contract(IntervalVector& box){
 
 		//initialization of the value active_mono_proc for each constraint
 		//if the first contractor was used, the values are set to -1
@@ -340,7 +349,7 @@ public:
 			ctc->active_mono_proc=(update_active_mono_proc)? -1:active_mono_proc[i];
 		}
 
-		CtcPropag::contract(box);
+		if (!CtcPropag::try_contract(box)) return false;
 
 		//the array active_mono_proc is updated
 		for(int i=0;i<list.size();i++){
@@ -348,6 +357,7 @@ public:
 			active_mono_proc[i]=ctc->active_mono_proc;
 		}
 
+		return true;
 	}
 
 	/** Default \a tau_mohc value, set to 0.5  **/
@@ -38,12 +38,8 @@ void CtcNotIn::contract(IntervalVector& box) {
 	// we could also have used CtCunion of two CtcFwdBwd
 
 	IntervalVector savebox(box);
-	try {
-		HC4Revise().proj(f,d1,box);
-	} catch (EmptyBoxException& ) {box.set_empty(); }
-	try {
-		HC4Revise().proj(f,d2,savebox);
-	} catch (EmptyBoxException& ) {savebox.set_empty(); }
+	HC4Revise().try_proj(f,d1,box);
+	HC4Revise().try_proj(f,d2,savebox);
 
 	box |= savebox;
 	if (box.is_empty()) throw EmptyBoxException();
@@ -21,14 +21,18 @@ const int CtcOptimShaving::LimitCIDDichotomy=100;
 
 
   void CtcOptimShaving::contract(IntervalVector& box) {
+	if (!try_contract(box)) throw EmptyBoxException();
+  }
+
+  bool CtcOptimShaving::try_contract(IntervalVector& box) {
     int	var_obj=start_var;
 	impact.clear();                                // [gch]
 	impact.add(var_obj);                           // [gch]
 	var3BCID(box,var_obj);
 	impact.remove(var_obj);                        // [gch]
-	
-	  if(box.is_empty()) throw EmptyBoxException();
-	}
+
+	return !box.is_empty();
+  }
 
 
 // left shaving only (for optimization)
@@ -37,6 +41,7 @@ const int CtcOptimShaving::LimitCIDDichotomy=100;
   IntervalVector initbox = box;
 
   int r0= shave_bound_dicho(box,var, w3b, true);  // left shaving , after box contains the left slide
+  if (box.is_empty()) return true; // the whole domain has been removed
   if (box[var].ub() == initbox[var].ub())
     return true; // the left slide reaches the right bound : nothing more to do
   IntervalVector leftbox=box;
@@ -73,9 +78,7 @@ const int CtcOptimShaving::LimitCIDDichotomy=100;
     dom = Interval(inf_k, sup_k);
 
     // Try to refute this slice
-    try{
-      ctc.contract(box,impact);
-    }catch(EmptyBoxException e) {
+    if (!ctc.try_contract(box,impact)) {
       //leftBound = sup_k;
       k++;
       continue;
@@ -89,7 +92,7 @@ const int CtcOptimShaving::LimitCIDDichotomy=100;
 
   if (!stopLeft) { // all slices give an empty box
     box.set_empty();
-    throw EmptyBoxException();
+    return true;
   } else if (k == locs3b) {
     // Only the last slice gives a non-empty box : box is reduced to this last slice
     return true;
@@ -23,6 +23,13 @@ namespace ibex {
 			int vhandled=-1, double var_min_width=default_var_min_width);
 			
    virtual void contract(IntervalVector& box);
+
+   /**
+    * \brief Contract the box and return false if it is empty.
+    *
+    * Only the objective variable is shaved, as in #contract(IntervalVector&).
+    */
+   virtual bool try_contract(IntervalVector& box);
 	static const int LimitCIDDichotomy;
   protected:
 	virtual	bool var3BCID_dicho(IntervalVector& box, int var, double wv);
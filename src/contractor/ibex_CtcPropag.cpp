@@ -39,7 +39,11 @@ CtcPropag::CtcPropag(const Array<Ctc>& cl, double ratio, bool incremental) :
 }
 
 
-void  CtcPropag::contract(IntervalVector& box) {
+void CtcPropag::contract(IntervalVector& box) {
+	if (!try_contract(box)) throw EmptyBoxException();
+}
+
+bool CtcPropag::try_contract(IntervalVector& box) {
 
 	assert(box.size()==nb_var);
 
@@ -113,17 +117,15 @@ void  CtcPropag::contract(IntervalVector& box) {
 
 		//cout << "Contraction with " << c << endl;
 
-		try {
-			list[c].contract(box, _impact, flags);
-			if (flags[INACTIVE]) {
-				active.remove(c);
-			}
-		}
-		catch (EmptyBoxException& e) {
+		if (!list[c].try_contract(box, _impact, flags)) {
 			agenda.flush();
 			//cout << "=========== End propagation ==========" << endl;
 			//cout << "   empty!" << endl;
-			throw e;
+			return false;
+		}
+
+		if (flags[INACTIVE]) {
+			active.remove(c);
 		}
 
 		for (set<int>::iterator it=vars.begin(); it!=vars.end(); it++) {
@@ -156,6 +158,7 @@ void  CtcPropag::contract(IntervalVector& box) {
 	 * small w.r.t the ratio here. */
 	//   if (!reducted) box = propbox; // restore domains
 
+	return true;
 }
 
 const double CtcPropag::default_ratio = __IBEX_DEFAULT_RATIO_PROPAG;
@@ -59,6 +59,13 @@ public:
 	 */
 	virtual void contract(IntervalVector& box);
 
+	/**
+	 * \brief Enforces propagation (without exception).
+	 *
+	 * \see #contract(IntervalVector&) and #ibex::Ctc::try_contract(IntervalVector&).
+	 */
+	virtual bool try_contract(IntervalVector& box);
+
 	/** The list of contractors to propagate */
 	Array<Ctc> list;
 
@@ -20,8 +20,8 @@ namespace ibex {
 
 
 ExprLabel& Affine2Eval::eval_label(const Function& f, ExprLabel** args) const {
-	assert(f.expr().deco.af2);
-	assert(f.expr().deco.d);
+	assert(f.expr_label().af2);
+	assert(f.expr_label().d);
 
 	Array<const Affine2Domain> argDAF2(f.nb_arg());
 	Array<const Domain> argD(f.nb_arg());
@@ -48,8 +48,8 @@ ExprLabel& Affine2Eval::eval_label(const Function& f, ExprLabel** args) const {
 
 
 ExprLabel& Affine2Eval::eval_label(const Function& f, const IntervalVector& box) const {
-	assert(f.expr().deco.af2);
-	assert(f.expr().deco.d);
+	assert(f.expr_label().af2);
+	assert(f.expr_label().d);
 
 	f.write_arg_domains(box);
 	f.write_arg_af2_domains(box);
@@ -59,8 +59,8 @@ ExprLabel& Affine2Eval::eval_label(const Function& f, const IntervalVector& box)
 }
 
 ExprLabel& Affine2Eval::eval_label(const Function& f, const Affine2Vector& box) const {
-	assert(f.expr().deco.af2);
-	assert(f.expr().deco.d);
+	assert(f.expr_label().af2);
+	assert(f.expr_label().d);
 
 	f.write_arg_domains(IntervalVector(box));
 	f.write_arg_af2_domains(box);
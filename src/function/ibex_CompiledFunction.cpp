@@ -11,6 +11,7 @@
 
 #include "ibex_CompiledFunction.h"
 #include "ibex_Function.h"
+#include "ibex_Tape.h"
 #include <algorithm>
 
 using std::cout;
@@ -24,7 +25,7 @@ bool compare(const ExprNode* x, const ExprNode* y) { return (x->height>y->height
 
 }
 
-CompiledFunction::CompiledFunction() : 	n(0), code(NULL), nb_args(NULL), args(NULL) {
+CompiledFunction::CompiledFunction() : 	tape(NULL), n(0), code(NULL), nb_args(NULL), args(NULL) {
 
 }
 
@@ -46,9 +47,15 @@ void CompiledFunction::compile(const ExprNode& y) {
 	//cout << f.name << " : n=" << n << " nb_args[" << 0 << "]=" << nb_args[0] << endl;
 }
 
+void CompiledFunction::compile_tape(const Array<const ExprSymbol>& x) {
+	if (Tape::supported(*this))
+		tape=new Tape(x,*this);
+}
+
 CompiledFunction::~CompiledFunction() {
 	if (code==NULL) return; // not compiled
 
+	if (tape) delete tape;
 	delete[] code;
 	for (int i=0; i<n; i++) delete[] args[i];
 	delete[] args;
@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Dec 31, 2011
-// Last Update : 
+// Last Update : Oct 16, 2026
 //============================================================================
 
 #ifndef __IBEX_COMPILED_FUNCTION_H__
@@ -22,6 +22,7 @@
 namespace ibex {
 
 class Function;
+class Tape;
 
 /**
  * \ingroup symbolic
@@ -39,6 +40,14 @@ public:
 	 */
 	void compile(const ExprNode& y);
 
+	/**
+	 * \brief Build the tape of the function, if possible (see #ibex::Tape).
+	 *
+	 * \param x - the arguments of the function.
+	 * \pre compile(y) must be called before.
+	 */
+	void compile_tape(const Array<const ExprSymbol>& x);
+
 	/**
 	 * \brier Delete this.
 	 */
@@ -49,23 +58,37 @@ public:
 	 * return a reference to the label
 	 * of the root node. V must be a subclass of FwdAlgorithm.
 	 * Note that the type V is just passed in order to have static linkage.
+	 *
+	 * The labels used are given by \a args (same structure as
+	 * the "args" field, see #ibex::FunctionWorkspace).
 	 */
 	template<class V>
-	ExprLabel& forward(const V& algo) const;
+	ExprLabel& forward(const V& algo, ExprLabel*** args) const;
 
 	/**
 	 * Run the backward phase.  V must be a subclass of BwdAlgorithm.
 	 * Note that the type V is just passed in order to have static linkage.
+	 *
+	 * The labels used are given by \a args.
 	 */
 	template<class V>
-	void backward(const V& algo) const;
+	void backward(const V& algo, ExprLabel*** args) const;
 
 	/**
 	 * Print the structure to the standard output.
 	 */
 	void print() const;
 
+	/**
+	 * \brief Flat representation of the function.
+	 *
+	 * NULL if the function cannot be taped.
+	 */
+	Tape* tape;
+
 	friend class Function;
+	friend class FunctionWorkspace;
+	friend class Tape;
 
 protected:
 	typedef enum {
@@ -136,13 +159,13 @@ protected:
 	ExprSubNodes nodes;
 	operation *code;
 	int* nb_args;
-	mutable ExprLabel*** args;
+	mutable ExprLabel*** args; // labels of the DAG (default workspace)
 
 	mutable int ptr;
 };
 
 template<class V>
-ExprLabel& CompiledFunction::forward(const V& algo) const {
+ExprLabel& CompiledFunction::forward(const V& algo, ExprLabel*** args) const {
 	assert(dynamic_cast<const FwdAlgorithm* >(&algo)!=NULL);
 
 	for (int i=n-1; i>=0; i--) {
@@ -199,7 +222,7 @@ ExprLabel& CompiledFunction::forward(const V& algo) const {
 }
 
 template<class V>
-void CompiledFunction::backward(const V& algo) const {
+void CompiledFunction::backward(const V& algo, ExprLabel*** args) const {
 
 	assert(dynamic_cast<const BwdAlgorithm* >(&algo)!=NULL);
 
@@ -5,7 +5,7 @@
 // Copyright   : Ecole des Mines de Nantes (France)
 // License     : See the LICENSE file
 // Created     : Apr 4, 2012
-// Last Update : Jul 16, 2012
+// Last Update : Oct 16, 2026
 //============================================================================
 
 #ifndef __IBEX_DECORATOR_H__
@@ -34,6 +34,10 @@ class Function;
  * decorated: all the input variables, as nodes, are also
  * decorated. This is an important difference when some input symbols
  * do not appear in the expression, like (x,y)->x.
+ *
+ * The labels initialized are given by #label(const ExprNode&).
+ * By default, this is the #ibex::Expr::deco field but a subclass
+ * can decorate labels stored elsewhere (see #ibex::FunctionWorkspace).
  */
 class Decorator : public ExprVisitor {
 public:
@@ -47,6 +51,13 @@ public:
 	 */
 	virtual ~Decorator() { }
 
+	/**
+	 * \brief The label of a node.
+	 *
+	 * By default, the #ibex::Expr::deco field of the node.
+	 */
+	virtual ExprLabel& label(const ExprNode& e);
+
 protected:
 	/* Visit an expression. */
 	virtual void visit(const ExprNode& n);
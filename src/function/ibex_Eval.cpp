@@ -11,12 +11,13 @@
 
 #include "ibex_Eval.h"
 #include "ibex_Expr.h"
+#include "ibex_Tape.h"
 
 #include <typeinfo>
 namespace ibex {
 
 Domain& Eval::eval(const Function& f, ExprLabel** args) const {
-	assert(f.expr().deco.d);
+	assert(f.expr_label().d);
 
 	Array<const Domain> argD(f.nb_arg());
 
@@ -35,48 +36,92 @@ Domain& Eval::eval(const Function& f, ExprLabel** args) const {
 	try {
 		f.forward<Eval>(*this);
 	} catch(EmptyBoxException&) {
-		f.expr().deco.d->set_empty();
+		f.expr_label().d->set_empty();
 	}
-	return *f.expr().deco.d;
+	return *f.expr_label().d;
 }
 
 Domain& Eval::eval(const Function& f, const Array<const Domain>& d) const {
-	assert(f.expr().deco.d);
+	assert(f.expr_label().d);
 
 	f.write_arg_domains(d);
 
 	try {
 		f.forward<Eval>(*this);
 	} catch(EmptyBoxException&) {
-		f.expr().deco.d->set_empty();
+		f.expr_label().d->set_empty();
 	}
-	return *f.expr().deco.d;
+	return *f.expr_label().d;
 }
 
 Domain& Eval::eval(const Function& f, const Array<Domain>& d) const {
-	assert(f.expr().deco.d);
+	assert(f.expr_label().d);
 
 	f.write_arg_domains(d);
 
 	try {
 		f.forward<Eval>(*this);
 	} catch(EmptyBoxException&) {
-		f.expr().deco.d->set_empty();
+		f.expr_label().d->set_empty();
 	}
-	return *f.expr().deco.d;
+	return *f.expr_label().d;
 }
 
 Domain& Eval::eval(const Function &f, const IntervalVector& box) const {
-	assert(f.expr().deco.d);
+	assert(f.expr_label().d);
 
 	f.write_arg_domains(box);
 
 	try {
 		f.forward<Eval>(*this);
 	} catch(EmptyBoxException&) {
-		f.expr().deco.d->set_empty();
+		f.expr_label().d->set_empty();
 	}
-	return *f.expr().deco.d;
+	return *f.expr_label().d;
+}
+
+Domain& Eval::eval_root(const Function &f, const IntervalVector& box) const {
+	const Tape* tape=f.cf.tape;
+
+	if (!tape) return eval(f,box);
+
+	FunctionWorkspace& w=f.workspace();
+	Domain& root=*f.expr_label().d;
+
+	tape->load(box,w.regs);
+
+	if (tape->forward(w.regs))
+		tape->read_root(w.regs,root);
+	else
+		root.set_empty();
+	return root;
+}
+
+const int Eval::BATCH_SIZE=64;
+
+void Eval::eval_batch(const Function& f, const Array<const IntervalVector>& x, IntervalMatrix& y) const {
+	assert(f.expr().dim.is_scalar() || f.expr().dim.is_vector());
+	assert(y.nb_rows()==x.size() && y.nb_cols()==f.image_dim());
+
+	const Tape* tape=f.cf.tape;
+
+	if (!tape) {
+		for (int i=0; i<x.size(); i++) y[i]=f.eval_vector(x[i]);
+		return;
+	}
+
+	double* lb=new double[tape->nb_regs*BATCH_SIZE];
+	double* ub=new double[tape->nb_regs*BATCH_SIZE];
+
+	for (int start=0; start<x.size(); start+=BATCH_SIZE) {
+		int n=x.size()-start<BATCH_SIZE? x.size()-start : BATCH_SIZE;
+		tape->load(x,start,n,lb,ub);
+		tape->forward(lb,ub,n);
+		tape->read_root(lb,ub,n,y,start);
+	}
+
+	delete[] lb;
+	delete[] ub;
 }
 
 void Eval::vector_fwd(const ExprVector& v, const ExprLabel** compL, ExprLabel& y) {
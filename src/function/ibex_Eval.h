@@ -44,6 +44,31 @@ public:
 	 */
 	Domain& eval(const Function&, const IntervalVector& box) const;
 
+	/**
+	 * \brief Run the forward algorithm with an input box, over the tape of the function.
+	 *
+	 * Only the label of the root node is set (the other labels are left unchanged).
+	 * If the function has no tape, same as #eval(const Function&, const IntervalVector&) const.
+	 */
+	Domain& eval_root(const Function&, const IntervalVector& box) const;
+
+	/**
+	 * \brief Run the forward algorithm on a batch of boxes, over the tape of the function.
+	 *
+	 * Set the ith row of \a y to f(x[i]) (the row is set to the empty set if
+	 * a component of f(x[i]) is empty). The boxes are evaluated by groups of
+	 * #BATCH_SIZE (see #ibex::Tape::forward(double*,double*,int) const).
+	 * If the function has no tape, the boxes are evaluated one by one.
+	 *
+	 * \pre f is real-valued or vector-valued.
+	 */
+	void eval_batch(const Function&, const Array<const IntervalVector>& x, IntervalMatrix& y) const;
+
+	/**
+	 * \brief Number of boxes evaluated simultaneously by #eval_batch.
+	 */
+	static const int BATCH_SIZE;
+
 	inline void index_fwd(const ExprIndex&, const ExprLabel& x, ExprLabel& y);
 	       void vector_fwd(const ExprVector&, const ExprLabel** compL, ExprLabel& y);
 	inline void cst_fwd(const ExprConstant&, ExprLabel& y);
@@ -0,0 +1,84 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_EvalContext.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+// Last Update : Oct 16, 2026
+//============================================================================
+
+#include "ibex_EvalContext.h"
+#include "ibex_Function.h"
+#include "ibex_FunctionWorkspace.h"
+#include "ibex_Thread.h"
+
+#include <cassert>
+
+using namespace std;
+
+namespace ibex {
+
+__thread EvalContext* EvalContext::active=NULL;
+
+namespace {
+
+// protects the identifiers
+Mutex& id_lock() {
+	static Mutex lock;
+	return lock;
+}
+
+// identifiers of the deleted functions
+vector<int>& free_ids() {
+	static vector<int> ids;
+	return ids;
+}
+
+// identifier of the next function created (if no free identifier)
+int next_id=0;
+
+}
+
+EvalContext::EvalContext() : previous(current()) {
+	active=this;
+}
+
+EvalContext::~EvalContext() {
+	assert(current()==this);
+	active=previous;
+
+	for (vector<Slot>::iterator it=ws.begin(); it!=ws.end(); it++)
+		if (it->ws) delete it->ws;
+}
+
+FunctionWorkspace& EvalContext::workspace(const Function& f) {
+	if (f.id>=(int) ws.size()) ws.resize(f.id+1);
+	Slot& s=ws[f.id];
+	if (s.ws && s.serial!=f.serial) {
+		// workspace of a deleted function with the same identifier
+		delete s.ws;
+		s.ws=NULL;
+	}
+	if (!s.ws) {
+		s.ws=new FunctionWorkspace(f);
+		s.serial=f.serial;
+	}
+	return *s.ws;
+}
+
+int EvalContext::new_id() {
+	Lock lock(id_lock());
+	vector<int>& ids=free_ids();
+	if (ids.empty()) return next_id++;
+	int id=ids.back();
+	ids.pop_back();
+	return id;
+}
+
+void EvalContext::release_id(int id) {
+	Lock lock(id_lock());
+	free_ids().push_back(id);
+}
+
+} // end namespace ibex
@@ -0,0 +1,131 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_EvalContext.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+// Last Update : Oct 16, 2026
+//============================================================================
+
+#ifndef __IBEX_EVAL_CONTEXT_H__
+#define __IBEX_EVAL_CONTEXT_H__
+
+#include <vector>
+#include <cstddef>
+
+namespace ibex {
+
+class Function;
+class FunctionWorkspace;
+
+/**
+ * \ingroup function
+ *
+ * \brief Evaluation context of a thread.
+ *
+ * By default, the intermediate results of a function (domains,
+ * derivatives, etc.) are stored in the expression DAG, which is
+ * shared. So a function cannot be evaluated by two threads at the same time.
+ *
+ * An evaluation context holds a separate workspace (see #ibex::FunctionWorkspace)
+ * for each function evaluated by a thread. A context is active in the thread
+ * that has created it, until its destruction: all the algorithms run by this
+ * thread on functions (eval, gradient, backward, etc.) use the workspaces of the
+ * context. The workspace of a function is created the first time the function
+ * is used in the context.
+ *
+ * Hence, a function (and, e.g., a #ibex::System) can be shared by several threads,
+ * each thread having its own context:
+ *
+ * <pre>
+ *   void run() {  // code executed by each thread
+ *      EvalContext context;
+ *      Interval y=f.eval(box);
+ *      ...
+ *   }
+ * </pre>
+ *
+ * Contexts can be nested: the previous context of the thread is
+ * restored when a context is deleted.
+ *
+ * \warning The domains returned by reference (e.g., by #ibex::Function::eval_domain(const IntervalVector&))
+ * belong to the context and are valid until the context is deleted.
+ *
+ * \note Only the evaluation of functions is made re-entrant. Contractors and
+ * bisectors that have an internal state still have to be duplicated.
+ */
+class EvalContext {
+public:
+	/**
+	 * \brief Create a context and activate it for the calling thread.
+	 */
+	EvalContext();
+
+	/**
+	 * \brief Delete the context (and all its workspaces).
+	 *
+	 * Must be called by the thread that has created the context.
+	 */
+	~EvalContext();
+
+	/**
+	 * \brief The workspace of \a f in this context.
+	 */
+	FunctionWorkspace& workspace(const Function& f);
+
+	/**
+	 * \brief The active context of the calling thread.
+	 *
+	 * Return NULL if the thread has no context.
+	 */
+	static EvalContext* current();
+
+	/**
+	 * \brief Identifier of a new function.
+	 *
+	 * The workspaces of a context are indexed by function identifier.
+	 * The identifier of a deleted function (see #release_id(int)) is reused
+	 * by the next function created, so that the size of a context is bounded
+	 * by the number of functions alive at the same time.
+	 */
+	static int new_id();
+
+	/**
+	 * \brief Give back the identifier of a deleted function.
+	 *
+	 * The workspaces of the deleted function that remain in some contexts
+	 * are recognized (by the serial number of the function) and replaced
+	 * when the identifier is reused.
+	 */
+	static void release_id(int id);
+
+private:
+	EvalContext(const EvalContext&); // forbidden
+
+	/* The context of the thread before this one was created. */
+	EvalContext* previous;
+
+	/* Workspace of a function and serial number of this function. */
+	struct Slot {
+		Slot() : ws(NULL), serial(-1) { }
+		FunctionWorkspace* ws;
+		long serial;
+	};
+
+	/* Workspaces, indexed by function identifier. */
+	std::vector<Slot> ws;
+
+	/* The active context of each thread. */
+	static __thread EvalContext* active;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline EvalContext* EvalContext::current() {
+	return active;
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_EVAL_CONTEXT_H__
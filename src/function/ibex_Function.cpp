@@ -16,8 +16,11 @@
 #include "ibex_HC4Revise.h"
 #include "ibex_InHC4Revise.h"
 #include "ibex_Gradient.h"
+#include "ibex_Tape.h"
 #include "ibex_FunctionBuild.cpp_"
 
+#include <limits>
+
 using namespace std;
 
 namespace ibex {
@@ -39,6 +42,8 @@ Function::~Function() {
 
 	if (cf.code!=NULL) {
 
+		delete _workspace;
+
 		cleanup(expr(),false);
 
 		for (int i=0; i<nb_arg(); i++) {
@@ -46,6 +51,8 @@ Function::~Function() {
 		}
 	}
 
+	if (id>=0) EvalContext::release_id(id);
+
 	if (df!=NULL) delete df;
 
 	if (name!=NULL) // name==NULL if init/build_from_string was never called.
@@ -53,7 +60,46 @@ Function::~Function() {
 }
 
 Domain& Function::eval_domain(const IntervalVector& box) const {
-	return Eval().eval(*this,box);
+	return Eval().eval_root(*this,box);
+}
+
+void Function::eval_batch(const Array<const IntervalVector>& x, IntervalMatrix& y) const {
+	Eval().eval_batch(*this,x,y);
+}
+
+double Function::eval_point(const Vector& x) const {
+	assert(expr().dim.is_scalar());
+
+	if (!cf.tape) {
+		Interval y=eval(x);
+		// mid() of an unbounded interval is finite (+/-DBL_MAX)
+		return y.is_empty() || y.is_unbounded()? numeric_limits<double>::quiet_NaN() : y.mid();
+	}
+
+	double* r=workspace().point_regs;
+	cf.tape->load(x,r);
+	cf.tape->forward(r);
+	return r[cf.tape->root];
+}
+
+void Function::gradient_point(const Vector& x, Vector& g) const {
+	assert(expr().dim.is_scalar());
+	assert(g.size()==nb_var());
+
+	if (!cf.tape) {
+		IntervalVector gi=gradient(x);
+		if (gi.is_empty() || gi.is_unbounded())
+			for (int i=0; i<nb_var(); i++) g[i]=numeric_limits<double>::quiet_NaN();
+		else
+			g=gi.mid();
+		return;
+	}
+
+	FunctionWorkspace& w=workspace();
+	cf.tape->load(x,w.point_regs);
+	cf.tape->forward(w.point_regs);
+	cf.tape->gradient(w.point_regs,w.point_adj);
+	for (int i=0; i<nb_var(); i++) g[i]=w.point_adj[i];
 }
 
 
@@ -227,13 +273,45 @@ void Function::jacobian(const IntervalVector& x, IntervalMatrix& J) const {
 	assert(J.nb_cols()==nb_var());
 	assert(x.size()==nb_var());
 	assert(J.nb_rows()==image_dim());
-	assert(expr().deco.d);
-	assert(expr().deco.g);
+	assert(expr_label().d);
+	assert(expr_label().g);
+
+	Gradient().jacobian(*this,x,J);
+}
 
-	// calculate the gradient of each component of f
-	for (int i=0; i<image_dim(); i++) {
-		(*this)[i].gradient(x,J[i]);
+SparseIntervalMatrix Function::jacobian_structure() const {
+	assert(expr().dim.is_scalar() || expr().dim.is_vector());
+
+	int m=image_dim();
+	int* row_start=new int[m+1];
+	row_start[0]=0;
+	for (int i=0; i<m; i++)
+		row_start[i+1]=row_start[i]+(*this)[i].nb_used_vars();
+
+	int* col=new int[row_start[m]];
+	for (int i=0; i<m; i++) {
+		const Function& fi=(*this)[i];
+		// note: the used variables are in increasing order
+		for (int j=0; j<fi.nb_used_vars(); j++)
+			col[row_start[i]+j]=fi.used_var(j);
 	}
+
+	SparseIntervalMatrix J(m,nb_var(),row_start,col);
+	delete[] row_start;
+	delete[] col;
+	return J;
+}
+
+void Function::jacobian(const IntervalVector& x, SparseIntervalMatrix& J) const {
+	assert(x.size()==nb_var());
+	assert(J.nb_rows()==image_dim() && J.nb_cols()==nb_var());
+
+	Gradient().jacobian(*this,x,J);
+}
+
+void Function::hessian(const IntervalVector& x, IntervalMatrix& H) const {
+	assert(x.size()==nb_var());
+	Gradient().hessian(*this,x,H);
 }
 
 void Function::print(std::ostream& os) const {
@@ -16,8 +16,11 @@
 #include "ibex_Fnc.h"
 #include "ibex_CompiledFunction.h"
 #include "ibex_Decorator.h"
+#include "ibex_FunctionWorkspace.h"
+#include "ibex_EvalContext.h"
 #include "ibex_Array.h"
 #include "ibex_SymbolMap.h"
+#include "ibex_SparseIntervalMatrix.h"
 #include "ibex_ExprSubNodes.h"
 #include <stdarg.h>
 
@@ -46,6 +49,11 @@ class System;
  * output vector has 1 component. If f is a m*n matrix function,
  * the output vector has m*n components.
  *
+ * The intermediate results of the algorithms run on a function (evaluation,
+ * gradient, backward, etc.) are stored in a workspace (see #ibex::FunctionWorkspace).
+ * A function can be evaluated by several threads simultaneously if each thread
+ * has its own #ibex::EvalContext.
+ *
  *
  */
 class Function : public Fnc {
@@ -542,6 +550,25 @@ public:
 
 	// ======================== for Forward/Backward algorithms ====================
 
+	/**
+	 * \brief The workspace of the calling thread.
+	 *
+	 * This is the workspace of the active #ibex::EvalContext of the
+	 * thread, if any, and the default workspace otherwise
+	 * (the "deco" fields of the nodes).
+	 */
+	FunctionWorkspace& workspace() const;
+
+	/**
+	 * \brief The label of the ith node, in the workspace of the calling thread.
+	 */
+	ExprLabel& label(int i) const;
+
+	/**
+	 * \brief The label of the root node, in the workspace of the calling thread.
+	 */
+	ExprLabel& expr_label() const;
+
 	/**
 	 * \brief Initialize symbols domains from d
 	 *
@@ -626,6 +653,69 @@ public:
 	 */
 	Domain& eval_domain(const IntervalVector& box) const;
 
+	/**
+	 * \brief Calculate f(x[0]),...,f(x[n-1]) using interval arithmetic.
+	 *
+	 * The ith row of \a y is set to f(x[i]). The evaluation runs once over the
+	 * whole batch for each operator (see #ibex::Eval::eval_batch).
+	 *
+	 * \pre f must be real-valued or vector-valued and
+	 *      \a y must be a n x image_dim() matrix.
+	 */
+	void eval_batch(const Array<const IntervalVector>& x, IntervalMatrix& y) const;
+
+	/**
+	 * \brief Calculate f(x) in floating-point arithmetic.
+	 *
+	 * Faster than #eval(const IntervalVector&) const but not rigorous: to be used
+	 * where an approximation is enough (local search, heuristics).
+	 * Return NaN (or an infinite value) if x is outside the definition domain of f.
+	 *
+	 * If the function has no tape (see #ibex::Tape), return the midpoint of the
+	 * interval evaluation, or NaN if the latter is empty or unbounded.
+	 *
+	 * \pre f must be real-valued.
+	 */
+	double eval_point(const Vector& x) const;
+
+	/**
+	 * \brief Calculate the gradient of f at x in floating-point arithmetic.
+	 *
+	 * \see #eval_point(const Vector&) const.
+	 */
+	void gradient_point(const Vector& x, Vector& g) const;
+
+	/**
+	 * \brief Return a sparse matrix with the structure of the Jacobian matrix of f.
+	 *
+	 * The nonzero entries of the ith row are the variables used by the
+	 * ith component f[i] (see #used_var(int) const). They are all set to 0.
+	 *
+	 * \pre f must be real-valued or vector-valued.
+	 */
+	SparseIntervalMatrix jacobian_structure() const;
+
+	/**
+	 * \brief Calculate the Jacobian matrix of f in a sparse matrix.
+	 *
+	 * \pre J must have the structure returned by #jacobian_structure() const.
+	 * \see #ibex::Gradient::jacobian(const Function&, const IntervalVector&, SparseIntervalMatrix&) const.
+	 */
+	void jacobian(const IntervalVector& x, SparseIntervalMatrix& J) const;
+
+	/**
+	 * \brief Calculate the Hessian matrix of f on the box \a x.
+	 *
+	 * \pre f must be real-valued.
+	 * \see #ibex::Gradient::hessian(const Function&, const IntervalVector&, IntervalMatrix&) const.
+	 */
+	void hessian(const IntervalVector& x, IntervalMatrix& H) const;
+
+	/**
+	 * \brief Calculate the Hessian matrix of f on the box \a x.
+	 */
+	IntervalMatrix hessian(const IntervalVector& x) const;
+
 	/**
 	 * \brief Calculate f(box) using affine arithmetic.
 	 */
@@ -768,25 +858,26 @@ public:
 	 */
 	const char* name;
 
-	/*
-	 * \brief The domains of the arguments.
+	/**
+	 * \brief The domains of the arguments, in the workspace of the calling thread.
 	 *
+	 * Same as workspace().arg_domains (see #workspace()).
 	 */
-	mutable Array<Domain> arg_domains;
+	Array<Domain>& arg_domains() const;
 
-	/*
-	 * \brief The derivative label of the arguments.
+	/**
+	 * \brief The derivative labels of the arguments, in the workspace of the calling thread.
 	 *
-	 * \note The structure is initialized by #ibex::GradDecorator.
+	 * Same as workspace().arg_deriv (see #workspace()).
 	 */
-	mutable Array<Domain> arg_deriv;
+	Array<Domain>& arg_deriv() const;
 
-	/*
-	 * \brief The domains of the arguments.
+	/**
+	 * \brief The affine forms of the arguments, in the workspace of the calling thread.
 	 *
+	 * Same as workspace().arg_af2 (see #workspace()).
 	 */
-	mutable Array<Affine2Domain> arg_af2;
-
+	Array<Affine2Domain>& arg_af2() const;
 
 protected:
 	/**
@@ -802,6 +893,8 @@ protected:
 	void print_expr(std::ostream& os) const;
 
 private:
+	friend class EvalContext;
+
 	/**
 	 * \brief True if all the arguments are scalar
 	 *
@@ -833,6 +926,19 @@ private:
 	// we store the resulting function for future usage.
 	Function* df;
 
+	// generate df
+	void generate_diff() const;
+
+	// identifier of the function (for the evaluation contexts).
+	// The identifier of a deleted function is reused (see EvalContext::new_id()).
+	int id;
+
+	// serial number of the function, never reused
+	long serial;
+
+	// the default workspace (labels of the DAG)
+	FunctionWorkspace* _workspace;
+
 	// When the Jacobian matrix of the function is sparse, there may be a lot of
 	// zero functions appearing. To avoid memory blow-up, all the zero functions
 	// point to this field (instead of being a copy)
@@ -842,7 +948,8 @@ private:
 /*================================== inline implementations ========================================*/
 
 inline const Function& Function::diff() const {
-	return *(df ? df : (((Function*&) df) = new Function(*this,DIFF)));
+	if (!df) generate_diff();
+	return *df;
 }
 
 inline Function& Function::operator[](int i) {
@@ -889,12 +996,37 @@ inline const ExprNode& Function::expr() const {
 
 template<class V>
 inline ExprLabel& Function::forward(const V& algo) const {
-	return cf.forward<V>(algo);
+	return cf.forward<V>(algo,workspace().args);
 }
 
 template<class V>
 inline void Function::backward(const V& algo) const {
-	cf.backward<V>(algo);
+	cf.backward<V>(algo,workspace().args);
+}
+
+inline FunctionWorkspace& Function::workspace() const {
+	EvalContext* c=EvalContext::current();
+	return c ? c->workspace(*this) : *_workspace;
+}
+
+inline Array<Domain>& Function::arg_domains() const {
+	return workspace().arg_domains;
+}
+
+inline Array<Domain>& Function::arg_deriv() const {
+	return workspace().arg_deriv;
+}
+
+inline Array<Affine2Domain>& Function::arg_af2() const {
+	return workspace().arg_af2;
+}
+
+inline ExprLabel& Function::label(int i) const {
+	return workspace().label(i);
+}
+
+inline ExprLabel& Function::expr_label() const {
+	return workspace().label(0);
 }
 
 inline bool Function::all_args_scalar() const {
@@ -903,94 +1035,103 @@ inline bool Function::all_args_scalar() const {
 
 inline void Function::write_arg_domains(const Array<Domain>& d, bool grad) const {
 	if (_nb_used_vars==-1) this->generate_used_vars();
-	load(grad? arg_deriv : arg_domains,d,nb_used_vars(),_used_var);
+	FunctionWorkspace& w=workspace();
+	load(grad? w.arg_deriv : w.arg_domains,d,nb_used_vars(),_used_var);
 }
 
 inline void Function::write_arg_domains(const Array<const Domain>& d, bool grad) const {
 	if (_nb_used_vars==-1) this->generate_used_vars();
-	load(grad? arg_deriv : arg_domains,d,nb_used_vars(),_used_var);
+	FunctionWorkspace& w=workspace();
+	load(grad? w.arg_deriv : w.arg_domains,d,nb_used_vars(),_used_var);
 }
 
 inline void Function::write_arg_domains(const IntervalVector& box, bool grad) const {
 	if (_nb_used_vars==-1) this->generate_used_vars();
+	FunctionWorkspace& w=workspace();
 
 	if (all_args_scalar()) {
 		int j;
 		if (grad)
 			for (int i=0; i<nb_used_vars(); i++) {
 				j=used_var(i);
-				arg_deriv[j].i()=box[j];
+				w.arg_deriv[j].i()=box[j];
 			}
 		else
 			for (int i=0; i<nb_used_vars(); i++) {
 				j=used_var(i);
-				arg_domains[j].i()=box[j];
+				w.arg_domains[j].i()=box[j];
 			}
 	}
 	else
-		load(grad? arg_deriv : arg_domains, box, nb_used_vars(), _used_var);
+		load(grad? w.arg_deriv : w.arg_domains, box, nb_used_vars(), _used_var);
 }
 
 inline void Function::write_arg_af2_domains(const Array<Affine2Domain>& d) const {
 	if (_nb_used_vars==-1) this->generate_used_vars();
-	load(arg_af2,d,nb_used_vars(),_used_var);
+	FunctionWorkspace& w=workspace();
+	load(w.arg_af2,d,nb_used_vars(),_used_var);
 }
 
 inline void Function::write_arg_af2_domains(const Array<const Affine2Domain>& d) const {
 	if (_nb_used_vars==-1) this->generate_used_vars();
-	load(arg_af2,d,nb_used_vars(),_used_var);
+	FunctionWorkspace& w=workspace();
+	load(w.arg_af2,d,nb_used_vars(),_used_var);
 }
 
 inline void Function::write_arg_af2_domains(const IntervalVector& box) const {
 	if (_nb_used_vars==-1) this->generate_used_vars();
+	FunctionWorkspace& w=workspace();
 	if (all_args_scalar()) {
 		int j;
 		for (int i=0; i<nb_used_vars(); i++) {
 			j=used_var(i);
-			arg_af2[j].i()=Affine2(nb_var(),j+1,box[j]);
+			w.arg_af2[j].i()=Affine2(nb_var(),j+1,box[j]);
 		}
 	}
 	else
-		load(arg_af2,Affine2Vector(box,true),nb_used_vars(),_used_var);
+		load(w.arg_af2,Affine2Vector(box,true),nb_used_vars(),_used_var);
 }
 
 inline void Function::write_arg_af2_domains(const Affine2Vector& box) const {
 	if (_nb_used_vars==-1) this->generate_used_vars();
+	FunctionWorkspace& w=workspace();
 	if (all_args_scalar()) {
 		int j;
 		for (int i=0; i<nb_used_vars(); i++) {
 			j=used_var(i);
-			arg_af2[j].i()=box[j];
+			w.arg_af2[j].i()=box[j];
 		}
 	}
 	else
-		load(arg_af2,box,nb_used_vars(),_used_var);
+		load(w.arg_af2,box,nb_used_vars(),_used_var);
 }
 
 
 
 inline void Function::read_arg_domains(Array<Domain>& d, bool grad) const {
 	if (_nb_used_vars==-1) this->generate_used_vars();
-	load(d,grad? arg_deriv : arg_domains,nb_used_vars(),_used_var);
+	FunctionWorkspace& w=workspace();
+	load(d,grad? w.arg_deriv : w.arg_domains,nb_used_vars(),_used_var);
 }
 
 inline void Function::read_arg_domains(IntervalVector& box, bool grad) const {
 	if (_nb_used_vars==-1) this->generate_used_vars();
+	FunctionWorkspace& w=workspace();
 	if (all_args_scalar()) {
 		int j;
 		if (grad)
 			for (int i=0; i<nb_used_vars(); i++) {
 				j=used_var(i);
-				box[j]=arg_deriv[j].i();
+				box[j]=w.arg_deriv[j].i();
 			}
 		else
 			for (int i=0; i<nb_used_vars(); i++) {
 				j=used_var(i);
-				box[j]=arg_domains[j].i();
+				box[j]=w.arg_domains[j].i();
 			}
 	}
 	else {
-		load(box,grad? arg_deriv : arg_domains, nb_used_vars(), _used_var);
+		load(box,grad? w.arg_deriv : w.arg_domains, nb_used_vars(), _used_var);
 	}
 }
 
@@ -1048,6 +1189,12 @@ inline void Function::ibwd(const Interval& y, IntervalVector& x, const IntervalV
 	ibwd(Domain((Interval&) y),x,xin);
 }
 
+inline IntervalMatrix Function::hessian(const IntervalVector& x) const {
+	IntervalMatrix H(nb_var(),nb_var());
+	hessian(x,H);
+	return H;
+}
+
 // ========== never understood why we have to do this in c++ =================
 inline IntervalVector Function::gradient(const IntervalVector& x) const {
 	return Fnc::gradient(x);
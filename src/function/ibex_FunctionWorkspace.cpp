@@ -0,0 +1,126 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_FunctionWorkspace.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+// Last Update : Oct 16, 2026
+//============================================================================
+
+#include "ibex_FunctionWorkspace.h"
+#include "ibex_Function.h"
+#include "ibex_Decorator.h"
+#include "ibex_Tape.h"
+
+#include <map>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/*
+ * Decorates labels created on demand instead of the "deco" fields.
+ */
+class NewLabelDecorator : public Decorator {
+public:
+	ExprLabel& label(const ExprNode& e) {
+		if (!labels.found(e)) labels.insert(e, new ExprLabel());
+		return *labels[e];
+	}
+
+	NodeMap<ExprLabel*> labels;
+};
+
+}
+
+FunctionWorkspace::FunctionWorkspace(const Function& f) {
+	NewLabelDecorator d;
+	d.decorate(f.args(),f.expr());
+	init(f,d);
+
+	for (IBEX_NODE_MAP(ExprLabel*)::iterator it=d.labels.begin(); it!=d.labels.end(); it++)
+		own.push_back(it->second);
+}
+
+FunctionWorkspace::FunctionWorkspace(const Function& f, Decorator& d) {
+	init(f,d);
+}
+
+void FunctionWorkspace::init(const Function& f, Decorator& d) {
+	const CompiledFunction& cf=f.cf;
+
+	n=f.nb_nodes();
+	labels=new ExprLabel*[n];
+
+	// default label (the "deco" field) -> label in *this
+	map<const ExprLabel*, ExprLabel*> lmap;
+
+	for (int i=0; i<n; i++) {
+		labels[i]=&d.label(f.node(i));
+		labels[i]->f=(Function*) &f;
+		lmap[&f.node(i).deco]=labels[i];
+	}
+
+	args=new ExprLabel**[n];
+	for (int i=0; i<n; i++) {
+		args[i]=new ExprLabel*[cf.nb_args[i]+1];
+		for (int j=0; j<=cf.nb_args[i]; j++) {
+			assert(lmap.find(cf.args[i][j])!=lmap.end());
+			args[i][j]=lmap[cf.args[i][j]];
+		}
+	}
+
+	arg_domains.resize(f.nb_arg());
+	arg_deriv.resize(f.nb_arg());
+	arg_af2.resize(f.nb_arg());
+
+	for (int i=0; i<f.nb_arg(); i++) {
+		// the symbol may not appear in the expression
+		ExprLabel& l=d.label(f.arg(i));
+		l.f=(Function*) &f;
+		arg_domains.set_ref(i,*l.d);
+		arg_deriv.set_ref(i,*l.g);
+		arg_af2.set_ref(i,*l.af2);
+	}
+
+	if (cf.tape) {
+		regs=new Interval[cf.tape->nb_regs];
+		adj=new Interval[cf.tape->nb_regs];
+		point_regs=new double[cf.tape->nb_regs];
+		point_adj=new double[cf.tape->nb_regs];
+		fwd=new Interval[cf.tape->nb_regs];
+		dirty=new bool[cf.tape->nb_regs];
+		for (int i=0; i<cf.tape->nb_regs; i++) dirty[i]=false;
+	} else {
+		regs=NULL;
+		adj=NULL;
+		point_regs=NULL;
+		point_adj=NULL;
+		fwd=NULL;
+		dirty=NULL;
+	}
+	fwd_valid=false;
+}
+
+FunctionWorkspace::~FunctionWorkspace() {
+	for (int i=0; i<n; i++) delete[] args[i];
+	delete[] args;
+	delete[] labels;
+
+	if (regs) {
+		delete[] regs;
+		delete[] adj;
+		delete[] point_regs;
+		delete[] point_adj;
+		delete[] fwd;
+		delete[] dirty;
+	}
+
+	for (vector<ExprLabel*>::iterator it=own.begin(); it!=own.end(); it++)
+		delete *it;
+}
+
+} // end namespace ibex
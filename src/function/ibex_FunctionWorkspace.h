@@ -0,0 +1,149 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_FunctionWorkspace.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+// Last Update : Oct 16, 2026
+//============================================================================
+
+#ifndef __IBEX_FUNCTION_WORKSPACE_H__
+#define __IBEX_FUNCTION_WORKSPACE_H__
+
+#include "ibex_ExprLabel.h"
+#include "ibex_Interval.h"
+#include "ibex_Array.h"
+
+#include <vector>
+
+namespace ibex {
+
+class Function;
+class Decorator;
+
+/**
+ * \ingroup function
+ *
+ * \brief Labels of a function.
+ *
+ * The forward/backward algorithms (#ibex::Eval, #ibex::Gradient,
+ * #ibex::HC4Revise, etc.) store the intermediate results in the
+ * labels of the nodes (see #ibex::ExprLabel). A workspace is a
+ * complete set of labels for a function.
+ *
+ * Each function has a default workspace, made of the #ibex::Expr::deco
+ * fields of its nodes. Other workspaces are created by #ibex::EvalContext,
+ * so that the same function can be evaluated by several threads
+ * simultaneously.
+ */
+class FunctionWorkspace {
+public:
+	/**
+	 * \brief Create a new workspace for \a f.
+	 *
+	 * The labels are initialized in the same way as the default
+	 * ones (see #ibex::Decorator) but do not share any domain with them.
+	 */
+	FunctionWorkspace(const Function& f);
+
+	/**
+	 * \brief Delete *this.
+	 */
+	~FunctionWorkspace();
+
+	/**
+	 * \brief Label of the ith node of the function.
+	 *
+	 * \see #ibex::Function::node(int).
+	 */
+	ExprLabel& label(int i) const;
+
+	/**
+	 * \brief The domains of the arguments.
+	 */
+	Array<Domain> arg_domains;
+
+	/**
+	 * \brief The derivative label of the arguments.
+	 */
+	Array<Domain> arg_deriv;
+
+	/**
+	 * \brief The affine forms of the arguments.
+	 */
+	Array<Affine2Domain> arg_af2;
+
+	/**
+	 * \brief Labels of the node and its arguments, for each node.
+	 *
+	 * Same structure as in #ibex::CompiledFunction.
+	 */
+	ExprLabel*** args;
+
+	/**
+	 * \brief Registers of the tape.
+	 *
+	 * NULL if the function has no tape (see #ibex::Tape).
+	 */
+	Interval* regs;
+
+	/**
+	 * \brief Adjoints of the registers (for the gradient).
+	 */
+	Interval* adj;
+
+	/**
+	 * \brief Registers of the tape for the point evaluation.
+	 */
+	double* point_regs;
+
+	/**
+	 * \brief Adjoints of the point registers (for the point gradient).
+	 */
+	double* point_adj;
+
+	/**
+	 * \brief Result of the last forward evaluation of HC4Revise (registers of the tape).
+	 *
+	 * Used for the incremental forward evaluation (see #ibex::Tape::forward(Interval*, bool*) const).
+	 */
+	Interval* fwd;
+
+	/**
+	 * \brief Dirty registers (for the incremental forward evaluation).
+	 */
+	bool* dirty;
+
+	/**
+	 * \brief True if #fwd contains the result of a forward evaluation.
+	 */
+	bool fwd_valid;
+
+private:
+	friend class Function;
+
+	/*
+	 * Create a workspace with the labels of the decorator \a d
+	 * (\a f must be decorated by \a d).
+	 */
+	FunctionWorkspace(const Function& f, Decorator& d);
+
+	void init(const Function& f, Decorator& d);
+
+	FunctionWorkspace(const FunctionWorkspace&); // forbidden
+
+	int n;                    // number of nodes
+	ExprLabel** labels;       // labels of the nodes
+	std::vector<ExprLabel*> own; // labels allocated by *this
+};
+
+/*================================== inline implementations ========================================*/
+
+inline ExprLabel& FunctionWorkspace::label(int i) const {
+	return *labels[i];
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_FUNCTION_WORKSPACE_H__
@@ -11,13 +11,14 @@
 
 #include "ibex_Gradient.h"
 #include "ibex_Eval.h"
+#include "ibex_Tape.h"
 
 namespace ibex {
 
 void Gradient::gradient(const Function& f, const Array<Domain>& d, IntervalVector& g) const {
 	assert(f.expr().dim.is_scalar());
-	assert(f.expr().deco.d);
-	assert(f.expr().deco.g);
+	assert(f.expr_label().d);
+	assert(f.expr_label().g);
 
 	Eval().eval(f,d);
 
@@ -32,7 +33,7 @@ void Gradient::gradient(const Function& f, const Array<Domain>& d, IntervalVecto
 		return;
 	}
 
-	f.expr().deco.g->i()=1.0;
+	f.expr_label().g->i()=1.0;
 
 	f.backward<Gradient>(*this);
 
@@ -41,10 +42,15 @@ void Gradient::gradient(const Function& f, const Array<Domain>& d, IntervalVecto
 
 void Gradient::gradient(const Function& f, const IntervalVector& box, IntervalVector& g) const {
 	assert(f.expr().dim.is_scalar());
-	assert(f.expr().deco.d);
-	assert(f.expr().deco.g);
+	assert(f.expr_label().d);
+	assert(f.expr_label().g);
 
-	f.eval_domain(box);
+	if (f.cf.tape) {
+		gradient(*f.cf.tape,f.workspace(),box,g);
+		return;
+	}
+
+	Eval().eval(f,box);
 
 	g.clear();
 
@@ -57,7 +63,7 @@ void Gradient::gradient(const Function& f, const IntervalVector& box, IntervalVe
 		return;
 	}
 
-	f.expr().deco.g->i()=1.0;
+	f.expr_label().g->i()=1.0;
 
 	f.backward<Gradient>(*this);
 
@@ -65,10 +71,23 @@ void Gradient::gradient(const Function& f, const IntervalVector& box, IntervalVe
 }
 
 
+void Gradient::gradient(const Tape& tape, FunctionWorkspace& w, const IntervalVector& box, IntervalVector& g) const {
+	tape.load(box,w.regs);
+
+	if (!tape.forward(w.regs)) {
+		g.set_empty();
+		return;
+	}
+
+	tape.gradient(w.regs,w.adj);
+
+	tape.read(w.adj,g);
+}
+
 void Gradient::jacobian(const Function& f, const Array<Domain>& d, IntervalMatrix& J) const {
 	assert(f.expr().dim.is_vector());
-	assert(f.expr().deco.d);
-	assert(f.expr().deco.g);
+	assert(f.expr_label().d);
+	assert(f.expr_label().g);
 
 	int m=f.expr().dim.vec_size();
 
@@ -92,6 +111,76 @@ void Gradient::jacobian(const Function& f, const Array<Domain>& d, IntervalMatri
 	}
 }
 
+void Gradient::jacobian(const Function& f, const IntervalVector& box, IntervalMatrix& J) const {
+	assert(J.nb_rows()==f.image_dim() && J.nb_cols()==f.nb_var());
+
+	// note: if the evaluation of a component is empty, the gradients
+	// of the other ones are calculated separately.
+	if (f.cf.tape && jacobian(*f.cf.tape,f.workspace(),box,J))
+		return;
+
+	// calculate the gradient of each component of f
+	for (int i=0; i<f.image_dim(); i++) {
+		f[i].gradient(box,J[i]);
+	}
+}
+
+bool Gradient::jacobian(const Tape& tape, FunctionWorkspace& w, const IntervalVector& box, IntervalMatrix& J) const {
+	tape.load(box,w.regs);
+
+	if (!tape.forward(w.regs)) return false;
+
+	tape.jacobian(w.regs,w.adj,J);
+	return true;
+}
+
+void Gradient::jacobian(const Function& f, const IntervalVector& box, SparseIntervalMatrix& J) const {
+	assert(J.nb_rows()==f.image_dim() && J.nb_cols()==f.nb_var());
+
+	if (f.cf.tape) {
+		FunctionWorkspace& w=f.workspace();
+		f.cf.tape->load(box,w.regs);
+
+		if (f.cf.tape->forward(w.regs)) {
+			f.cf.tape->jacobian(w.regs,w.adj,J);
+			return;
+		}
+		// otherwise, the gradients are calculated separately (see below)
+	}
+
+	IntervalVector g(f.nb_var());
+
+	for (int i=0; i<f.image_dim(); i++) {
+		f[i].gradient(box,g);
+		if (g.is_empty()) {
+			J.set_empty();
+			return;
+		}
+		for (int l=J.row_start(i); l<J.row_start(i+1); l++)
+			J.val(l)=g[J.col(l)];
+	}
+}
+
+void Gradient::hessian(const Function& f, const IntervalVector& box, IntervalMatrix& H) const {
+	assert(f.expr().dim.is_scalar());
+	assert(H.nb_rows()==f.nb_var() && H.nb_cols()==f.nb_var());
+
+	if (!f.cf.tape) {
+		f.diff().jacobian(box,H);
+		return;
+	}
+
+	FunctionWorkspace& w=f.workspace();
+	f.cf.tape->load(box,w.regs);
+
+	if (!f.cf.tape->forward(w.regs)) {
+		H.set_empty();
+		return;
+	}
+
+	f.cf.tape->hessian(w.regs,w.adj,H);
+}
+
 void Gradient::vector_fwd(const ExprVector& v, const ExprLabel** x, ExprLabel& y) {
 	if (v.dim.is_vector())
 		y.g->v().clear();
@@ -187,11 +276,11 @@ void Gradient::max_bwd(const ExprMax&, ExprLabel& x1, ExprLabel& x2, const ExprL
 void Gradient::min_bwd(const ExprMin&, ExprLabel& x1, ExprLabel& x2, const ExprLabel& y) {
 	Interval gx1,gx2;
 
-	if (x1.d->i().lb() < x2.d->i().ub()) {
+	if (x1.d->i().ub() < x2.d->i().lb()) {
 		gx1=Interval::ONE;
 		gx2=Interval::ZERO;
 	}
-	else if (x2.d->i().lb() < x1.d->i().ub()) {
+	else if (x2.d->i().ub() < x1.d->i().lb()) {
 		gx1=Interval::ZERO;
 		gx2=Interval::ONE;
 	} else {
@@ -17,6 +17,8 @@
 
 namespace ibex {
 
+class Tape;
+
 /**
  * \ingroup symbolic
  * \brief Calculates the gradient of a function.
@@ -39,6 +41,33 @@ public:
 	 */
 	void jacobian(const Function& f, const Array<Domain>& d, IntervalMatrix& J) const;
 
+	/**
+	 * \brief Calculate the Jacobian on the box \a box and store the result in \a J.
+	 *
+	 * If f has a tape, the forward evaluation is shared by all the components
+	 * (see #ibex::Tape::jacobian(const Interval*, Interval*, IntervalMatrix&) const).
+	 * Otherwise, the gradient of each component is calculated separately.
+	 */
+	void jacobian(const Function& f, const IntervalVector& box, IntervalMatrix& J) const;
+
+	/**
+	 * \brief Calculate the Jacobian on the box \a box and store the result in the sparse matrix \a J.
+	 *
+	 * Only the nonzero entries of J are calculated
+	 * (see #ibex::Tape::jacobian(const Interval*, Interval*, SparseIntervalMatrix&) const).
+	 * J is set to the empty matrix if a component is not defined on \a box.
+	 */
+	void jacobian(const Function& f, const IntervalVector& box, SparseIntervalMatrix& J) const;
+
+	/**
+	 * \brief Calculate the Hessian matrix of a real-valued function on the box \a box.
+	 *
+	 * If f has a tape, the Hessian is calculated in forward-over-reverse mode
+	 * (see #ibex::Tape::hessian(const Interval*, Interval*, IntervalMatrix&) const).
+	 * Otherwise, this is the Jacobian of the symbolic gradient of f.
+	 */
+	void hessian(const Function& f, const IntervalVector& box, IntervalMatrix& H) const;
+
 	inline void index_fwd(const ExprIndex& , const ExprLabel& , ExprLabel& ) { /* nothing to do */ }
 	       void vector_fwd(const ExprVector& v, const ExprLabel** s, ExprLabel& y);
 	       void cst_fwd(const ExprConstant&, ExprLabel& y)                                  { y.g->clear(); }
@@ -134,6 +163,18 @@ public:
 	inline void mul_VM_bwd(const ExprMul&, ExprLabel& x1, ExprLabel& x2,    const ExprLabel& y) { x1.g->v() += x2.d->m()*y.g->v(); x2.g->m() += outer_product(x1.d->v(),y.g->v()); }
 	inline void sub_V_bwd (const ExprSub&, ExprLabel& x1, ExprLabel& x2,    const ExprLabel& y) { x1.g->v() += y.g->v(); x2.g->v() -= y.g->v(); }
 	inline void sub_M_bwd (const ExprSub&, ExprLabel& x1, ExprLabel& x2,    const ExprLabel& y) { x1.g->m() += y.g->m(); x2.g->m() -= y.g->m(); }
+
+protected:
+	/*
+	 * Calculate the gradient over the tape of a function (with the registers of the workspace \a w).
+	 */
+	void gradient(const Tape& tape, FunctionWorkspace& w, const IntervalVector& box, IntervalVector& g) const;
+
+	/*
+	 * Calculate the Jacobian over the tape of a function (with the registers of the workspace \a w).
+	 * Return false if the evaluation is empty (J is not modified).
+	 */
+	bool jacobian(const Tape& tape, FunctionWorkspace& w, const IntervalVector& box, IntervalMatrix& J) const;
 };
 
 } // namespace ibex
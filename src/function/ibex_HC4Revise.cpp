@@ -11,6 +11,7 @@
 #include "ibex_HC4Revise.h"
 #include "ibex_Eval.h"
 #include "ibex_Affine2Eval.h"
+#include "ibex_Tape.h"
 
 namespace ibex {
 
@@ -33,36 +34,83 @@ HC4Revise::HC4Revise(FwdMode mode) : fwd_mode(mode) {
 #define EVAL(f,x) if (fwd_mode==INTERVAL_MODE) Eval().eval(f,x); else Affine2Eval().eval(f,x);
 
 bool HC4Revise::proj(const Function& f, const Domain& y, IntervalVector& x) {
-	EVAL(f,x);
+	bool inactive=try_proj(f,y,x);
+	if (x.is_empty()) throw EmptyBoxException();
+	return inactive;
+}
+
+bool HC4Revise::try_proj(const Function& f, const Domain& y, IntervalVector& x) {
+	if (fwd_mode==INTERVAL_MODE && f.cf.tape)
+		return try_proj(*f.cf.tape,f.workspace(),y,x);
+
+	try {
+		EVAL(f,x);
+
+		//std::cout << "forward:" << std::endl; f.cf.print();
+
+		Domain& root=*f.expr_label().d;
+
+		if (root.is_empty()) { x.set_empty(); return false; }
+
+		switch(y.dim.type()) {
+		case Dim::SCALAR:       if (root.i().is_subset(y.i())) return true; break;
+		case Dim::ROW_VECTOR:
+		case Dim::COL_VECTOR:   if (root.v().is_subset(y.v())) return true; break;
+		case Dim::MATRIX:       if (root.m().is_subset(y.m())) return true; break;
+		case Dim::MATRIX_ARRAY: assert(false); /* impossible */ break;
+		}
+
+		root &= y;
 
-	//std::cout << "forward:" << std::endl; f.cf.print();
+		f.backward<HC4Revise>(*this);
 
-	Domain& root=*f.expr().deco.d;
+		//std::cout << "backward:" << std::endl; f.cf.print();
 
-	if (root.is_empty()) { x.set_empty(); throw EmptyBoxException(); }
+		f.read_arg_domains(x);
 
-	switch(y.dim.type()) {
-	case Dim::SCALAR:       if (root.i().is_subset(y.i())) return true; break;
-	case Dim::ROW_VECTOR:
-	case Dim::COL_VECTOR:   if (root.v().is_subset(y.v())) return true; break;
-	case Dim::MATRIX:       if (root.m().is_subset(y.m())) return true; break;
-	case Dim::MATRIX_ARRAY: assert(false); /* impossible */ break;
+	} catch(EmptyBoxException&) {
+		x.set_empty();
 	}
 
-	root &= y;
+	return false;
+}
 
-	f.backward<HC4Revise>(*this);
+bool HC4Revise::try_proj(const Tape& tape, FunctionWorkspace& w, const Domain& y, IntervalVector& x) {
+	Interval* r=w.regs;
+
+	// Incremental forward evaluation: only the nodes that depend on
+	// a variable whose domain has changed since the last call are
+	// recalculated (the other ones are in w.fwd).
+	bool ok;
+	if (w.fwd_valid) {
+		for (int i=0; i<tape.nb_var; i++) {
+			w.dirty[i]=(w.fwd[i]!=x[i]);
+			if (w.dirty[i]) w.fwd[i]=x[i];
+		}
+		ok=tape.forward(w.fwd,w.dirty);
+	} else {
+		tape.load(x,w.fwd);
+		ok=tape.forward(w.fwd);
+	}
+
+	w.fwd_valid=ok;
+
+	if (!ok) { x.set_empty(); return false; }
+
+	for (int i=0; i<tape.nb_regs; i++) r[i]=w.fwd[i];
+
+	if (tape.root_subset(r,y)) return true;
 
-	//std::cout << "backward:" << std::endl; f.cf.print();
+	if (!tape.root_inter(r,y) || !tape.backward(r)) { x.set_empty(); return false; }
 
-	f.read_arg_domains(x);
+	tape.read(r,x);
 
 	return false;
 }
 
 void HC4Revise::proj(const Function& f, const Domain& y, ExprLabel** x) {
 	EVAL(f,x);
-	*f.expr().deco.d &= y;
+	*f.expr_label().d &= y;
 
 	// if next instruction throws an EmptyBoxException,
 	// it will be caught by proj(...,IntervalVector& x).
@@ -16,6 +16,8 @@
 
 namespace ibex {
 
+class Tape;
+
 typedef enum { INTERVAL_MODE, AFFINE2_MODE, AFFINE_MODE } FwdMode;
 
 /**
@@ -47,6 +49,16 @@ public:
 	 */
 	bool proj(const Function& f, const Domain& y, IntervalVector& x);
 
+	/**
+	 * \brief Project f(x)=y onto x, without exception.
+	 *
+	 * Same as #proj(const Function&, const Domain&, IntervalVector&) except that
+	 * an empty projection is not signaled by an EmptyBoxException: x is simply set
+	 * to the empty set (and false is returned). If the function is taped, no
+	 * exception is raised at all, which saves the cost of stack unwinding.
+	 */
+	bool try_proj(const Function& f, const Domain& y, IntervalVector& x);
+
 	/**
 	 * \brief Ratio for the contraction of a
 	 * matrix-vector / matrix-matrix multiplication.
@@ -102,6 +114,11 @@ public:
 
 protected:
 	void proj(const Function& f, const Domain& y, ExprLabel** x);
+
+	/*
+	 * Same as try_proj(f,y,x) but over the tape of the function (with the registers of the workspace \a w).
+	 */
+	bool try_proj(const Tape& tape, FunctionWorkspace& w, const Domain& y, IntervalVector& x);
 	FwdMode fwd_mode;
 };
 
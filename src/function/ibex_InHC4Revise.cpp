@@ -16,11 +16,11 @@ namespace ibex {
 void InHC4Revise::ibwd(const Function& f, const Domain& y, IntervalVector& x) {
 
 	for (int i=0; i<f.nb_nodes(); i++)
-		f.node(i).deco.p->set_empty();
+		f.label(i).p->set_empty();
 
 	Eval().eval(f,x);
 
-	*f.expr().deco.d = y;
+	*f.expr_label().d = y;
 
 	try {
 		f.backward<InHC4Revise>(*this);
@@ -39,21 +39,21 @@ void InHC4Revise::ibwd(const Function& f, const Domain& y, IntervalVector& x, co
 	if (!xin.is_empty()) {
 		e.eval(f,xin);
 
-		assert(!f.expr().deco.d->is_empty());
+		assert(!f.expr_label().d->is_empty());
 
 		for (int i=0; i<f.nb_nodes(); i++)
-			*f.node(i).deco.p = *f.node(i).deco.d;
+			*f.label(i).p = *f.label(i).d;
 	}
 	else {
 		for (int i=0; i<f.nb_nodes(); i++)
-			f.node(i).deco.p->set_empty();
+			f.label(i).p->set_empty();
 	}
 
 	e.eval(f,x);
 
-	assert(!f.expr().deco.d->is_empty());
+	assert(!f.expr_label().d->is_empty());
 
-	*f.expr().deco.d = y;
+	*f.expr_label().d = y;
 
 	try {
 
@@ -80,21 +80,21 @@ bool InHC4Revise::ibwd(const Function& f, const Domain& y, ExprLabel** x) {
 	if (!argP[0].is_empty()) { // if the first domain is empty, so they all are
 		e.eval(f,argP);
 
-		assert(!f.expr().deco.d->is_empty());
+		assert(!f.expr_label().d->is_empty());
 
 		for (int i=0; i<f.nb_nodes(); i++)
-			*f.node(i).deco.p = *f.node(i).deco.d;
+			*f.label(i).p = *f.label(i).d;
 	}
 	else {
 		for (int i=0; i<f.nb_nodes(); i++)
-			f.node(i).deco.p->set_empty();
+			f.label(i).p->set_empty();
 	}
 
 	e.eval(f,x);
 
-	assert(!f.expr().deco.d->is_empty());
+	assert(!f.expr_label().d->is_empty());
 
-	*f.expr().deco.d = y;
+	*f.expr_label().d = y;
 
 	Array<Domain> argD(f.nb_arg());
 
@@ -0,0 +1,43 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_NativeCodeException.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+// Last Update : Oct 16, 2026
+//============================================================================
+
+#ifndef __IBEX_NATIVE_CODE_EXCEPTION_H__
+#define __IBEX_NATIVE_CODE_EXCEPTION_H__
+
+#include "ibex_Exception.h"
+
+#include <string>
+
+namespace ibex {
+
+/**
+ * \ingroup function
+ *
+ * \brief Thrown when the native code of a function cannot be generated,
+ * compiled or loaded.
+ *
+ * \see #ibex::NativeFunction.
+ */
+class NativeCodeException : public Exception {
+public:
+
+	NativeCodeException(const std::string& message1) : msg(message1) { }
+
+	/** \brief Get the message of this exception
+	 */
+	std::string message() { return msg; }
+
+private:
+	std::string msg;
+};
+
+} // end namespace ibex
+
+#endif // __IBEX_NATIVE_CODE_EXCEPTION_H__
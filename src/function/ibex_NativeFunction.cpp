@@ -0,0 +1,275 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_NativeFunction.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+// Last Update : Oct 16, 2026
+//============================================================================
+
+#include "ibex_NativeFunction.h"
+#include "ibex_Tape.h"
+#include "ibex_Setting.h"
+
+#include <sstream>
+#include <vector>
+#include <cstdlib>
+#include <cstdio>
+#include <cerrno>
+#include <dlfcn.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#ifndef _IBEX_NATIVE_CXX_
+#define _IBEX_NATIVE_CXX_ "c++ -O2 -fPIC -shared -frounding-math"
+#endif
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+const Tape& tape_of(const Function& f) {
+	if (!f.cf.tape) throw NativeCodeException("the function cannot be taped (see Tape::supported)");
+	return *f.cf.tape;
+}
+
+// FNV-1a hash (64 bits) in hexadecimal
+string hash(const string& s) {
+	unsigned long long h=14695981039346656037ULL;
+	for (size_t i=0; i<s.size(); i++) {
+		h^=(unsigned char) s[i];
+		h*=1099511628211ULL;
+	}
+	ostringstream os;
+	os << hex;
+	os.width(16);
+	os.fill('0');
+	os << h;
+	return os.str();
+}
+
+// owned by the user and not writable by the group or the others
+bool is_private(const struct stat& st) {
+	return st.st_uid==geteuid() && (st.st_mode & (S_IWGRP | S_IWOTH))==0;
+}
+
+void make_dir(const string& dir) {
+	if (mkdir(dir.c_str(),0700)!=0 && errno!=EEXIST)
+		throw NativeCodeException("cannot create the directory "+dir);
+}
+
+void check_dir(const string& dir) {
+	struct stat st;
+	if (stat(dir.c_str(),&st)!=0 || !S_ISDIR(st.st_mode))
+		throw NativeCodeException("cannot access the directory "+dir);
+	if (!is_private(st))
+		throw NativeCodeException("unsafe cache directory "+dir+" (must be owned by the user and not writable by the others)");
+}
+
+// quote a path for the shell
+string quote(const string& path) {
+	string q="'";
+	for (size_t i=0; i<path.size(); i++)
+		if (path[i]=='\'') q+="'\\''";
+		else q+=path[i];
+	return q+"'";
+}
+
+// write the code in a new file (never an existing one) and return its name
+string write_source(const string& name, const string& code) {
+	string tmpl=name+".XXXXXX.cpp";
+	vector<char> src(tmpl.begin(),tmpl.end());
+	src.push_back('\0');
+
+	int fd=mkstemps(&src[0],4);
+	if (fd==-1) throw NativeCodeException("cannot create "+tmpl);
+
+	size_t n=0;
+	while (n<code.size()) {
+		ssize_t k=write(fd,code.data()+n,code.size()-n);
+		if (k<=0) break;
+		n+=k;
+	}
+	close(fd);
+
+	if (n<code.size()) {
+		remove(&src[0]);
+		throw NativeCodeException("cannot write "+string(&src[0]));
+	}
+	return &src[0];
+}
+
+}
+
+string NativeFunction::compiler(_IBEX_NATIVE_CXX_);
+
+string NativeFunction::default_cache_dir() {
+	string dir;
+	const char* xdg=getenv("XDG_CACHE_HOME");
+	if (xdg && xdg[0]=='/')                        // relative paths are ignored (XDG specification)
+		dir=xdg;
+	else {
+		const char* home=getenv("HOME");
+		if (!home || home[0]=='\0') throw NativeCodeException("no cache directory (HOME is not set)");
+		dir=string(home)+"/.cache";
+	}
+	make_dir(dir);
+	dir+="/ibex";
+	make_dir(dir);
+	return dir;
+}
+
+NativeFunction::NativeFunction(const Function& f, const string& cache_dir) :
+		Fnc(f.nb_var(),f.image_dim()), f(f), tape(tape_of(f)), handle(NULL) {
+
+	ostringstream code;
+	tape.generate(code);
+
+	string dir=cache_dir.empty()? default_cache_dir() : cache_dir;
+	check_dir(dir);
+
+	string name=dir+"/ibex_native_"+hash(code.str()+compiler);
+	_library=name+".so";
+
+	struct stat st;
+	if (lstat(_library.c_str(),&st)!=0) {
+		string src=write_source(name,code.str());
+
+		// compile in a temporary file first: another process may
+		// load the library at the same time.
+		ostringstream tmp;
+		tmp << name << '.' << getpid() << ".so";
+
+		string cmd=compiler+" "+quote(src)+" -o "+quote(tmp.str());
+		if (system(cmd.c_str())!=0 || rename(tmp.str().c_str(),_library.c_str())!=0) {
+			remove(tmp.str().c_str());
+			remove(src.c_str());
+			throw NativeCodeException("cannot compile "+src+" with \""+compiler+"\"");
+		}
+		rename(src.c_str(),(name+".cpp").c_str());  // kept for information
+
+		if (lstat(_library.c_str(),&st)!=0)
+			throw NativeCodeException("cannot access "+_library);
+	}
+
+	// the library is loaded only if nobody else can have replaced it
+	if (!S_ISREG(st.st_mode) || !is_private(st))
+		throw NativeCodeException("unsafe library "+_library+" (must be a regular file owned by the user and not writable by the others)");
+
+	handle=dlopen(_library.c_str(),RTLD_NOW | RTLD_LOCAL);
+	if (!handle) throw NativeCodeException(dlerror());
+
+	_forward =(bool (*)(Interval*)) dlsym(handle,"ibex_forward");
+	_backward=(bool (*)(Interval*)) dlsym(handle,"ibex_backward");
+	_jacobian=(void (*)(const Interval*, Interval*, Interval*)) dlsym(handle,"ibex_jacobian");
+
+	if (!_forward || !_backward || !_jacobian) {
+		dlclose(handle);
+		throw NativeCodeException("invalid library "+_library);
+	}
+}
+
+NativeFunction::~NativeFunction() {
+	dlclose(handle);
+}
+
+Interval NativeFunction::eval(const IntervalVector& box) const {
+	assert(image_dim()==1);
+
+	Interval* r=f.workspace().regs;
+
+	tape.load(box,r);
+
+	if (!_forward(r)) return Interval::EMPTY_SET;
+
+	return r[tape.root];
+}
+
+IntervalVector NativeFunction::eval_vector(const IntervalVector& box) const {
+	IntervalVector y(image_dim());
+
+	Interval* r=f.workspace().regs;
+
+	tape.load(box,r);
+
+	if (!_forward(r))
+		y.set_empty();
+	else
+		for (int i=0; i<image_dim(); i++) y[i]=r[tape.root+i];
+	return y;
+}
+
+void NativeFunction::gradient(const IntervalVector& x, IntervalVector& g) const {
+	assert(image_dim()==1);
+	assert(g.size()==nb_var());
+
+	FunctionWorkspace& w=f.workspace();
+
+	tape.load(x,w.regs);
+
+	if (!_forward(w.regs)) {
+		g.set_empty();
+		return;
+	}
+
+	_jacobian(w.regs,w.adj,&g[0]);  // the Jacobian matrix of a scalar function is the gradient
+}
+
+void NativeFunction::jacobian(const IntervalVector& x, IntervalMatrix& J) const {
+	assert(J.nb_rows()==image_dim() && J.nb_cols()==nb_var());
+
+	FunctionWorkspace& w=f.workspace();
+
+	tape.load(x,w.regs);
+
+	if (!_forward(w.regs)) {
+		J.set_empty();
+		return;
+	}
+
+	Interval* rows=new Interval[image_dim()*nb_var()];
+
+	_jacobian(w.regs,w.adj,rows);
+
+	for (int i=0; i<image_dim(); i++)
+		for (int j=0; j<nb_var(); j++)
+			J[i][j]=rows[i*nb_var()+j];
+
+	delete[] rows;
+}
+
+bool NativeFunction::proj(const Domain& y, IntervalVector& x) const {
+	Interval* r=f.workspace().regs;
+
+	tape.load(x,r);
+
+	if (!_forward(r)) {
+		x.set_empty();
+		return false;
+	}
+
+	if (tape.root_subset(r,y)) return true;
+
+	if (!tape.root_inter(r,y) || !_backward(r)) {
+		x.set_empty();
+		return false;
+	}
+
+	tape.read(r,x);
+	return false;
+}
+
+void NativeFunction::print(ostream& os) const {
+	os << f;
+}
+
+void NativeFunction::generate_used_vars() const {
+	_nb_used_vars=f.nb_used_vars();
+	_used_var=new int[_nb_used_vars];
+	for (int i=0; i<_nb_used_vars; i++) _used_var[i]=f.used_var(i);
+}
+
+} // end namespace ibex
@@ -0,0 +1,170 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_NativeFunction.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+// Last Update : Oct 16, 2026
+//============================================================================
+
+#ifndef __IBEX_NATIVE_FUNCTION_H__
+#define __IBEX_NATIVE_FUNCTION_H__
+
+#include "ibex_Function.h"
+#include "ibex_NativeCodeException.h"
+
+#include <string>
+
+namespace ibex {
+
+/**
+ * \ingroup function
+ *
+ * \brief Function compiled to native code.
+ *
+ * The C++ code of the tape of a function (see #ibex::Tape::generate(std::ostream&) const)
+ * is compiled into a shared library with the system compiler, and loaded at runtime.
+ * The forward evaluation, the HC4Revise projection and the gradient/Jacobian matrix
+ * then run as straight-line code, without the interpretation of the instructions.
+ *
+ * The shared library is cached in a directory: its name is a hash of the generated code
+ * (which contains the exact constants of the expression) and of the compilation command.
+ * If the library already exists (e.g., built by a previous run), it is loaded directly.
+ * By default, the cache is private to the user (see #default_cache_dir()). Since a library
+ * of the cache is loaded without being checked, the directory and the library must be owned
+ * by the user and not writable by the group or the others.
+ *
+ * The generated code calls the arithmetic of ibex. Its symbols are resolved when the
+ * library is loaded: either ibex is a shared library (--enable-shared) or the program
+ * must export them (link with -rdynamic).
+ *
+ * The function \a f must not be deleted before *this. The registers are those
+ * of the workspace of \a f (see #ibex::Function::workspace()) so that several
+ * threads can use the same NativeFunction, each with its own #ibex::EvalContext.
+ *
+ * An #ibex::NativeCodeException is thrown if the function cannot be taped, or if the code
+ * cannot be compiled or loaded.
+ */
+class NativeFunction : public Fnc {
+public:
+	/**
+	 * \brief Compile \a f (or load it from the cache).
+	 *
+	 * \param cache_dir - the directory where the generated code and the libraries are stored.
+	 *                    By default (empty string), #default_cache_dir().
+	 */
+	NativeFunction(const Function& f, const std::string& cache_dir="");
+
+	/**
+	 * \brief Delete *this (the shared library is unloaded but kept in the cache).
+	 */
+	~NativeFunction();
+
+	/**
+	 * \brief Calculate f(box) using interval arithmetic.
+	 *
+	 * \pre f must be real-valued
+	 */
+	virtual Interval eval(const IntervalVector& box) const;
+
+	/**
+	 * \brief Calculate f(box) using interval arithmetic.
+	 */
+	virtual IntervalVector eval_vector(const IntervalVector& box) const;
+
+	/**
+	 * \brief Calculate the gradient of f.
+	 *
+	 * \pre f must be real-valued
+	 */
+	virtual void gradient(const IntervalVector& x, IntervalVector& g) const;
+
+	/**
+	 * \brief Calculate the Jacobian matrix of f.
+	 */
+	virtual void jacobian(const IntervalVector& x, IntervalMatrix& J) const;
+
+	/**
+	 * \brief Project f(x)=y onto x (HC4Revise).
+	 *
+	 * Same as #ibex::HC4Revise::try_proj(const Function&, const Domain&, IntervalVector&):
+	 * return true if f(x) is included in y (x is not contracted). If the projection is
+	 * empty, x is set to the empty box (no exception is thrown).
+	 */
+	bool proj(const Domain& y, IntervalVector& x) const;
+
+	// ========== never understood why we have to do this in c++ =================
+	IntervalVector gradient(const IntervalVector& x) const;
+	IntervalMatrix jacobian(const IntervalVector& x) const;
+	// ============================================================================
+
+	/**
+	 * \brief The path of the shared library.
+	 */
+	const std::string& library() const;
+
+	/**
+	 * \brief The original function.
+	 */
+	const Function& f;
+
+	/**
+	 * \brief The command used to compile the code.
+	 *
+	 * The source file and the "-o" option with the name of the library are appended.
+	 * By default, the command set at the configuration of ibex (the system compiler
+	 * with the include directories of ibex).
+	 */
+	static std::string compiler;
+
+	/**
+	 * \brief The default cache directory.
+	 *
+	 * $XDG_CACHE_HOME/ibex, or $HOME/.cache/ibex. The directory is created
+	 * (with permissions 0700) if it does not exist.
+	 */
+	static std::string default_cache_dir();
+
+protected:
+	/**
+	 * \brief Print the function "x->f(x)" (including arguments)
+	 */
+	virtual void print(std::ostream& os) const;
+
+	/**
+	 * \brief Initialize _nb_used_vars and _used_var
+	 */
+	virtual void generate_used_vars() const;
+
+	const Tape& tape;
+
+	std::string _library;
+
+	void* handle;
+
+	bool (*_forward)(Interval* r);
+	bool (*_backward)(Interval* r);
+	void (*_jacobian)(const Interval* r, Interval* g, Interval* J);
+
+private:
+	NativeFunction(const NativeFunction&); // forbidden
+};
+
+/*================================== inline implementations ========================================*/
+
+inline IntervalVector NativeFunction::gradient(const IntervalVector& x) const {
+	return Fnc::gradient(x);
+}
+
+inline IntervalMatrix NativeFunction::jacobian(const IntervalVector& x) const {
+	return Fnc::jacobian(x);
+}
+
+inline const std::string& NativeFunction::library() const {
+	return _library;
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_NATIVE_FUNCTION_H__
@@ -0,0 +1,1246 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Tape.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+// Last Update : Oct 16, 2026
+//============================================================================
+
+#include "ibex_Tape.h"
+#include "ibex_NodeMap.h"
+
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <cmath>
+#include <cfloat>
+#include <cstdio>
+#include <sstream>
+#include <fenv.h>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+typedef CompiledFunction CF;
+
+// Bounds of the outward rounding of a number calculated in
+// round-to-nearest mode (Rump et al., BIT 2009):
+//   phi=u(1+2u) where u=2^-53 is the unit roundoff,
+//   eta=2^-1074 is the smallest positive (subnormal) number.
+const double PHI=ldexp(1.0,-53)+ldexp(1.0,-105);
+const double ETA=ldexp(1.0,-1074);
+
+inline double down(double c) { return c-(PHI*fabs(c)+ETA); }
+
+inline double up(double c)   { return c+(PHI*fabs(c)+ETA); }
+
+inline bool is_finite(double c) { return fabs(c)<=DBL_MAX; }
+
+// batch mode: an empty interval is [+oo,-oo]
+inline void store(const Interval& x, double& lb, double& ub) {
+	if (x.is_empty()) { lb=POS_INFINITY; ub=NEG_INFINITY; }
+	else { lb=x.lb(); ub=x.ub(); }
+}
+
+// Sparse vectors: the values of the ith vector are v[start[i]],...,v[start[i+1]-1]
+// and the corresponding indices are k[start[i]],...,k[start[i+1]-1] (increasing).
+// Add a*x to y, where the indices of x are included in those of y.
+inline void axpy(const Interval& a, const int* kx, const int* startx, const Interval* vx, int x,
+		const int* ky, const int* starty, Interval* vy, int y) {
+
+	if (a.lb()==0 && a.ub()==0) return;
+
+	// a=1 or a=-1 for linear operators
+	const bool one=a.lb()==1 && a.ub()==1;
+	const bool minus_one=a.lb()==-1 && a.ub()==-1;
+
+	int j=starty[y];
+	for (int i=startx[x]; i<startx[x+1]; i++) {
+		while (ky[j]<kx[i]) j++;
+		if (one)            vy[j]+=vx[i];
+		else if (minus_one) vy[j]-=vx[i];
+		else                vy[j]+=a*vx[i];
+	}
+}
+
+inline Interval itv(double lb, double ub) {
+	return lb>ub? Interval::EMPTY_SET : Interval(lb,ub);
+}
+
+// exact C++ expression of a bound: m*2^e where m is an integer
+// (hexadecimal floating-point literals are not standard before C++17)
+string literal(double x) {
+	if (x==POS_INFINITY) return "POS_INFINITY";
+	if (x==NEG_INFINITY) return "NEG_INFINITY";
+	int e;
+	double m=ldexp(frexp(x,&e),DBL_MANT_DIG);
+	char buf[64];
+	snprintf(buf,sizeof(buf),"std::ldexp(%.0f.0,%d)",m,e-DBL_MANT_DIG);
+	return buf;
+}
+
+// name of a register in the generated code
+string reg(const char* array, int i) {
+	ostringstream os;
+	os << array << '[' << i << ']';
+	return os.str();
+}
+
+}
+
+bool Tape::supported(const CompiledFunction& cf) {
+	for (int i=0; i<cf.n; i++) {
+		const ExprNode& e=cf.nodes[i];
+
+		if (e.dim.type()==Dim::MATRIX_ARRAY) return false;
+
+		switch (cf.code[i]) {
+		case CF::IDX:
+		case CF::SYM:
+		case CF::CST:
+			break;
+		case CF::VEC:
+			// a matrix made of columns is not stored row by row
+			if (e.dim.is_matrix() && ((const ExprVector&) e).row_vector()) return false;
+			break;
+		case CF::APPLY:
+		case CF::CHI:
+		case CF::TRANS_V: case CF::TRANS_M:
+		case CF::ADD_V: case CF::ADD_M: case CF::SUB_V: case CF::SUB_M:
+		case CF::MUL_SV: case CF::MUL_SM: case CF::MUL_VV: case CF::MUL_MV: case CF::MUL_MM: case CF::MUL_VM:
+			return false;
+		default:
+			if (!e.dim.is_scalar()) return false;
+			break;
+		}
+	}
+	return true;
+}
+
+Tape::Tape(const Array<const ExprSymbol>& x, const CompiledFunction& cf) : nb_regs(0), nb_var(0), root(0) {
+	assert(supported(cf));
+
+	int n=cf.n;
+
+	// register of the first component of each node
+	NodeMap<int> reg;
+
+	int nv=0;
+	for (int i=0; i<x.size(); i++) {
+		reg.insert(x[i],nv);
+		nv+=x[i].dim.size();
+	}
+
+	int nc=0;
+	for (int i=0; i<n; i++)
+		if (cf.code[i]==CF::CST) nc+=cf.nodes[i].dim.size();
+
+	(int&) nb_var=nv;
+	nb_cst=nc;
+	cst=new Interval[nb_cst];
+
+	vector<Instr> instr;
+	int next_cst=nb_var;
+	int next=nb_var+nb_cst;
+
+	// nodes are sorted by decreasing height
+	for (int i=n-1; i>=0; i--) {
+		const ExprNode& e=cf.nodes[i];
+		Instr c;
+		c.op=cf.code[i];
+
+		switch (c.op) {
+		case CF::SYM:
+			break; // already inserted
+		case CF::CST: {
+			const ExprConstant& k=(const ExprConstant&) e;
+			switch (e.dim.type()) {
+			case Dim::SCALAR:
+				cst[next_cst-nb_var]=k.get_value();
+				break;
+			case Dim::ROW_VECTOR:
+			case Dim::COL_VECTOR:
+				for (int j=0; j<e.dim.size(); j++)
+					cst[next_cst-nb_var+j]=k.get_vector_value()[j];
+				break;
+			default:
+				for (int j=0; j<e.dim.size(); j++)
+					cst[next_cst-nb_var+j]=k.get_matrix_value()[j/e.dim.dim3][j%e.dim.dim3];
+				break;
+			}
+			reg.insert(e,next_cst);
+			next_cst+=e.dim.size();
+			break;
+		}
+		case CF::IDX: {
+			const ExprIndex& idx=(const ExprIndex&) e;
+			// the ith row of a matrix or the ith component of a vector
+			int stride=idx.expr.dim.is_matrix()? idx.expr.dim.dim3 : 1;
+			reg.insert(e,reg[idx.expr]+idx.index*stride);
+			break;
+		}
+		case CF::VEC: {
+			const ExprVector& v=(const ExprVector&) e;
+			reg.insert(e,next);
+			for (int j=0; j<v.length(); j++) {
+				for (int l=0; l<v.arg(j).dim.size(); l++) {
+					c.y=next++;
+					c.x1=reg[v.arg(j)]+l;
+					c.x2=0;
+					instr.push_back(c);
+				}
+			}
+			break;
+		}
+		case CF::POWER: {
+			const ExprPower& p=(const ExprPower&) e;
+			c.y=next;
+			c.x1=reg[p.expr];
+			c.x2=p.expon;
+			instr.push_back(c);
+			reg.insert(e,next++);
+			break;
+		}
+		default: {
+			c.y=next;
+			const ExprBinaryOp* b=dynamic_cast<const ExprBinaryOp*>(&e);
+			if (b) {
+				c.x1=reg[b->left];
+				c.x2=reg[b->right];
+			} else {
+				c.x1=reg[((const ExprUnaryOp&) e).expr];
+				c.x2=0;
+			}
+			instr.push_back(c);
+			reg.insert(e,next++);
+			break;
+		}
+		}
+	}
+
+	(int&) nb_regs=next;
+	(int&) root=reg[cf.nodes[0]];
+	root_size=cf.nodes[0].dim.size();
+
+	size=instr.size();
+	code=new Instr[size];
+	for (int i=0; i<size; i++) code[i]=instr[i];
+
+	// instruction that calculates each register (-1 for the arguments and constants)
+	vector<int> def(nb_regs,-1);
+	for (int i=0; i<size; i++) def[code[i].y]=i;
+
+	// cone of each component of the root
+	vector<int> mark(size,-1);
+	vector<int> all;
+	cone_start=new int[root_size+1];
+
+	for (int k=0; k<root_size; k++) {
+		cone_start[k]=all.size();
+		vector<int> stack;
+		if (def[root+k]!=-1) stack.push_back(def[root+k]);
+		while (!stack.empty()) {
+			int i=stack.back();
+			stack.pop_back();
+			if (mark[i]==k) continue;
+			mark[i]=k;
+			all.push_back(i);
+			int x1=def[code[i].x1];
+			if (x1!=-1 && mark[x1]!=k) stack.push_back(x1);
+			if (binary(code[i].op)) {
+				int x2=def[code[i].x2];
+				if (x2!=-1 && mark[x2]!=k) stack.push_back(x2);
+			}
+		}
+		sort(all.begin()+cone_start[k],all.end(),greater<int>());
+	}
+	cone_start[root_size]=all.size();
+
+	cone=new int[all.size()];
+	for (unsigned int i=0; i<all.size(); i++) cone[i]=all[i];
+
+	if (root_size==1)
+		init_hessian();
+	else
+		supp_start=supp=asupp_start=asupp=NULL;
+}
+
+Tape::~Tape() {
+	delete[] code;
+	delete[] cst;
+	delete[] cone_start;
+	delete[] cone;
+	if (supp_start) {
+		delete[] supp_start;
+		delete[] supp;
+		delete[] asupp_start;
+		delete[] asupp;
+	}
+}
+
+bool Tape::linear(CompiledFunction::operation op) {
+	return op==CF::VEC || op==CF::ADD || op==CF::SUB || op==CF::MINUS;
+}
+
+void Tape::init_hessian() {
+	// support of each register
+	vector<vector<int> > s(nb_regs);
+	for (int i=0; i<nb_var; i++) s[i].push_back(i);
+
+	for (int i=0; i<size; i++) {
+		const Instr& c=code[i];
+		if (binary(c.op))
+			set_union(s[c.x1].begin(),s[c.x1].end(),s[c.x2].begin(),s[c.x2].end(),back_inserter(s[c.y]));
+		else
+			s[c.y]=s[c.x1];
+	}
+
+	// support of the derivative of each adjoint
+	vector<vector<int> > as(nb_regs);
+
+	for (int i=size-1; i>=0; i--) {
+		const Instr& c=code[i];
+		vector<int> u;
+		if (linear(c.op))
+			u=as[c.y];
+		else
+			set_union(as[c.y].begin(),as[c.y].end(),s[c.y].begin(),s[c.y].end(),back_inserter(u));
+
+		for (int k=0; k<(binary(c.op)? 2 : 1); k++) {
+			vector<int>& ax=as[k==0? c.x1 : c.x2];
+			vector<int> v;
+			set_union(ax.begin(),ax.end(),u.begin(),u.end(),back_inserter(v));
+			ax.swap(v);
+		}
+	}
+
+	supp_start=new int[nb_regs+1];
+	asupp_start=new int[nb_regs+1];
+	supp_start[0]=asupp_start[0]=0;
+	for (int i=0; i<nb_regs; i++) {
+		supp_start[i+1]=supp_start[i]+s[i].size();
+		asupp_start[i+1]=asupp_start[i]+as[i].size();
+	}
+	supp=new int[supp_start[nb_regs]];
+	asupp=new int[asupp_start[nb_regs]];
+	for (int i=0; i<nb_regs; i++) {
+		copy(s[i].begin(),s[i].end(),supp+supp_start[i]);
+		copy(as[i].begin(),as[i].end(),asupp+asupp_start[i]);
+	}
+}
+
+bool Tape::binary(CompiledFunction::operation op) {
+	switch (op) {
+	case CF::ADD: case CF::MUL: case CF::SUB: case CF::DIV:
+	case CF::MAX: case CF::MIN: case CF::ATAN2:
+		return true;
+	default:
+		return false;
+	}
+}
+
+void Tape::load(const IntervalVector& box, Interval* r) const {
+	assert(box.size()==nb_var);
+	for (int i=0; i<nb_var; i++) r[i]=box[i];
+}
+
+void Tape::read(const Interval* r, IntervalVector& box) const {
+	assert(box.size()==nb_var);
+	for (int i=0; i<nb_var; i++) box[i]=r[i];
+}
+
+bool Tape::forward(Interval* r) const {
+
+	for (int i=0; i<nb_cst; i++) r[nb_var+i]=cst[i];
+
+	for (const Instr* c=code; c<code+size; c++)
+		if (!eval(*c,r)) return false;
+
+	return true;
+}
+
+bool Tape::forward(Interval* r, bool* dirty) const {
+
+	for (const Instr* c=code; c<code+size; c++) {
+		if (dirty[c->x1] || (binary(c->op) && dirty[c->x2])) {
+			dirty[c->y]=true;
+			if (!eval(*c,r)) return false;
+		} else
+			dirty[c->y]=false;
+	}
+	return true;
+}
+
+bool Tape::eval(const Instr& c, Interval* r) {
+	Interval& y=r[c.y];
+	const Interval& x1=r[c.x1];
+
+	switch (c.op) {
+	case CF::VEC:    y=x1;                        break;
+	case CF::ADD:    y=x1+r[c.x2];                break;
+	case CF::MUL:    y=x1*r[c.x2];                break;
+	case CF::SUB:    y=x1-r[c.x2];                break;
+	case CF::DIV:    y=x1/r[c.x2];                break;
+	case CF::MAX:    y=max(x1,r[c.x2]);           break;
+	case CF::MIN:    y=min(x1,r[c.x2]);           break;
+	case CF::ATAN2:  y=atan2(x1,r[c.x2]);         break;
+	case CF::MINUS:  y=-x1;                       break;
+	case CF::SIGN:   y=sign(x1);                  break;
+	case CF::ABS:    y=abs(x1);                   break;
+	case CF::POWER:  y=pow(x1,c.x2);              break;
+	case CF::SQR:    y=sqr(x1);                   break;
+	case CF::SQRT:  if ((y=sqrt(x1)).is_empty()) return false; break;
+	case CF::EXP:    y=exp(x1);                   break;
+	case CF::LOG:   if ((y=log(x1)).is_empty()) return false; break;
+	case CF::COS:    y=cos(x1);                   break;
+	case CF::SIN:    y=sin(x1);                   break;
+	case CF::TAN:   if ((y=tan(x1)).is_empty()) return false; break;
+	case CF::COSH:   y=cosh(x1);                  break;
+	case CF::SINH:   y=sinh(x1);                  break;
+	case CF::TANH:   y=tanh(x1);                  break;
+	case CF::ACOS:  if ((y=acos(x1)).is_empty()) return false; break;
+	case CF::ASIN:  if ((y=asin(x1)).is_empty()) return false; break;
+	case CF::ATAN:   y=atan(x1);                  break;
+	case CF::ACOSH: if ((y=acosh(x1)).is_empty()) return false; break;
+	case CF::ASINH:  y=asinh(x1);                 break;
+	case CF::ATANH: if ((y=atanh(x1)).is_empty()) return false; break;
+	default: assert(false); break;
+	}
+	return true;
+}
+
+void Tape::load(const Array<const IntervalVector>& x, int start, int n, double* lb, double* ub) const {
+	for (int j=0; j<n; j++) {
+		const IntervalVector& box=x[start+j];
+		assert(box.size()==nb_var);
+		for (int i=0; i<nb_var; i++)
+			store(box[i],lb[i*n+j],ub[i*n+j]);
+	}
+}
+
+void Tape::forward(double* lb, double* ub, int n) const {
+
+	for (int i=0; i<nb_cst; i++)
+		for (int j=0; j<n; j++)
+			store(cst[i],lb[(nb_var+i)*n+j],ub[(nb_var+i)*n+j]);
+
+	// the fast loops are calculated in round-to-nearest mode
+	// and the operations of Interval in the current mode
+	const int round=fegetround();
+
+	for (const Instr* c=code; c<code+size; c++) {
+		double* yl=lb+c->y*n;
+		double* yu=ub+c->y*n;
+		const double* al=lb+c->x1*n;
+		const double* au=ub+c->x1*n;
+		// x2 is not a register for unary operators and POWER
+		const bool binary=Tape::binary(c->op);
+		const double* bl=binary? lb+c->x2*n : NULL;
+		const double* bu=binary? ub+c->x2*n : NULL;
+
+		switch (c->op) {
+		case CF::VEC:
+			for (int j=0; j<n; j++) { yl[j]=al[j]; yu[j]=au[j]; }
+			continue;
+		case CF::MINUS:
+			// exact (and [+oo,-oo] is preserved)
+			for (int j=0; j<n; j++) { yl[j]=-au[j]; yu[j]=-al[j]; }
+			continue;
+		case CF::ADD: case CF::SUB: case CF::MUL: case CF::DIV: case CF::SQR:
+			break;
+		default:
+			for (int j=0; j<n; j++)
+				store(apply(*c,itv(al[j],au[j]),binary? itv(bl[j],bu[j]) : Interval::ZERO),yl[j],yu[j]);
+			continue;
+		}
+
+		if (round!=FE_TONEAREST) fesetround(FE_TONEAREST);
+
+		switch (c->op) {
+		case CF::ADD:
+			for (int j=0; j<n; j++) {
+				yl[j]=down(al[j]+bl[j]);
+				yu[j]=up(au[j]+bu[j]);
+			}
+			break;
+		case CF::SUB:
+			for (int j=0; j<n; j++) {
+				yl[j]=down(al[j]-bu[j]);
+				yu[j]=up(au[j]-bl[j]);
+			}
+			break;
+		case CF::MUL:
+			for (int j=0; j<n; j++) {
+				double p1=al[j]*bl[j], p2=al[j]*bu[j], p3=au[j]*bl[j], p4=au[j]*bu[j];
+				double m1=p1<p2? p1 : p2, m2=p3<p4? p3 : p4;
+				double M1=p1>p2? p1 : p2, M2=p3>p4? p3 : p4;
+				yl[j]=down(m1<m2? m1 : m2);
+				yu[j]=up(M1>M2? M1 : M2);
+			}
+			break;
+		case CF::DIV:
+			// meaningless if the denominator contains 0 (fixed below)
+			for (int j=0; j<n; j++) {
+				double q1=al[j]/bl[j], q2=al[j]/bu[j], q3=au[j]/bl[j], q4=au[j]/bu[j];
+				double m1=q1<q2? q1 : q2, m2=q3<q4? q3 : q4;
+				double M1=q1>q2? q1 : q2, M2=q3>q4? q3 : q4;
+				yl[j]=down(m1<m2? m1 : m2);
+				yu[j]=up(M1>M2? M1 : M2);
+			}
+			break;
+		default: // SQR
+			for (int j=0; j<n; j++) {
+				// mig and mag of [al,au]
+				double m=al[j]>-au[j]? al[j] : -au[j];
+				if (m<0) m=0;
+				double M=-al[j]>au[j]? -al[j] : au[j];
+				double l=down(m*m);
+				yl[j]=l<0? 0 : l;
+				yu[j]=up(M*M);
+			}
+			break;
+		}
+
+		if (round!=FE_TONEAREST) fesetround(round);
+
+		// infinite or empty bounds, overflows and division by zero
+		for (int j=0; j<n; j++) {
+			if (is_finite(yl[j]) && is_finite(yu[j]) && is_finite(al[j]) && is_finite(au[j])) {
+				if (!binary) continue;
+				if (is_finite(bl[j]) && is_finite(bu[j]) && (c->op!=CF::DIV || bl[j]>0 || bu[j]<0)) continue;
+			}
+			store(apply(*c,itv(al[j],au[j]),binary? itv(bl[j],bu[j]) : Interval::ZERO),yl[j],yu[j]);
+		}
+	}
+}
+
+Interval Tape::apply(const Instr& c, const Interval& x1, const Interval& x2) {
+	switch (c.op) {
+	case CF::ADD:    return x1+x2;
+	case CF::MUL:    return x1*x2;
+	case CF::SUB:    return x1-x2;
+	case CF::DIV:    return x1/x2;
+	case CF::MAX:    return max(x1,x2);
+	case CF::MIN:    return min(x1,x2);
+	case CF::ATAN2:  return atan2(x1,x2);
+	case CF::MINUS:  return -x1;
+	case CF::SIGN:   return sign(x1);
+	case CF::ABS:    return abs(x1);
+	case CF::POWER:  return pow(x1,c.x2);
+	case CF::SQR:    return sqr(x1);
+	case CF::SQRT:   return sqrt(x1);
+	case CF::EXP:    return exp(x1);
+	case CF::LOG:    return log(x1);
+	case CF::COS:    return cos(x1);
+	case CF::SIN:    return sin(x1);
+	case CF::TAN:    return tan(x1);
+	case CF::COSH:   return cosh(x1);
+	case CF::SINH:   return sinh(x1);
+	case CF::TANH:   return tanh(x1);
+	case CF::ACOS:   return acos(x1);
+	case CF::ASIN:   return asin(x1);
+	case CF::ATAN:   return atan(x1);
+	case CF::ACOSH:  return acosh(x1);
+	case CF::ASINH:  return asinh(x1);
+	case CF::ATANH:  return atanh(x1);
+	default: assert(false); return x1;
+	}
+}
+
+void Tape::read_root(const double* lb, const double* ub, int n, IntervalMatrix& y, int start) const {
+	for (int j=0; j<n; j++) {
+		IntervalVector& row=y[start+j];
+		assert(row.size()==root_size);
+		for (int k=0; k<root_size; k++) {
+			if (lb[(root+k)*n+j]>ub[(root+k)*n+j]) {
+				row.set_empty();
+				break;
+			}
+			row[k]=Interval(lb[(root+k)*n+j],ub[(root+k)*n+j]);
+		}
+	}
+}
+
+bool Tape::backward(Interval* r) const {
+
+	for (const Instr* c=code+size-1; c>=code; c--) {
+		const Interval& y=r[c->y];
+		Interval& x1=r[c->x1];
+		bool ok;
+
+		switch (c->op) {
+		case CF::VEC:    ok=!(x1&=y).is_empty();      break;
+		case CF::ADD:    ok=bwd_add(y,x1,r[c->x2]);   break;
+		case CF::MUL:    ok=bwd_mul(y,x1,r[c->x2]);   break;
+		case CF::SUB:    ok=bwd_sub(y,x1,r[c->x2]);   break;
+		case CF::DIV:    ok=bwd_div(y,x1,r[c->x2]);   break;
+		case CF::MAX:    ok=bwd_max(y,x1,r[c->x2]);   break;
+		case CF::MIN:    ok=bwd_min(y,x1,r[c->x2]);   break;
+		case CF::ATAN2:  ok=bwd_atan2(y,x1,r[c->x2]); break;
+		case CF::MINUS:  ok=!(x1&=-y).is_empty();     break;
+		case CF::SIGN:   ok=bwd_sign(y,x1);           break;
+		case CF::ABS:    ok=bwd_abs(y,x1);            break;
+		case CF::POWER:  ok=bwd_pow(y,c->x2,x1);      break;
+		case CF::SQR:    ok=bwd_sqr(y,x1);            break;
+		case CF::SQRT:   ok=bwd_sqrt(y,x1);           break;
+		case CF::EXP:    ok=bwd_exp(y,x1);            break;
+		case CF::LOG:    ok=bwd_log(y,x1);            break;
+		case CF::COS:    ok=bwd_cos(y,x1);            break;
+		case CF::SIN:    ok=bwd_sin(y,x1);            break;
+		case CF::TAN:    ok=bwd_tan(y,x1);            break;
+		case CF::COSH:   ok=bwd_cosh(y,x1);           break;
+		case CF::SINH:   ok=bwd_sinh(y,x1);           break;
+		case CF::TANH:   ok=bwd_tanh(y,x1);           break;
+		case CF::ACOS:   ok=bwd_acos(y,x1);           break;
+		case CF::ASIN:   ok=bwd_asin(y,x1);           break;
+		case CF::ATAN:   ok=bwd_atan(y,x1);           break;
+		case CF::ACOSH:  ok=bwd_acosh(y,x1);          break;
+		case CF::ASINH:  ok=bwd_asinh(y,x1);          break;
+		case CF::ATANH:  ok=bwd_atanh(y,x1);          break;
+		default: assert(false); ok=true; break;
+		}
+
+		if (!ok) return false;
+	}
+	return true;
+}
+
+void Tape::gradient(const Interval* r, Interval* g) const {
+	assert(root_size==1);
+
+	for (int i=0; i<nb_regs; i++) g[i]=Interval::ZERO;
+
+	g[root]=Interval::ONE;
+
+	for (const Instr* c=code+size-1; c>=code; c--)
+		backward_adj(*c,r,g);
+}
+
+void Tape::jacobian(const Interval* r, Interval* g, IntervalMatrix& J) const {
+	assert(J.nb_rows()==root_size && J.nb_cols()==nb_var);
+
+	for (int i=0; i<nb_regs; i++) g[i]=Interval::ZERO;
+
+	for (int k=0; k<root_size; k++) {
+		const int* first=cone+cone_start[k];
+		const int* last=cone+cone_start[k+1];
+
+		g[root+k]=Interval::ONE;
+
+		// the instructions of the cone are in reverse order
+		for (const int* i=first; i<last; i++)
+			backward_adj(code[*i],r,g);
+
+		for (int i=0; i<nb_var; i++) {
+			J[k][i]=g[i];
+			g[i]=Interval::ZERO;
+		}
+
+		// reset the adjoints for the next component
+		g[root+k]=Interval::ZERO;
+		for (const int* i=first; i<last; i++) {
+			const Instr& c=code[*i];
+			g[c.y]=g[c.x1]=Interval::ZERO;
+			if (binary(c.op)) g[c.x2]=Interval::ZERO;
+		}
+	}
+}
+
+void Tape::jacobian(const Interval* r, Interval* g, SparseIntervalMatrix& J) const {
+	assert(J.nb_rows()==root_size && J.nb_cols()==nb_var);
+
+	for (int i=0; i<nb_regs; i++) g[i]=Interval::ZERO;
+
+	for (int k=0; k<root_size; k++) {
+		const int* first=cone+cone_start[k];
+		const int* last=cone+cone_start[k+1];
+
+		g[root+k]=Interval::ONE;
+
+		for (const int* i=first; i<last; i++)
+			backward_adj(code[*i],r,g);
+
+		for (int l=J.row_start(k); l<J.row_start(k+1); l++)
+			J.val(l)=g[J.col(l)];
+
+		// reset the adjoints (including the ones of the arguments)
+		g[root+k]=Interval::ZERO;
+		for (const int* i=first; i<last; i++) {
+			const Instr& c=code[*i];
+			g[c.y]=g[c.x1]=Interval::ZERO;
+			if (binary(c.op)) g[c.x2]=Interval::ZERO;
+		}
+	}
+}
+
+void Tape::hessian(const Interval* r, Interval* g, IntervalMatrix& H) const {
+	assert(root_size==1);
+	assert(H.nb_rows()==nb_var && H.nb_cols()==nb_var);
+
+	// partial derivatives of each instruction
+	Interval* d=new Interval[5*size];
+	// derivatives of the registers w.r.t. the arguments in their support
+	Interval* t=new Interval[supp_start[nb_regs]];
+	// derivatives of the adjoints w.r.t. the arguments in their support
+	Interval* gt=new Interval[asupp_start[nb_regs]];
+
+	for (int i=0; i<nb_regs; i++) g[i]=Interval::ZERO;
+	for (int i=0; i<asupp_start[nb_regs]; i++) gt[i]=Interval::ZERO;
+	for (int i=0; i<nb_var; i++) t[supp_start[i]]=Interval::ONE;
+
+	// forward (tangents)
+	for (int i=0; i<size; i++) {
+		const Instr& c=code[i];
+		Interval* di=d+5*i;
+		derivatives(c,r,di);
+
+		for (int j=supp_start[c.y]; j<supp_start[c.y+1]; j++) t[j]=Interval::ZERO;
+
+		axpy(di[0],supp,supp_start,t,c.x1,supp,supp_start,t,c.y);
+		if (binary(c.op))
+			axpy(di[1],supp,supp_start,t,c.x2,supp,supp_start,t,c.y);
+	}
+
+	// backward (adjoints and their tangents)
+	g[root]=Interval::ONE;
+
+	for (int i=size-1; i>=0; i--) {
+		const Instr& c=code[i];
+		const Interval* di=d+5*i;
+		const Interval a=g[c.y];
+
+		g[c.x1]+=a*di[0];
+		axpy(di[0],asupp,asupp_start,gt,c.y,asupp,asupp_start,gt,c.x1);
+		if (!linear(c.op)) {
+			axpy(a*di[2],supp,supp_start,t,c.x1,asupp,asupp_start,gt,c.x1);
+			if (binary(c.op))
+				axpy(a*di[3],supp,supp_start,t,c.x2,asupp,asupp_start,gt,c.x1);
+		}
+
+		if (binary(c.op)) {
+			g[c.x2]+=a*di[1];
+			axpy(di[1],asupp,asupp_start,gt,c.y,asupp,asupp_start,gt,c.x2);
+			if (!linear(c.op)) {
+				axpy(a*di[3],supp,supp_start,t,c.x1,asupp,asupp_start,gt,c.x2);
+				axpy(a*di[4],supp,supp_start,t,c.x2,asupp,asupp_start,gt,c.x2);
+			}
+		}
+	}
+
+	for (int i=0; i<nb_var; i++) {
+		H[i].clear();
+		for (int j=asupp_start[i]; j<asupp_start[i+1]; j++)
+			H[i][asupp[j]]=gt[j];
+	}
+
+	delete[] d;
+	delete[] t;
+	delete[] gt;
+}
+
+void Tape::derivatives(const Instr& c, const Interval* r, Interval* d) {
+	const Interval& x1=r[c.x1];
+	const Interval& y=r[c.y];
+
+	for (int i=0; i<5; i++) d[i]=Interval::ZERO;
+
+	switch (c.op) {
+	case CF::VEC:   d[0]=1; break;
+	case CF::ADD:   d[0]=1; d[1]=1; break;
+	case CF::SUB:   d[0]=1; d[1]=-1; break;
+	case CF::MUL:   d[0]=r[c.x2]; d[1]=x1; d[3]=1; break;
+	case CF::DIV: {
+		const Interval& x2=r[c.x2];
+		d[0]=1.0/x2;
+		d[1]=-y/x2;
+		d[3]=-1.0/sqr(x2);
+		d[4]=2.0*y/sqr(x2);
+		break;
+	}
+	case CF::MAX:
+	case CF::MIN: {
+		const Interval& x2=r[c.x2];
+		// x1 is the max (resp. min) on the whole box
+		bool first =c.op==CF::MAX? x1.lb()>x2.ub() : x1.ub()<x2.lb();
+		bool second=c.op==CF::MAX? x2.lb()>x1.ub() : x2.ub()<x1.lb();
+		if (first)       d[0]=1;
+		else if (second) d[1]=1;
+		else {
+			d[0]=d[1]=Interval(0,1);
+			d[2]=d[3]=d[4]=Interval::ALL_REALS;
+		}
+		break;
+	}
+	case CF::ATAN2: {
+		const Interval& x2=r[c.x2];
+		Interval u=sqr(x1)+sqr(x2);
+		Interval u2=sqr(u);
+		d[0]=x2/u;
+		d[1]=-x1/u;
+		d[2]=-2.0*x1*x2/u2;
+		d[3]=(sqr(x1)-sqr(x2))/u2;
+		d[4]=2.0*x1*x2/u2;
+		break;
+	}
+	case CF::MINUS: d[0]=-1; break;
+	case CF::SIGN:
+		if (x1.contains(0)) { d[0]=Interval::POS_REALS; d[2]=Interval::ALL_REALS; }
+		break;
+	case CF::ABS:
+		if (x1.lb()>=0)      d[0]=1;
+		else if (x1.ub()<=0) d[0]=-1;
+		else { d[0]=Interval(-1,1); d[2]=Interval::ALL_REALS; }
+		break;
+	case CF::POWER: d[0]=c.x2*pow(x1,c.x2-1); d[2]=c.x2*(c.x2-1)*pow(x1,c.x2-2); break;
+	case CF::SQR:   d[0]=2.0*x1; d[2]=2; break;
+	case CF::SQRT:  d[0]=0.5/y; d[2]=-0.25/(x1*y); break;
+	case CF::EXP:   d[0]=y; d[2]=y; break;
+	case CF::LOG:   d[0]=1.0/x1; d[2]=-1.0/sqr(x1); break;
+	case CF::COS:   d[0]=-sin(x1); d[2]=-y; break;
+	case CF::SIN:   d[0]=cos(x1); d[2]=-y; break;
+	case CF::TAN:   d[0]=1.0+sqr(y); d[2]=2.0*y*d[0]; break;
+	case CF::COSH:  d[0]=sinh(x1); d[2]=y; break;
+	case CF::SINH:  d[0]=cosh(x1); d[2]=y; break;
+	case CF::TANH:  d[0]=1.0-sqr(y); d[2]=-2.0*y*d[0]; break;
+	case CF::ACOS: {
+		Interval u=1.0-sqr(x1);
+		d[0]=-1.0/sqrt(u);
+		d[2]=d[0]*x1/u;
+		break;
+	}
+	case CF::ASIN: {
+		Interval u=1.0-sqr(x1);
+		d[0]=1.0/sqrt(u);
+		d[2]=d[0]*x1/u;
+		break;
+	}
+	case CF::ATAN: {
+		Interval u=1.0+sqr(x1);
+		d[0]=1.0/u;
+		d[2]=-2.0*x1/sqr(u);
+		break;
+	}
+	case CF::ACOSH: {
+		Interval u=sqr(x1)-1.0;
+		d[0]=1.0/sqrt(u);
+		d[2]=-d[0]*x1/u;
+		break;
+	}
+	case CF::ASINH: {
+		Interval u=1.0+sqr(x1);
+		d[0]=1.0/sqrt(u);
+		d[2]=-d[0]*x1/u;
+		break;
+	}
+	case CF::ATANH: {
+		Interval u=1.0-sqr(x1);
+		d[0]=1.0/u;
+		d[2]=2.0*x1/sqr(u);
+		break;
+	}
+	default: assert(false); break;
+	}
+}
+
+void Tape::backward_adj(const Instr& c, const Interval* r, Interval* g) const {
+	const Interval& gy=g[c.y];
+	const Interval& x1=r[c.x1];
+	Interval& g1=g[c.x1];
+
+	switch (c.op) {
+	case CF::VEC:   g1+=gy; break;
+	case CF::ADD:   g1+=gy; g[c.x2]+=gy; break;
+	case CF::MUL:   g1+=gy*r[c.x2]; g[c.x2]+=gy*x1; break;
+	case CF::SUB:   g1+=gy; g[c.x2]+=-gy; break;
+	case CF::DIV:   g1+=gy/r[c.x2]; g[c.x2]+=gy*(-x1)/sqr(r[c.x2]); break;
+	case CF::MAX: {
+		const Interval& x2=r[c.x2];
+		if (x1.lb()>x2.ub())      g1+=gy;
+		else if (x2.lb()>x1.ub()) g[c.x2]+=gy;
+		else { g1+=gy*Interval(0,1); g[c.x2]+=gy*Interval(0,1); }
+		break;
+	}
+	case CF::MIN: {
+		const Interval& x2=r[c.x2];
+		if (x1.ub()<x2.lb())      g1+=gy;
+		else if (x2.ub()<x1.lb()) g[c.x2]+=gy;
+		else { g1+=gy*Interval(0,1); g[c.x2]+=gy*Interval(0,1); }
+		break;
+	}
+	case CF::ATAN2: {
+		const Interval& x2=r[c.x2];
+		Interval d=sqr(x1)+sqr(x2);
+		g1+=gy*x2/d;
+		g[c.x2]+=gy*(-x1)/d;
+		break;
+	}
+	case CF::MINUS: g1+=-1.0*gy; break;
+	case CF::SIGN:  if (x1.contains(0)) g1+=gy*Interval::POS_REALS; break;
+	case CF::ABS:
+		if (x1.lb()>=0)      g1+=gy;
+		else if (x1.ub()<=0) g1+=-1.0*gy;
+		else                 g1+=Interval(-1,1)*gy;
+		break;
+	case CF::POWER: g1+=gy*c.x2*pow(x1,c.x2-1); break;
+	case CF::SQR:   g1+=gy*2.0*x1; break;
+	case CF::SQRT:  g1+=gy*0.5/sqrt(x1); break;
+	case CF::EXP:   g1+=gy*exp(x1); break;
+	case CF::LOG:   g1+=gy/x1; break;
+	case CF::COS:   g1+=gy*-sin(x1); break;
+	case CF::SIN:   g1+=gy*cos(x1); break;
+	case CF::TAN:   g1+=gy*(1.0+sqr(tan(x1))); break;
+	case CF::COSH:  g1+=gy*sinh(x1); break;
+	case CF::SINH:  g1+=gy*cosh(x1); break;
+	case CF::TANH:  g1+=gy*(1.0-sqr(tanh(x1))); break;
+	case CF::ACOS:  g1+=gy*-1.0/sqrt(1.0-sqr(x1)); break;
+	case CF::ASIN:  g1+=gy*1.0/sqrt(1.0-sqr(x1)); break;
+	case CF::ATAN:  g1+=gy*1.0/(1.0+sqr(x1)); break;
+	case CF::ACOSH: g1+=gy*1.0/sqrt(sqr(x1)-1.0); break;
+	case CF::ASINH: g1+=gy*1.0/sqrt(1.0+sqr(x1)); break;
+	case CF::ATANH: g1+=gy*1.0/(1.0-sqr(x1)); break;
+	default: assert(false); break;
+	}
+}
+
+void Tape::generate(ostream& os) const {
+	os << "// Generated by ibex: do not edit\n"
+	   << "#include \"ibex_Interval.h\"\n"
+	   << "#include <cmath>\n\n"
+	   << "using namespace ibex;\n\n";
+
+	// the constants are calculated once, when the code is loaded
+	if (nb_cst>0) {
+		os << "static const Interval cst[" << nb_cst << "]={\n";
+		for (int i=0; i<nb_cst; i++) {
+			os << '\t';
+			if (cst[i].is_empty())
+				os << "Interval::EMPTY_SET";
+			else
+				os << "Interval(" << literal(cst[i].lb()) << ',' << literal(cst[i].ub()) << ')';
+			os << (i<nb_cst-1? ",\n" : "\n");
+		}
+		os << "};\n\n";
+	}
+
+	os << "extern \"C\" {\n\n";
+
+	// ------------------------------- forward -------------------------------
+	os << "bool ibex_forward(Interval* r) {\n";
+
+	for (int i=0; i<nb_cst; i++)
+		os << '\t' << reg("r",nb_var+i) << '=' << reg("cst",i) << ";\n";
+
+	for (const Instr* c=code; c<code+size; c++) {
+		string y=reg("r",c->y);
+		string x1=reg("r",c->x1);
+		string x2=reg("r",c->x2);
+		// operators that may return the empty set
+		const char* partial=NULL;
+
+		os << '\t';
+		switch (c->op) {
+		case CF::VEC:   os << y << '=' << x1; break;
+		case CF::ADD:   os << y << '=' << x1 << '+' << x2; break;
+		case CF::MUL:   os << y << '=' << x1 << '*' << x2; break;
+		case CF::SUB:   os << y << '=' << x1 << '-' << x2; break;
+		case CF::DIV:   os << y << '=' << x1 << '/' << x2; break;
+		case CF::MAX:   os << y << "=max(" << x1 << ',' << x2 << ')'; break;
+		case CF::MIN:   os << y << "=min(" << x1 << ',' << x2 << ')'; break;
+		case CF::ATAN2: os << y << "=atan2(" << x1 << ',' << x2 << ')'; break;
+		case CF::MINUS: os << y << "=-" << x1; break;
+		case CF::SIGN:  os << y << "=sign(" << x1 << ')'; break;
+		case CF::ABS:   os << y << "=abs(" << x1 << ')'; break;
+		case CF::POWER: os << y << "=pow(" << x1 << ',' << c->x2 << ')'; break;
+		case CF::SQR:   os << y << "=sqr(" << x1 << ')'; break;
+		case CF::SQRT:  partial="sqrt"; break;
+		case CF::EXP:   os << y << "=exp(" << x1 << ')'; break;
+		case CF::LOG:   partial="log"; break;
+		case CF::COS:   os << y << "=cos(" << x1 << ')'; break;
+		case CF::SIN:   os << y << "=sin(" << x1 << ')'; break;
+		case CF::TAN:   partial="tan"; break;
+		case CF::COSH:  os << y << "=cosh(" << x1 << ')'; break;
+		case CF::SINH:  os << y << "=sinh(" << x1 << ')'; break;
+		case CF::TANH:  os << y << "=tanh(" << x1 << ')'; break;
+		case CF::ACOS:  partial="acos"; break;
+		case CF::ASIN:  partial="asin"; break;
+		case CF::ATAN:  os << y << "=atan(" << x1 << ')'; break;
+		case CF::ACOSH: partial="acosh"; break;
+		case CF::ASINH: os << y << "=asinh(" << x1 << ')'; break;
+		case CF::ATANH: partial="atanh"; break;
+		default: assert(false); break;
+		}
+		if (partial)
+			os << "if ((" << y << '=' << partial << '(' << x1 << ")).is_empty()) return false";
+		os << ";\n";
+	}
+	os << "\treturn true;\n}\n\n";
+
+	// ------------------------------- backward -------------------------------
+	os << "bool ibex_backward(Interval* r) {\n";
+
+	for (const Instr* c=code+size-1; c>=code; c--) {
+		string y=reg("r",c->y);
+		string x1=reg("r",c->x1);
+		string x2=reg("r",c->x2);
+
+		os << "\tif (!";
+		switch (c->op) {
+		case CF::VEC:   os << "!(" << x1 << "&=" << y << ").is_empty()"; break;
+		case CF::ADD:   os << "bwd_add(" << y << ',' << x1 << ',' << x2 << ')'; break;
+		case CF::MUL:   os << "bwd_mul(" << y << ',' << x1 << ',' << x2 << ')'; break;
+		case CF::SUB:   os << "bwd_sub(" << y << ',' << x1 << ',' << x2 << ')'; break;
+		case CF::DIV:   os << "bwd_div(" << y << ',' << x1 << ',' << x2 << ')'; break;
+		case CF::MAX:   os << "bwd_max(" << y << ',' << x1 << ',' << x2 << ')'; break;
+		case CF::MIN:   os << "bwd_min(" << y << ',' << x1 << ',' << x2 << ')'; break;
+		case CF::ATAN2: os << "bwd_atan2(" << y << ',' << x1 << ',' << x2 << ')'; break;
+		case CF::MINUS: os << "!(" << x1 << "&=-" << y << ").is_empty()"; break;
+		case CF::SIGN:  os << "bwd_sign(" << y << ',' << x1 << ')'; break;
+		case CF::ABS:   os << "bwd_abs(" << y << ',' << x1 << ')'; break;
+		case CF::POWER: os << "bwd_pow(" << y << ',' << c->x2 << ',' << x1 << ')'; break;
+		case CF::SQR:   os << "bwd_sqr(" << y << ',' << x1 << ')'; break;
+		case CF::SQRT:  os << "bwd_sqrt(" << y << ',' << x1 << ')'; break;
+		case CF::EXP:   os << "bwd_exp(" << y << ',' << x1 << ')'; break;
+		case CF::LOG:   os << "bwd_log(" << y << ',' << x1 << ')'; break;
+		case CF::COS:   os << "bwd_cos(" << y << ',' << x1 << ')'; break;
+		case CF::SIN:   os << "bwd_sin(" << y << ',' << x1 << ')'; break;
+		case CF::TAN:   os << "bwd_tan(" << y << ',' << x1 << ')'; break;
+		case CF::COSH:  os << "bwd_cosh(" << y << ',' << x1 << ')'; break;
+		case CF::SINH:  os << "bwd_sinh(" << y << ',' << x1 << ')'; break;
+		case CF::TANH:  os << "bwd_tanh(" << y << ',' << x1 << ')'; break;
+		case CF::ACOS:  os << "bwd_acos(" << y << ',' << x1 << ')'; break;
+		case CF::ASIN:  os << "bwd_asin(" << y << ',' << x1 << ')'; break;
+		case CF::ATAN:  os << "bwd_atan(" << y << ',' << x1 << ')'; break;
+		case CF::ACOSH: os << "bwd_acosh(" << y << ',' << x1 << ')'; break;
+		case CF::ASINH: os << "bwd_asinh(" << y << ',' << x1 << ')'; break;
+		case CF::ATANH: os << "bwd_atanh(" << y << ',' << x1 << ')'; break;
+		default: assert(false); break;
+		}
+		os << ") return false;\n";
+	}
+	os << "\treturn true;\n}\n\n";
+
+	// ------------------------------- jacobian -------------------------------
+	// J is stored row by row. Same algorithm as jacobian(const Interval*, Interval*, IntervalMatrix&) const.
+	os << "void ibex_jacobian(const Interval* r, Interval* g, Interval* J) {\n"
+	   << "\tfor (int i=0; i<" << nb_regs << "; i++) g[i]=Interval::ZERO;\n";
+
+	for (int k=0; k<root_size; k++) {
+		const int* first=cone+cone_start[k];
+		const int* last=cone+cone_start[k+1];
+
+		os << "\n\t// component " << k << "\n"
+		   << '\t' << reg("g",root+k) << "=Interval::ONE;\n";
+
+		for (const int* i=first; i<last; i++) {
+			const Instr& c=code[*i];
+			string gy=reg("g",c.y);
+			string g1=reg("g",c.x1);
+			string g2=reg("g",c.x2);
+			string x1=reg("r",c.x1);
+			string x2=reg("r",c.x2);
+
+			os << '\t';
+			switch (c.op) {
+			case CF::VEC:   os << g1 << "+=" << gy; break;
+			case CF::ADD:   os << g1 << "+=" << gy << "; " << g2 << "+=" << gy; break;
+			case CF::MUL:   os << g1 << "+=" << gy << '*' << x2 << "; " << g2 << "+=" << gy << '*' << x1; break;
+			case CF::SUB:   os << g1 << "+=" << gy << "; " << g2 << "+=-" << gy; break;
+			case CF::DIV:   os << g1 << "+=" << gy << '/' << x2 << "; " << g2 << "+=" << gy << "*(-" << x1 << ")/sqr(" << x2 << ')'; break;
+			case CF::MAX:
+				os << "if (" << x1 << ".lb()>" << x2 << ".ub()) " << g1 << "+=" << gy
+				   << "; else if (" << x2 << ".lb()>" << x1 << ".ub()) " << g2 << "+=" << gy
+				   << "; else { " << g1 << "+=" << gy << "*Interval(0,1); " << g2 << "+=" << gy << "*Interval(0,1); }";
+				break;
+			case CF::MIN:
+				os << "if (" << x1 << ".ub()<" << x2 << ".lb()) " << g1 << "+=" << gy
+				   << "; else if (" << x2 << ".ub()<" << x1 << ".lb()) " << g2 << "+=" << gy
+				   << "; else { " << g1 << "+=" << gy << "*Interval(0,1); " << g2 << "+=" << gy << "*Interval(0,1); }";
+				break;
+			case CF::ATAN2:
+				os << "{ Interval d=sqr(" << x1 << ")+sqr(" << x2 << "); "
+				   << g1 << "+=" << gy << '*' << x2 << "/d; " << g2 << "+=" << gy << "*(-" << x1 << ")/d; }";
+				break;
+			case CF::MINUS: os << g1 << "+=-1.0*" << gy; break;
+			case CF::SIGN:  os << "if (" << x1 << ".contains(0)) " << g1 << "+=" << gy << "*Interval::POS_REALS"; break;
+			case CF::ABS:
+				os << "if (" << x1 << ".lb()>=0) " << g1 << "+=" << gy
+				   << "; else if (" << x1 << ".ub()<=0) " << g1 << "+=-1.0*" << gy
+				   << "; else " << g1 << "+=Interval(-1,1)*" << gy;
+				break;
+			case CF::POWER: os << g1 << "+=" << gy << '*' << c.x2 << "*pow(" << x1 << ',' << c.x2-1 << ')'; break;
+			case CF::SQR:   os << g1 << "+=" << gy << "*2.0*" << x1; break;
+			case CF::SQRT:  os << g1 << "+=" << gy << "*0.5/sqrt(" << x1 << ')'; break;
+			case CF::EXP:   os << g1 << "+=" << gy << "*exp(" << x1 << ')'; break;
+			case CF::LOG:   os << g1 << "+=" << gy << '/' << x1; break;
+			case CF::COS:   os << g1 << "+=" << gy << "*-sin(" << x1 << ')'; break;
+			case CF::SIN:   os << g1 << "+=" << gy << "*cos(" << x1 << ')'; break;
+			case CF::TAN:   os << g1 << "+=" << gy << "*(1.0+sqr(tan(" << x1 << ")))"; break;
+			case CF::COSH:  os << g1 << "+=" << gy << "*sinh(" << x1 << ')'; break;
+			case CF::SINH:  os << g1 << "+=" << gy << "*cosh(" << x1 << ')'; break;
+			case CF::TANH:  os << g1 << "+=" << gy << "*(1.0-sqr(tanh(" << x1 << ")))"; break;
+			case CF::ACOS:  os << g1 << "+=" << gy << "*-1.0/sqrt(1.0-sqr(" << x1 << "))"; break;
+			case CF::ASIN:  os << g1 << "+=" << gy << "*1.0/sqrt(1.0-sqr(" << x1 << "))"; break;
+			case CF::ATAN:  os << g1 << "+=" << gy << "*1.0/(1.0+sqr(" << x1 << "))"; break;
+			case CF::ACOSH: os << g1 << "+=" << gy << "*1.0/sqrt(sqr(" << x1 << ")-1.0)"; break;
+			case CF::ASINH: os << g1 << "+=" << gy << "*1.0/sqrt(1.0+sqr(" << x1 << "))"; break;
+			case CF::ATANH: os << g1 << "+=" << gy << "*1.0/(1.0-sqr(" << x1 << "))"; break;
+			default: assert(false); break;
+			}
+			os << ";\n";
+		}
+
+		for (int i=0; i<nb_var; i++)
+			os << '\t' << reg("J",k*nb_var+i) << '=' << reg("g",i) << "; " << reg("g",i) << "=Interval::ZERO;\n";
+
+		// reset the adjoints for the next component
+		if (k<root_size-1) {
+			os << '\t' << reg("g",root+k) << "=Interval::ZERO;\n";
+			for (const int* i=first; i<last; i++) {
+				const Instr& c=code[*i];
+				os << '\t' << reg("g",c.y) << '=' << reg("g",c.x1) << "=Interval::ZERO;";
+				if (binary(c.op)) os << ' ' << reg("g",c.x2) << "=Interval::ZERO;";
+				os << '\n';
+			}
+		}
+	}
+	os << "}\n\n} // extern \"C\"\n";
+}
+
+void Tape::load(const Vector& x, double* r) const {
+	assert(x.size()==nb_var);
+	for (int i=0; i<nb_var; i++) r[i]=x[i];
+}
+
+void Tape::forward(double* r) const {
+
+	for (int i=0; i<nb_cst; i++) r[nb_var+i]=cst[i].mid();
+
+	// note: the functions of the global namespace are called explicitly
+	// (the ones of ibex apply to intervals)
+	for (const Instr* c=code; c<code+size; c++) {
+		double& y=r[c->y];
+		const double x1=r[c->x1];
+
+		switch (c->op) {
+		case CF::VEC:    y=x1;                             break;
+		case CF::ADD:    y=x1+r[c->x2];                    break;
+		case CF::MUL:    y=x1*r[c->x2];                    break;
+		case CF::SUB:    y=x1-r[c->x2];                    break;
+		case CF::DIV:    y=x1/r[c->x2];                    break;
+		case CF::MAX:    y=x1>=r[c->x2]? x1 : r[c->x2];    break;
+		case CF::MIN:    y=x1<=r[c->x2]? x1 : r[c->x2];    break;
+		case CF::ATAN2:  y=::atan2(x1,r[c->x2]);           break;
+		case CF::MINUS:  y=-x1;                            break;
+		case CF::SIGN:   y=x1>0? 1 : (x1<0? -1 : 0);       break;
+		case CF::ABS:    y=::fabs(x1);                     break;
+		case CF::POWER:  y=::pow(x1,(double) c->x2);       break;
+		case CF::SQR:    y=x1*x1;                          break;
+		case CF::SQRT:   y=::sqrt(x1);                     break;
+		case CF::EXP:    y=::exp(x1);                      break;
+		case CF::LOG:    y=::log(x1);                      break;
+		case CF::COS:    y=::cos(x1);                      break;
+		case CF::SIN:    y=::sin(x1);                      break;
+		case CF::TAN:    y=::tan(x1);                      break;
+		case CF::COSH:   y=::cosh(x1);                     break;
+		case CF::SINH:   y=::sinh(x1);                     break;
+		case CF::TANH:   y=::tanh(x1);                     break;
+		case CF::ACOS:   y=::acos(x1);                     break;
+		case CF::ASIN:   y=::asin(x1);                     break;
+		case CF::ATAN:   y=::atan(x1);                     break;
+		case CF::ACOSH:  y=::acosh(x1);                    break;
+		case CF::ASINH:  y=::asinh(x1);                    break;
+		case CF::ATANH:  y=::atanh(x1);                    break;
+		default: assert(false); break;
+		}
+	}
+}
+
+void Tape::gradient(const double* r, double* g) const {
+	assert(root_size==1);
+
+	for (int i=0; i<nb_regs; i++) g[i]=0;
+
+	g[root]=1;
+
+	for (const Instr* c=code+size-1; c>=code; c--) {
+		const double gy=g[c->y];
+		const double y=r[c->y];
+		const double x1=r[c->x1];
+		double& g1=g[c->x1];
+
+		switch (c->op) {
+		case CF::VEC:   g1+=gy; break;
+		case CF::ADD:   g1+=gy; g[c->x2]+=gy; break;
+		case CF::MUL:   g1+=gy*r[c->x2]; g[c->x2]+=gy*x1; break;
+		case CF::SUB:   g1+=gy; g[c->x2]-=gy; break;
+		case CF::DIV:   g1+=gy/r[c->x2]; g[c->x2]-=gy*y/r[c->x2]; break;
+		case CF::MAX:   if (x1>=r[c->x2]) g1+=gy; else g[c->x2]+=gy; break;
+		case CF::MIN:   if (x1<=r[c->x2]) g1+=gy; else g[c->x2]+=gy; break;
+		case CF::ATAN2: {
+			const double x2=r[c->x2];
+			const double d=x1*x1+x2*x2;
+			g1+=gy*x2/d;
+			g[c->x2]-=gy*x1/d;
+			break;
+		}
+		case CF::MINUS: g1-=gy; break;
+		case CF::SIGN:  break;
+		case CF::ABS:   if (x1>=0) g1+=gy; else g1-=gy; break;
+		case CF::POWER: g1+=gy*c->x2*::pow(x1,(double) (c->x2-1)); break;
+		case CF::SQR:   g1+=gy*2*x1; break;
+		case CF::SQRT:  g1+=gy*0.5/y; break;
+		case CF::EXP:   g1+=gy*y; break;
+		case CF::LOG:   g1+=gy/x1; break;
+		case CF::COS:   g1-=gy*::sin(x1); break;
+		case CF::SIN:   g1+=gy*::cos(x1); break;
+		case CF::TAN:   g1+=gy*(1+y*y); break;
+		case CF::COSH:  g1+=gy*::sinh(x1); break;
+		case CF::SINH:  g1+=gy*::cosh(x1); break;
+		case CF::TANH:  g1+=gy*(1-y*y); break;
+		case CF::ACOS:  g1-=gy/::sqrt(1-x1*x1); break;
+		case CF::ASIN:  g1+=gy/::sqrt(1-x1*x1); break;
+		case CF::ATAN:  g1+=gy/(1+x1*x1); break;
+		case CF::ACOSH: g1+=gy/::sqrt(x1*x1-1); break;
+		case CF::ASINH: g1+=gy/::sqrt(1+x1*x1); break;
+		case CF::ATANH: g1+=gy/(1-x1*x1); break;
+		default: assert(false); break;
+		}
+	}
+}
+
+Interval& Tape::elem(Domain& d, int k) {
+	switch (d.dim.type()) {
+	case Dim::SCALAR:     return d.i();
+	case Dim::ROW_VECTOR:
+	case Dim::COL_VECTOR: return d.v()[k];
+	default:              return d.m()[k/d.dim.dim3][k%d.dim.dim3];
+	}
+}
+
+const Interval& Tape::elem(const Domain& d, int k) {
+	return elem((Domain&) d,k);
+}
+
+void Tape::read_root(const Interval* r, Domain& d) const {
+	for (int k=0; k<root_size; k++) elem(d,k)=r[root+k];
+}
+
+bool Tape::root_subset(const Interval* r, const Domain& y) const {
+	for (int k=0; k<root_size; k++)
+		if (r[root+k].is_empty() || !r[root+k].is_subset(elem(y,k))) return false;
+	return true;
+}
+
+bool Tape::root_inter(Interval* r, const Domain& y) const {
+	for (int k=0; k<root_size; k++)
+		if ((r[root+k]&=elem(y,k)).is_empty()) return false;
+	return true;
+}
+
+} // end namespace ibex
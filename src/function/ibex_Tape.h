@@ -0,0 +1,346 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Tape.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+// Last Update : Oct 16, 2026
+//============================================================================
+
+#ifndef __IBEX_TAPE_H__
+#define __IBEX_TAPE_H__
+
+#include "ibex_CompiledFunction.h"
+#include "ibex_Domain.h"
+#include "ibex_SparseIntervalMatrix.h"
+
+namespace ibex {
+
+/**
+ * \ingroup symbolic
+ *
+ * \brief Flat (register-based) representation of a function.
+ *
+ * The domain of every scalar node of the DAG is stored in a contiguous
+ * array of intervals (the "registers") and the function is a sequence of
+ * instructions with integer operand indices. The forward, backward (HC4Revise)
+ * and gradient algorithms run over this array without any indirection through
+ * the labels.
+ *
+ * The registers are numbered as follows:
+ * <ul><li> [0,nb_var): the components of the arguments, in the same order as
+ *          in a box passed to #ibex::Function::eval(const IntervalVector&) const.
+ *     <li> [nb_var,nb_var+nb_cst): the components of the constants.
+ *     <li> [nb_var+nb_cst,nb_regs): the results of the operations.
+ * </ul>
+ * The registers of an indexed node (like x[i]) are those of the indexed expression
+ * (no copy). Vectors and matrices are stored row by row.
+ *
+ * Only functions made of scalar operators, constants, symbols, indices and
+ * vectors of scalars (or of rows) can be taped (see #supported(const CompiledFunction&)).
+ * Vector/matrix operators, function applications and the "chi" operator are not.
+ *
+ * The registers are not stored in the tape (which is thread-safe) but in
+ * a #ibex::FunctionWorkspace.
+ */
+class Tape {
+public:
+	/**
+	 * \brief Build the tape of a compiled function.
+	 *
+	 * \param x  - the arguments of the function.
+	 * \pre supported(cf) must be true.
+	 */
+	Tape(const Array<const ExprSymbol>& x, const CompiledFunction& cf);
+
+	/**
+	 * \brief Delete *this.
+	 */
+	~Tape();
+
+	/**
+	 * \brief True if the compiled function can be taped.
+	 */
+	static bool supported(const CompiledFunction& cf);
+
+	/**
+	 * \brief Load a box in the registers of the arguments.
+	 */
+	void load(const IntervalVector& box, Interval* r) const;
+
+	/**
+	 * \brief Read the registers of the arguments into a box.
+	 */
+	void read(const Interval* r, IntervalVector& box) const;
+
+	/**
+	 * \brief Forward evaluation.
+	 *
+	 * The argument registers must be loaded before.
+	 *
+	 * \return false if an intermediate result is empty (e.g., sqrt of
+	 *         negative numbers). The evaluation is then stopped.
+	 */
+	bool forward(Interval* r) const;
+
+	/**
+	 * \brief Incremental forward evaluation.
+	 *
+	 * Same as #forward(Interval*) const but only the instructions that depend
+	 * on a "dirty" register are recalculated. The other registers must contain
+	 * the result of a previous forward evaluation (including the constants).
+	 *
+	 * \param dirty - an array of size nb_regs. In input, the dirty argument registers
+	 *                (the ones that have changed since the previous evaluation); the
+	 *                entries of the constants must be false. In output, the entries of
+	 *                the recalculated registers are set to true, the other ones to false.
+	 * \return false if an intermediate result is empty (the registers
+	 *         are then partially updated).
+	 */
+	bool forward(Interval* r, bool* dirty) const;
+
+	/**
+	 * \brief Forward evaluation over a batch of boxes.
+	 *
+	 * The registers are stored in "structure of arrays" layout: the bounds of the
+	 * k-th register for the j-th box are lb[k*n+j] and ub[k*n+j], where n is the
+	 * size of the batch. An empty interval is represented by lb=+oo and ub=-oo.
+	 * The argument registers must be loaded before (see #load(const Array<const IntervalVector>&, int, int, double*, double*) const).
+	 *
+	 * Each instruction is applied to all the boxes at once. The bounds of +,-,*,/ and sqr
+	 * are calculated in round-to-nearest mode by loops that can be vectorized by the compiler,
+	 * and then rounded outward (see S.M. Rump, P. Zimmermann, S. Boldo and G. Melquiond,
+	 * "Computing predecessor and successor in rounding to nearest", BIT 2009). The result
+	 * may therefore be slightly larger (by one ulp) than with #forward(Interval*) const.
+	 * The other operators and the cases with infinite or empty bounds are calculated with
+	 * #ibex::Interval.
+	 *
+	 * Contrary to #forward(Interval*) const, the evaluation is not stopped: the result
+	 * of an operator that is not defined is simply empty.
+	 */
+	void forward(double* lb, double* ub, int n) const;
+
+	/**
+	 * \brief Load the boxes x[start],...,x[start+n-1] in the registers of the arguments (batch mode).
+	 */
+	void load(const Array<const IntervalVector>& x, int start, int n, double* lb, double* ub) const;
+
+	/**
+	 * \brief Copy the root registers of a batch in the rows start,...,start+n-1 of \a y.
+	 *
+	 * The row of a box where a component of the root is empty is set to the empty set.
+	 */
+	void read_root(const double* lb, const double* ub, int n, IntervalMatrix& y, int start) const;
+
+	/**
+	 * \brief Backward (HC4Revise) contraction.
+	 *
+	 * Projects the domain of each node onto its subexpressions, in the
+	 * reverse order of the forward evaluation.
+	 *
+	 * \pre forward(r) must be called before and the root registers
+	 * intersected with the image.
+	 * \return false if a projection is empty.
+	 */
+	bool backward(Interval* r) const;
+
+	/**
+	 * \brief Gradient (reverse mode).
+	 *
+	 * Set in g[0..nb_var) the gradient of a scalar function.
+	 * The other registers of g are used as adjoints.
+	 *
+	 * \pre forward(r) must be called before.
+	 */
+	void gradient(const Interval* r, Interval* g) const;
+
+	/**
+	 * \brief Jacobian matrix (reverse mode).
+	 *
+	 * Set in the ith row of J the gradient of the ith component of a
+	 * vector-valued function. The forward evaluation is shared by all
+	 * the components and there is one backward sweep per component.
+	 * The registers of g are used as adjoints.
+	 *
+	 * \pre forward(r) must be called before.
+	 */
+	void jacobian(const Interval* r, Interval* g, IntervalMatrix& J) const;
+
+	/**
+	 * \brief Jacobian matrix (reverse mode) in a sparse matrix.
+	 *
+	 * Same as #jacobian(const Interval*, Interval*, IntervalMatrix&) const but only
+	 * the nonzero entries of J are set. The cost of each component is proportional
+	 * to the size of its cone (not to the number of variables).
+	 *
+	 * \pre the structure of J must contain all the variables each component depends on.
+	 */
+	void jacobian(const Interval* r, Interval* g, SparseIntervalMatrix& J) const;
+
+	/**
+	 * \brief Hessian matrix (forward-over-reverse mode).
+	 *
+	 * Set in H the Hessian matrix of a real-valued function. The tangents
+	 * (derivatives of all the registers w.r.t. the arguments) are propagated
+	 * forward, and the adjoints with their tangents backward, in a single
+	 * sweep each. The registers of g are used as adjoints.
+	 *
+	 * At a point where an operator is not twice differentiable (e.g., abs(x)
+	 * with x containing 0), its second derivative is (-oo,+oo).
+	 *
+	 * \pre forward(r) must be called before.
+	 */
+	void hessian(const Interval* r, Interval* g, IntervalMatrix& H) const;
+
+	/**
+	 * \brief Load a point in the registers of the arguments (point mode).
+	 */
+	void load(const Vector& x, double* r) const;
+
+	/**
+	 * \brief Forward evaluation in floating-point arithmetic (point mode).
+	 *
+	 * The registers of the constants are set to their midpoint. The operations
+	 * are performed in the current rounding mode so the result is not rigorous.
+	 * It is NaN (or infinite) outside of the definition domain of the function.
+	 *
+	 * The argument registers must be loaded before.
+	 */
+	void forward(double* r) const;
+
+	/**
+	 * \brief Gradient in floating-point arithmetic (point mode).
+	 *
+	 * Same as #gradient(const Interval*, Interval*) const. At a point where an
+	 * operator is not differentiable (e.g., abs(x) at 0), one of its
+	 * one-sided derivatives is taken.
+	 *
+	 * \pre forward(r) must be called before.
+	 */
+	void gradient(const double* r, double* g) const;
+
+	/**
+	 * \brief Generate the C++ code of the tape.
+	 *
+	 * The code is straight-line (one statement per instruction, with the
+	 * register indices as literals) and calls the operators of #ibex::Interval.
+	 * It defines the following functions, with C linkage, over the same registers
+	 * as the tape:
+	 * <ul><li> bool ibex_forward(Interval* r): same as #forward(Interval*) const.
+	 *     <li> bool ibex_backward(Interval* r): same as #backward(Interval*) const.
+	 *     <li> void ibex_jacobian(const Interval* r, Interval* g, Interval* J):
+	 *          same as #jacobian(const Interval*, Interval*, IntervalMatrix&) const,
+	 *          where J is stored row by row.
+	 * </ul>
+	 * \see #ibex::NativeFunction.
+	 */
+	void generate(std::ostream& os) const;
+
+	/**
+	 * \brief Copy the root registers into a domain.
+	 */
+	void read_root(const Interval* r, Domain& d) const;
+
+	/**
+	 * \brief True if the root registers are included in \a y.
+	 *
+	 * Return false if a root register is empty.
+	 */
+	bool root_subset(const Interval* r, const Domain& y) const;
+
+	/**
+	 * \brief Intersect the root registers with \a y.
+	 *
+	 * Return false if the result is empty.
+	 */
+	bool root_inter(Interval* r, const Domain& y) const;
+
+	/**
+	 * \brief Number of registers.
+	 */
+	const int nb_regs;
+
+	/**
+	 * \brief Number of registers of the arguments.
+	 */
+	const int nb_var;
+
+	/**
+	 * \brief Index of the first register of the root node.
+	 */
+	const int root;
+
+protected:
+	/*
+	 * An instruction.
+	 *
+	 * The result is stored in r[y], the operands in r[x1] and r[x2].
+	 * For POWER, x2 is the exponent. For VEC, the instruction is a copy
+	 * of r[x1] into r[y] (one instruction for each component).
+	 */
+	struct Instr {
+		CompiledFunction::operation op;
+		int y;
+		int x1;
+		int x2;
+	};
+
+	/* propagate the adjoint of the result of an instruction to its operands */
+	void backward_adj(const Instr& c, const Interval* r, Interval* g) const;
+
+	/*
+	 * First and second partial derivatives of the operator of an instruction:
+	 * d[0]=dy/dx1, d[1]=dy/dx2, d[2]=d2y/dx1^2, d[3]=d2y/dx1dx2, d[4]=d2y/dx2^2
+	 * (the derivatives w.r.t. x2 are zero for a unary operator).
+	 */
+	static void derivatives(const Instr& c, const Interval* r, Interval* d);
+
+	/* true if the second derivatives of the operator are zero */
+	static bool linear(CompiledFunction::operation op);
+
+	/* calculate the supports of the tangents for the Hessian */
+	void init_hessian();
+
+	/* calculate the result of an instruction (false if empty) */
+	static bool eval(const Instr& c, Interval* r);
+
+	/* true if x2 is a register (binary operator) */
+	static bool binary(CompiledFunction::operation op);
+
+	/* result of an instruction calculated with Interval (may be empty) */
+	static Interval apply(const Instr& c, const Interval& x1, const Interval& x2);
+
+	/* k^th component of a domain (row by row) */
+	static Interval& elem(Domain& d, int k);
+	static const Interval& elem(const Domain& d, int k);
+
+	int size;        // number of instructions
+	Instr* code;     // instructions
+
+	int nb_cst;      // number of registers of the constants
+	Interval* cst;   // values of the constants
+	int root_size;   // number of registers of the root node
+
+	// The cone of the kth component of the root: the instructions
+	// it depends on, in reverse order, are cone[cone_start[k]],...,
+	// cone[cone_start[k+1]-1].
+	int* cone_start;
+	int* cone;
+
+	// Supports for the Hessian (only for a real-valued function, NULL otherwise):
+	// the arguments the ith register depends on are supp[supp_start[i]],...,
+	// supp[supp_start[i+1]-1] (in increasing order). Same with asupp for the
+	// derivatives of the adjoint of the ith register.
+	int* supp_start;
+	int* supp;
+	int* asupp_start;
+	int* asupp;
+
+private:
+	Tape(const Tape&); // forbidden
+};
+
+} // end namespace ibex
+
+#endif // __IBEX_TAPE_H__
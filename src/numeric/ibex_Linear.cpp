@@ -263,6 +263,24 @@ void precond(IntervalMatrix& A, IntervalVector& b) {
 	b = C*b;
 }
 
+void precond(SparseIntervalMatrix& A, IntervalVector& b) {
+	int n=(A.nb_rows());
+	assert(n == A.nb_cols());
+	assert(n == b.size());
+
+	Matrix C(n,n);
+	try { real_inverse(A.mid(), C); }
+	catch (SingularMatrixException&) {
+		try { real_inverse(A.lb(), C); }
+		catch (SingularMatrixException&) {
+			real_inverse(A.ub(), C);
+		}
+	}
+
+	A = sparse_mul(C,A);
+	b = C*b;
+}
+
 // static void lu_interval(IntervalMatrix& A, int i, int n, Interval& det) {
 
 //   if (i==n) {
@@ -311,6 +329,40 @@ void gauss_seidel(const IntervalMatrix& A, const IntervalVector& b, IntervalVect
 	} while (red >= ratio);
 }
 
+void gauss_seidel(const SparseIntervalMatrix& A, const IntervalVector& b, IntervalVector& x, double ratio) {
+	int n=(A.nb_rows());
+	assert(n == (A.nb_cols()));
+	assert(n == (x.size()) && n == (b.size()));
+
+	// index of the diagonal entries (-1 if 0)
+	int* diag=new int[n];
+	for (int i=0; i<n; i++) diag[i]=A.index(i,i);
+
+	double red;
+	Interval old, proj, tmp;
+
+	do {
+		red = 0;
+		for (int i=0; i<n; i++) {
+			old = x[i];
+			proj = b[i];
+
+			for (int k=A.row_start(i); k<A.row_start(i+1); k++)
+				if (k!=diag[i]) proj -= A.val(k)*x[A.col(k)];
+			tmp = diag[i]==-1 ? Interval::ZERO : A.val(diag[i]);
+
+			bwd_mul(proj,tmp,x[i]);
+
+			if (x[i].is_empty()) { x.set_empty(); delete[] diag; return; }
+
+			double gain=old.rel_distance(x[i]);
+			if (gain>red) red=gain;
+		}
+	} while (red >= ratio);
+
+	delete[] diag;
+}
+
 bool inflating_gauss_seidel(const IntervalMatrix& A, const IntervalVector& b, IntervalVector& x, double min_dist, double mu_max) {
 	int n=(A.nb_rows());
 	assert(n == (A.nb_cols()));
@@ -12,6 +12,7 @@
 #define __IBEX_LINEAR_H__
 
 #include "ibex_IntervalMatrix.h"
+#include "ibex_SparseIntervalMatrix.h"
 #include "ibex_LinearException.h"
 
 /** \file */
@@ -118,6 +119,25 @@ void precond(IntervalMatrix& A, IntervalVector& b);
  *
  */
 void precond(IntervalMatrix& A);
+
+/**
+ * \ingroup numeric
+ *
+ * \brief Preconditions the sparse system \f$[A]x=[b]\f$.
+ *
+ * Same as #precond(IntervalMatrix&, IntervalVector&), except that the product
+ * \f$C^{-1}[A]\f$ is calculated with the nonzero entries of [A] only and stored
+ * directly in sparse form (see #sparse_mul(const Matrix&, const SparseIntervalMatrix&)).
+ * The structure of [A] is replaced by the one of \f$C^{-1}[A]\f$ (the entries that are
+ * exactly 0 are dropped, e.g., if the system is made of independent blocks).
+ *
+ * Note: \f$C^{-1}\f$ is a dense (n x n) real matrix and the preconditioned matrix is
+ * generally dense on the nonzero columns of [A].
+ *
+ * \throw SingularMatrixException if no real matrix extracted from [A] could be inversed successfully.
+ */
+void precond(SparseIntervalMatrix& A, IntervalVector& b);
+
 /**
  * \ingroup numeric
  *
@@ -138,6 +158,16 @@ void precond(IntervalMatrix& A);
  */
 void gauss_seidel(const IntervalMatrix& A, const IntervalVector& b, IntervalVector& x, double ratio=0.01);
 
+/**
+ * \ingroup numeric
+ *
+ * \brief Gauss-Seidel algorithm (sparse matrix).
+ *
+ * Same as #gauss_seidel(const IntervalMatrix&, const IntervalVector&, IntervalVector&, double)
+ * but each iteration only visits the nonzero entries of [A].
+ */
+void gauss_seidel(const SparseIntervalMatrix& A, const IntervalVector& b, IntervalVector& x, double ratio=0.01);
+
 /*
  * \ingroup numeric
  *
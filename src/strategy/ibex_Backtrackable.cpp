@@ -9,7 +9,22 @@
 //============================================================================
 
 #include "ibex_Backtrackable.h"
+#include "ibex_Exception.h"
 
 namespace ibex {
 
+int Backtrackable::_nb_slots=0;
+
+int Backtrackable::new_slot() {
+	return __sync_fetch_and_add(&_nb_slots,1);
+}
+
+void Backtrackable::write(std::ostream&) const {
+	ibex_error("Backtrackable: this data cannot be saved");
+}
+
+void Backtrackable::read(std::istream&) {
+	ibex_error("Backtrackable: this data cannot be restored");
+}
+
 } // end namespace ibex
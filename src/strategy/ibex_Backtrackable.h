@@ -11,7 +11,9 @@
 #ifndef __IBEX_BACKTRACKABLE_H__
 #define __IBEX_BACKTRACKABLE_H__
 
+#include "ibex_CellArena.h"
 #include <utility>
+#include <iostream>
 
 namespace ibex {
 
@@ -49,8 +51,77 @@ public:
 	 * \brief Delete *this.
 	 */
 	virtual ~Backtrackable() { }
+
+	/**
+	 * \brief Write the data into a binary stream.
+	 *
+	 * Used to save the state of a search (see #ibex::Optimizer::save(const char*)).
+	 * By default, raise an error (the data cannot be saved).
+	 */
+	virtual void write(std::ostream& os) const;
+
+	/**
+	 * \brief Read the data from a binary stream.
+	 *
+	 * Read what #write(std::ostream&) const has written. The data
+	 * has been created by #down() from the data of a root cell.
+	 * By default, raise an error (the data cannot be restored).
+	 */
+	virtual void read(std::istream& is);
+
+	/**
+	 * \brief Slot of the class \a T.
+	 *
+	 * Each subclass of Backtrackable is given a distinct integer the first time
+	 * its slot is requested. Slots are dense (0, 1, 2, ...) so that the data of
+	 * a cell can be stored in an array (see #ibex::Cell::get()).
+	 *
+	 * \pre Class \a T is a subclass of #ibex::Backtrackable.
+	 */
+	template<typename T>
+	static int slot();
+
+	/**
+	 * \brief Number of slots given so far.
+	 */
+	static int nb_slots();
+
+	/**
+	 * \brief Allocate data in the active arena (see #ibex::CellArena::alloc(size_t)).
+	 *
+	 * The data of the subcells created by #down() are therefore
+	 * allocated in the same arena as the subcells themselves.
+	 */
+	static void* operator new(size_t size) {
+		return CellArena::alloc(size);
+	}
+
+	/**
+	 * \brief Free the memory of data.
+	 */
+	static void operator delete(void* p) {
+		CellArena::free(p);
+	}
+
+private:
+	static int new_slot();
+
+	static int _nb_slots;
 };
 
+/*================================== inline implementations ========================================*/
+
+template<typename T>
+inline int Backtrackable::slot() {
+	// note: the initialization of a local static is thread-safe with gcc
+	static const int s=new_slot();
+	return s;
+}
+
+inline int Backtrackable::nb_slots() {
+	return _nb_slots;
+}
+
 } // end namespace ibex
 
 #endif // __IBEX_BACKTRACKABLE_H__
@@ -9,27 +9,131 @@
 //============================================================================
 
 #include "ibex_Cell.h"
+#include "ibex_Exception.h"
+
+#include <new>
 
 namespace ibex {
- Cell::Cell(const IntervalVector& box) : box(box){
 
+Cell::Cell(const IntervalVector& box) : data(NULL), nb_data(0), arena(CellArena::current()) {
+	int n=box.size();
+	if (n<=IntervalVector::INLINE_SIZE) {
+		// the box is stored inside the cell
+		this->box.resize(n);
+		this->box=box;
+	} else {
+		// the box is stored in the arena
+		this->box.vec=(Interval*) CellArena::alloc(n*sizeof(Interval));
+		this->box.n=n;
+		this->box.borrowed=true;
+		for (int i=0; i<n; i++)
+			new (&this->box.vec[i]) Interval(box[i]);
+	}
 }
 
 std::pair<Cell*,Cell*> Cell::bisect(const IntervalVector& left, const IntervalVector& right) {
+	CellArena::Scope scope(arena);
 	Cell* cleft = new Cell(left);
 	Cell* cright = new Cell(right);
-	for (IBEXMAP(Backtrackable*)::iterator it=data.begin(); it!=data.end(); it++) {
-		std::pair<Backtrackable*,Backtrackable*> child_data=it->second->down();
-		cleft->data.insert_new(it->first,child_data.first);
-		cright->data.insert_new(it->first,child_data.second);
-	}
+	down(*cleft,*cright);
 	return std::pair<Cell*,Cell*>(cleft,cright);
 }
 
-Cell::~Cell() {
-	for (IBEXMAP(Backtrackable*)::iterator it=data.begin(); it!=data.end(); it++)
-		delete it->second;
+Cell* Cell::spawn(const IntervalVector& box) {
+	std::pair<Cell*,Cell*> cells=bisect(box,box);
+	delete cells.second;
+	return cells.first;
+}
+
+/*
+ * Format (binary):
+ * - the size n of the box (int) followed by n intervals (2n doubles)
+ * - the number of backtrackable data (int), then, for each data, its
+ *   slot (int) followed by what Backtrackable::write has written.
+ */
+void Cell::write(std::ostream& os) const {
+	int n=box.size();
+	os.write((char*) &n, sizeof(int));
+	for (int i=0; i<n; i++) {
+		double lb=box[i].lb();
+		double ub=box[i].ub();
+		os.write((char*) &lb, sizeof(double));
+		os.write((char*) &ub, sizeof(double));
+	}
+
+	int nb=0;
+	for (int j=0; j<nb_data; j++)
+		if (data[j]) nb++;
+	os.write((char*) &nb, sizeof(int));
+
+	for (int j=0; j<nb_data; j++) {
+		if (!data[j]) continue;
+		os.write((char*) &j, sizeof(int));
+		data[j]->write(os);
+	}
 }
 
+void Cell::read(std::istream& is) {
+	int n;
+	is.read((char*) &n, sizeof(int));
+	if (!is || n!=box.size())
+		ibex_error("Cell [read]: the size of the box does not match");
+
+	for (int i=0; i<n; i++) {
+		double lb,ub;
+		is.read((char*) &lb, sizeof(double));
+		is.read((char*) &ub, sizeof(double));
+		box[i]=Interval(lb,ub);
+	}
+
+	int nb;
+	is.read((char*) &nb, sizeof(int));
+	for (int l=0; l<nb && is; l++) {
+		int j;
+		is.read((char*) &j, sizeof(int));
+		if (j<0 || j>=nb_data || !data[j])
+			ibex_error("Cell [read]: backtrackable data missing in the cell");
+		data[j]->read(is);
+	}
+}
+
+void Cell::down(Cell& left, Cell& right) {
+	left.resize_data(nb_data);
+	right.resize_data(nb_data);
+	for (int i=0; i<nb_data; i++) {
+		if (!data[i]) continue;
+		std::pair<Backtrackable*,Backtrackable*> child_data=data[i]->down();
+		left.data[i]=child_data.first;
+		right.data[i]=child_data.second;
+	}
+}
+
+void Cell::resize_data(int n) {
+	if (n<=nb_data) return;
+
+	CellArena::Scope scope(arena);
+	Backtrackable** new_data=(Backtrackable**) CellArena::alloc(n*sizeof(Backtrackable*));
+	int i=0;
+	for (; i<nb_data; i++) new_data[i]=data[i];
+	for (; i<n; i++) new_data[i]=NULL;
+
+	CellArena::free(data);
+	data=new_data;
+	nb_data=n;
+}
+
+Cell::~Cell() {
+	for (int i=0; i<nb_data; i++)
+		if (data[i]) delete data[i];
+	CellArena::free(data);
+
+	if (box.borrowed) { // otherwise, destroyed with the box
+		for (int i=0; i<box.n; i++)
+			box.vec[i].~Interval();
+		CellArena::free(box.vec);
+		box.vec=NULL;
+		box.n=0;
+	}
+}
 
 } // end namespace ibex
@@ -13,8 +13,8 @@
 
 #include "ibex_IntervalVector.h"
 #include "ibex_Backtrackable.h"
-#include "ibex_SymbolMap.h"
-#include <typeinfo>
+#include "ibex_CellArena.h"
+#include <cassert>
 
 namespace ibex {
 
@@ -36,6 +36,13 @@ namespace ibex {
  *
  * The amount of information contained in a cell can be arbitrarily augmented thanks to the
  * "data registration" technique (see #ibex::Contractor::require()).
+ *
+ * A cell, its box and its data are allocated in the active arena of the thread at
+ * construction (see #ibex::CellArena) and the subcells are allocated in the same arena
+ * (a small box is stored inside the cell, see #ibex::IntervalVector::INLINE_SIZE).
+ * A box stored in the arena is not owned by the IntervalVector #box: resizing it
+ * throws an exception (see #ibex::IntervalVector::resize(int)) and moving it copies
+ * the components.
  */
 class Cell {
 public:
@@ -61,10 +68,46 @@ public:
 	 */
 	std::pair<Cell*,Cell*> bisect(const IntervalVector& left, const IntervalVector& right);
 
+	/**
+	 * \brief Create a cell of the same class with the box \a box.
+	 *
+	 * The data of the new cell are created from the data of this cell
+	 * (see #ibex::Backtrackable::down()). Used to rebuild a cell read
+	 * from a file (see #read(std::istream&)).
+	 */
+	virtual Cell* spawn(const IntervalVector& box);
+
+	/**
+	 * \brief Write the cell into a binary stream.
+	 *
+	 * Write the box and the backtrackable data (see #ibex::Backtrackable::write(std::ostream&) const).
+	 * A subclass writes its own fields in addition.
+	 */
+	virtual void write(std::ostream& os) const;
+
+	/**
+	 * \brief Read the cell from a binary stream.
+	 *
+	 * Read what #write(std::ostream&) const has written. The cell must have been
+	 * created by #spawn(const IntervalVector&) from a cell of the same search,
+	 * so that the box has the right size and the data have the right classes.
+	 */
+	virtual void read(std::istream& is);
+
 	/**
 	 * \brief Delete *this.
 	 */
-	~Cell();
+	virtual ~Cell();
+
+	/**
+	 * \brief Allocate a cell in the active arena (see #ibex::CellArena::alloc(size_t)).
+	 */
+	static void* operator new(size_t size);
+
+	/**
+	 * \brief Free the memory of a cell.
+	 */
+	static void operator delete(void* p);
 
 	/**
 	 * \brief Return true if this cell is the root cell.
@@ -74,53 +117,94 @@ public:
 	/**
 	 * \brief Retrieve backtrackable data from this cell.
 	 *
-	 * The data is identified by its classname.
-	 * \pre Class \a T is a subclass of #ibex::Backtrackable.
+	 * The data is identified by the slot of its class (see #ibex::Backtrackable::slot()).
+	 * \pre Class \a T is a subclass of #ibex::Backtrackable and the data has been added.
 	 */
 	template<typename T>
 	T& get() {
-		return (T&) *data[typeid(T).name()];
+		int s=Backtrackable::slot<T>();
+		assert(s<nb_data && data[s]);
+		return (T&) *data[s];
 	}
 
 	/**
 	 * \brief Retrieve backtrackable data from this cell.
 	 *
-	 * The data is identified by its classname.
-	 * \pre Class \a T is a subclass of #ibex::Backtrackable.
+	 * The data is identified by the slot of its class (see #ibex::Backtrackable::slot()).
+	 * \pre Class \a T is a subclass of #ibex::Backtrackable and the data has been added.
 	 */
 	template<typename T>
 	const T& get() const {
-		return (T&) *data[typeid(T).name()];
+		int s=Backtrackable::slot<T>();
+		assert(s<nb_data && data[s]);
+		return (T&) *data[s];
 	}
 
 	/**
 	 * \brief Add backtrackable data into this cell.
 	 *
-	 * The data is identified by its classname.
+	 * The data is identified by the slot of its class (see #ibex::Backtrackable::slot()).
 	 * \pre Class \a T is a subclass of #ibex::Backtrackable.
 	 */
 	template<typename T>
 	void add() {
-		const char* id=typeid(T).name();
-		if (!data.used(id)) data.insert_new(id,new T());
+		int s=Backtrackable::slot<T>();
+		if (s>=nb_data) resize_data(s+1);
+		if (!data[s]) {
+			CellArena::Scope scope(arena);
+			data[s]=new T();
+		}
 	}
 
 	/**
 	 * \brief The box
 	 */
 	IntervalVector box;
+
 	/**
 	 * \brief Other data.
+	 *
+	 * data[i] is the data of slot i (NULL if this data has not been added).
+	 */
+	Backtrackable** data;
+
+	/**
+	 * \brief Size of the data array.
 	 */
-	SymbolMap<Backtrackable*> data;
+	int nb_data;
+
+protected:
+	/*
+	 * Create the data of two subcells from the data of this cell
+	 * (see #ibex::Backtrackable::down()).
+	 */
+	void down(Cell& left, Cell& right);
+
+	/* Resize the data array (new slots are set to NULL). */
+	void resize_data(int n);
+
+	/* The pool where the subcells are allocated (NULL means heap). */
+	CellArena::Pool* arena;
 
 private:
+	Cell(const Cell&); // forbidden
+
 	/* A constant to be used when no variable has been split yet (root cell). */
 	//static const int ROOT_CELL;
 };
 
 std::ostream& operator<<(std::ostream& os, const Cell& c);
 
+/*================================== inline implementations ========================================*/
+
+inline void* Cell::operator new(size_t size) {
+	return CellArena::alloc(size);
+}
+
+inline void Cell::operator delete(void* p) {
+	CellArena::free(p);
+}
+
 } // end namespace ibex
 
 #endif // __IBEX_CELL_H__
@@ -0,0 +1,207 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CellArena.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+// Last Update : Oct 16, 2026
+//============================================================================
+
+#include "ibex_CellArena.h"
+#include "ibex_Thread.h"
+
+#include <stdlib.h>
+#include <vector>
+#include <new>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/* Size classes are multiple of GRAIN bytes (header included). */
+const size_t GRAIN = 16;
+
+/* Blocks of more than GRAIN*NB_CLASSES bytes are not recycled. */
+const int NB_CLASSES = 256;
+
+/* Size of a slab, in bytes. */
+const size_t SLAB_SIZE = 1 << 16;
+
+/* Size of the header of a block (keeps the alignment of the block). */
+const size_t HEADER_SIZE = 16;
+
+}
+
+/*
+ * The memory of an arena.
+ *
+ * The pool is deleted with the arena, unless some blocks are still
+ * in use. In this case, the pool is deleted when the last block is freed.
+ */
+class CellArena::Pool {
+public:
+	Pool(bool thread_safe) : top(NULL), end(NULL), live(0), orphan(false), thread_safe(thread_safe) {
+		for (int c=0; c<NB_CLASSES; c++) free_list[c]=NULL;
+	}
+
+	~Pool() {
+		for (vector<char*>::iterator it=slabs.begin(); it!=slabs.end(); it++)
+			::free(*it);
+	}
+
+	/* Allocate a block of size class c (NULL if out of memory). */
+	void* alloc(int c) {
+		if (thread_safe) mutex.lock();
+
+		void* b=free_list[c];
+		if (b)
+			free_list[c]=*((void**) b);
+		else
+			b=new_block(c);
+
+		if (b) live++;
+
+		if (thread_safe) mutex.unlock();
+		return b;
+	}
+
+	/* Free a block of size class c (or a large block if c==-1). */
+	void free(void* b, int c) {
+		if (thread_safe) mutex.lock();
+
+		if (c>=0) {
+			*((void**) b)=free_list[c];
+			free_list[c]=b;
+		} else
+			::free(b);
+
+		bool last=(--live==0 && orphan);
+
+		if (thread_safe) mutex.unlock();
+
+		if (last) delete this;
+	}
+
+	/* Count a large block (allocated on the heap). */
+	void add_large() {
+		if (thread_safe) mutex.lock();
+		live++;
+		if (thread_safe) mutex.unlock();
+	}
+
+	/* Called by the arena when it is deleted. */
+	void release() {
+		if (thread_safe) mutex.lock();
+		orphan=true;
+		bool last=(live==0);
+		if (thread_safe) mutex.unlock();
+
+		if (last) delete this;
+	}
+
+	std::vector<char*> slabs;   // all the slabs
+	char* top;                  // free space in the last slab
+	char* end;                  // end of the last slab
+	void* free_list[NB_CLASSES];// recycled blocks of each size class
+	int live;                   // number of blocks in use
+	bool orphan;                // true if the arena has been deleted
+	bool thread_safe;
+	Mutex mutex;
+
+private:
+	void* new_block(int c) {
+		size_t size=(c+1)*GRAIN;
+
+		if (top==NULL || top+size>end) {
+			// the end of the current slab is lost
+			char* slab=(char*) malloc(SLAB_SIZE);
+			if (!slab) return NULL;
+			slabs.push_back(slab);
+			top=slab;
+			end=slab+SLAB_SIZE;
+		}
+
+		void* b=top;
+		top+=size;
+		return b;
+	}
+};
+
+namespace {
+
+/*
+ * Header of a block.
+ *
+ * The pool is NULL for a block allocated on the heap.
+ * The size class is -1 for a block that is not recycled (large block).
+ */
+struct Header {
+	CellArena::Pool* pool;
+	int c;
+};
+
+inline void* init_block(void* h, CellArena::Pool* pool, int c) {
+	((Header*) h)->pool=pool;
+	((Header*) h)->c=c;
+	return ((char*) h)+HEADER_SIZE;
+}
+
+}
+
+__thread CellArena::Pool* CellArena::active=NULL;
+
+CellArena::CellArena(bool thread_safe) : pool(new Pool(thread_safe)) {
+
+}
+
+CellArena::~CellArena() {
+	pool->release();
+}
+
+void CellArena::set_thread_safe(bool thread_safe) {
+	pool->thread_safe=thread_safe;
+}
+
+int CellArena::nb_blocks() const {
+	return pool->live;
+}
+
+size_t CellArena::memory() const {
+	return pool->slabs.size()*SLAB_SIZE;
+}
+
+void* CellArena::alloc(size_t size) {
+	Pool* pool=active;
+	size_t total=size+HEADER_SIZE;
+	int c=(int) ((total+GRAIN-1)/GRAIN)-1;
+
+	void* h;
+
+	if (pool && c<NB_CLASSES) {
+		h=pool->alloc(c);
+	} else {
+		h=malloc(total);
+		c=-1;
+		if (h && pool) pool->add_large();
+	}
+
+	if (!h) throw bad_alloc();
+
+	return init_block(h,pool,c);
+}
+
+void CellArena::free(void* p) {
+	if (!p) return;
+
+	Header* h=(Header*) (((char*) p)-HEADER_SIZE);
+
+	if (h->pool)
+		h->pool->free(h,h->c);
+	else
+		::free(h);
+}
+
+} // end namespace ibex
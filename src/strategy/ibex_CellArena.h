@@ -0,0 +1,159 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CellArena.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+// Last Update : Oct 16, 2026
+//============================================================================
+
+#ifndef __IBEX_CELL_ARENA_H__
+#define __IBEX_CELL_ARENA_H__
+
+#include <cstddef>
+
+namespace ibex {
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Memory of a search tree.
+ *
+ * A strategy creates and deletes a huge number of cells, each cell
+ * having its own box and backtrackable data. An arena allocates all
+ * these small blocks in big slabs. A deleted block is put in a free list
+ * (one list per size class) and recycled by the next allocation of the
+ * same size. The slabs are released all at once when the arena is deleted.
+ *
+ * The arena used by a thread is selected by a #ibex::CellArena::Scope.
+ * Cells created within a scope, their boxes and their data are allocated
+ * in the arena of the scope. Then, the subcells of a cell are allocated in
+ * the same arena as the cell itself (see #ibex::Cell::bisect()).
+ * Outside of any scope, blocks are allocated on the heap.
+ */
+class CellArena {
+public:
+	/**
+	 * \brief Create an empty arena.
+	 *
+	 * \param thread_safe - if true, the arena can be used by several
+	 *                      threads simultaneously (see #set_thread_safe(bool)).
+	 */
+	CellArena(bool thread_safe=false);
+
+	/**
+	 * \brief Delete *this.
+	 *
+	 * The slabs are released at once. If some blocks are still in use
+	 * (e.g., cells remaining in a buffer), the slabs are released
+	 * when the last of these blocks is freed.
+	 */
+	~CellArena();
+
+	/**
+	 * \brief Make the allocations (not) thread-safe.
+	 *
+	 * A thread-safe arena is protected by a mutex. This is required
+	 * when cells are created or deleted by several threads.
+	 *
+	 * \pre No other thread uses the arena while the setting is changed.
+	 */
+	void set_thread_safe(bool thread_safe);
+
+	/**
+	 * \brief Number of blocks currently allocated (and not freed).
+	 */
+	int nb_blocks() const;
+
+	/**
+	 * \brief Total size (in bytes) of the slabs.
+	 */
+	size_t memory() const;
+
+	/**
+	 * \brief Allocate \a size bytes in the active arena of the calling thread.
+	 *
+	 * The memory is allocated on the heap if there is no active arena.
+	 */
+	static void* alloc(size_t size);
+
+	/**
+	 * \brief Free a block returned by #alloc(size_t).
+	 *
+	 * The block is given back to the arena it comes from, whatever the
+	 * active arena is. Does nothing if \a p is NULL.
+	 */
+	static void free(void* p);
+
+	class Pool;
+
+	/**
+	 * \brief Scope of an arena.
+	 *
+	 * Activate an arena for the calling thread, until the scope is deleted:
+	 * <pre>
+	 *   {
+	 *      CellArena::Scope scope(arena);
+	 *      Cell* root=new Cell(box);   // allocated in the arena
+	 *      ...
+	 *   }
+	 * </pre>
+	 * Scopes can be nested.
+	 */
+	class Scope {
+	public:
+		/** \brief Activate \a arena. */
+		Scope(CellArena& arena);
+
+		/** \brief Activate a pool (NULL means heap allocation). */
+		Scope(Pool* pool);
+
+		/** \brief Restore the previous arena of the thread. */
+		~Scope();
+
+	private:
+		Scope(const Scope&); // forbidden
+		Pool* previous;
+	};
+
+	/**
+	 * \brief The pool of the active arena of the calling thread.
+	 *
+	 * Return NULL if the thread has no active arena (heap allocation).
+	 * The pool of an arena remains valid as long as it contains blocks.
+	 */
+	static Pool* current();
+
+private:
+	friend class Scope;
+
+	CellArena(const CellArena&); // forbidden
+
+	Pool* pool;
+
+	/* The active pool of each thread. */
+	static __thread Pool* active;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline CellArena::Pool* CellArena::current() {
+	return active;
+}
+
+inline CellArena::Scope::Scope(CellArena& arena) : previous(active) {
+	active=arena.pool;
+}
+
+inline CellArena::Scope::Scope(Pool* pool) : previous(active) {
+	active=pool;
+}
+
+inline CellArena::Scope::~Scope() {
+	active=previous;
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_CELL_ARENA_H__
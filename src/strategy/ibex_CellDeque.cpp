@@ -0,0 +1,51 @@
+//============================================================================
+//                                  I B E X                                   
+// File        : ibex_CellDeque.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+// Last Update : Oct 16, 2026
+//============================================================================
+
+#include "ibex_CellDeque.h"
+
+namespace ibex {
+
+void CellDeque::flush() {
+	while (!cdeque.empty()) {
+		delete cdeque.back();
+		cdeque.pop_back();
+	}
+}
+
+int CellDeque::size() const {
+	return cdeque.size();
+}
+
+bool CellDeque::empty() const {
+	return cdeque.empty();
+}
+
+void CellDeque::push(Cell* cell) {
+	if (capacity>0 && size()==capacity) throw CellBufferOverflow();
+	cdeque.push_back(cell);
+}
+
+Cell* CellDeque::pop() {
+	Cell* c = cdeque.back();
+	cdeque.pop_back();
+	return c;
+}
+
+Cell* CellDeque::top() const {
+	return cdeque.back();
+}
+
+Cell* CellDeque::steal() {
+	Cell* c = cdeque.front();
+	cdeque.pop_front();
+	return c;
+}
+
+} // end namespace ibex
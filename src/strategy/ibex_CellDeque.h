@@ -0,0 +1,64 @@
+//============================================================================
+//                                  I B E X                                   
+// File        : ibex_CellDeque.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+// Last Update : Oct 16, 2026
+//============================================================================
+
+#ifndef __IBEX_CELL_DEQUE_H__
+#define __IBEX_CELL_DEQUE_H__
+
+#include "ibex_CellBuffer.h"
+#include <deque>
+
+namespace ibex {
+
+/** \ingroup strategy
+ *
+ * \brief Cell Deque.
+ *
+ * Behaves like a #ibex::CellStack (depth-first search) but
+ * also allows to remove the oldest cell, i.e., the one at
+ * the bottom of the stack (see #steal()).
+ *
+ * This is the local buffer of each worker in the
+ * \link ibex::ParallelSolver parallel solver \endlink: the owner
+ * works on the top while idle workers steal from the bottom,
+ * where the largest boxes lie.
+ *
+ * \see #CellBuffer
+ */
+class CellDeque : public CellBuffer {
+ public:
+  /** Flush the buffer.
+   * All the remaining cells will be *deleted* */
+  void flush();
+
+  /** Return the size of the buffer. */
+  int size() const;
+
+  /** Return true if the buffer is empty. */
+  bool empty() const;
+
+  /** push a new cell on the top. */
+  void push(Cell* cell);
+
+  /** Pop a cell from the top and return it.*/
+  Cell* pop();
+
+  /** Return the next box (but does not pop it).*/
+  Cell* top() const;
+
+  /** Pop the cell at the bottom and return it. */
+  Cell* steal();
+
+ private:
+  /* Deque of cells (the top is the back) */
+  std::deque<Cell*> cdeque;
+};
+
+} // end namespace ibex
+#endif // __IBEX_CELL_DEQUE_H__
@@ -0,0 +1,251 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CellDiskHeap.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+// Last Update : Oct 16, 2026
+//============================================================================
+
+#include "ibex_CellDiskHeap.h"
+
+#include <algorithm>
+#include <sstream>
+#include <stdio.h>
+
+using namespace std;
+
+namespace ibex {
+
+/*
+ * Format of a run in the file (binary): for each cell, its cost (double)
+ * followed by what Cell::write has written.
+ *
+ * The position of a run points after the cost of its next cell.
+ */
+
+namespace {
+
+/* min-heap (see HeapComparator) */
+struct CostComparator {
+	bool operator()(const pair<Cell*,double>& c1, const pair<Cell*,double>& c2) {
+		return c1.second >= c2.second;
+	}
+};
+
+/* increasing order */
+struct CostOrder {
+	bool operator()(const pair<Cell*,double>& c1, const pair<Cell*,double>& c2) {
+		return c1.second < c2.second;
+	}
+};
+
+/* min-heap of runs (by cost of the next cell) */
+struct RunComparator {
+	template<class Run>
+	bool operator()(const Run& r1, const Run& r2) {
+		return r1.next_cost > r2.next_cost;
+	}
+};
+
+void open(fstream& file, const string& filename) {
+	file.open(filename.c_str(), ios::in | ios::out | ios::trunc | ios::binary);
+
+	if (file.fail()) {
+		stringstream s;
+		s << "CellSpillFile: cannot open file " << filename;
+		ibex_error(s.str().c_str());
+	}
+}
+
+}
+
+CellSpillFile::CellSpillFile(const char* filename) : filename(filename), nb(0), max_cost(POS_INFINITY), proto(NULL) {
+	open(file,this->filename);
+}
+
+CellSpillFile::~CellSpillFile() {
+	clear();
+	file.close();
+	remove(filename.c_str());
+}
+
+void CellSpillFile::clear() {
+	if (proto) {
+		delete proto;
+		proto=NULL;
+	}
+	runs.clear();
+	nb=0;
+	max_cost=POS_INFINITY;
+	truncate();
+}
+
+void CellSpillFile::truncate() {
+	if (runs.empty() && file.tellp()>0) {
+		file.close();
+		open(file,filename);
+	}
+}
+
+void CellSpillFile::write(vector<pair<Cell*,double> >::const_iterator first,
+		vector<pair<Cell*,double> >::const_iterator last) {
+
+	if (first==last) return;
+
+	file.seekp(0, ios::end);
+
+	Run r;
+	r.pos=file.tellp()+(streamoff) sizeof(double);
+	r.remaining=0;
+	r.next_cost=first->second;
+
+	for (vector<pair<Cell*,double> >::const_iterator it=first; it!=last; it++) {
+		// the cell would be discarded anyway
+		if (it->second>max_cost) {
+			delete it->first;
+			continue;
+		}
+
+		file.write((char*) &it->second, sizeof(double));
+		it->first->write(file);
+		r.remaining++;
+
+		// the first cell written is kept as prototype
+		if (!proto) proto=it->first;
+		else delete it->first;
+	}
+
+	if (file.fail()) {
+		stringstream s;
+		s << "CellSpillFile: writing error in file " << filename;
+		ibex_error(s.str().c_str());
+	}
+
+	if (r.remaining>0) {
+		nb+=r.remaining;
+		runs.push_back(r);
+		push_heap(runs.begin(), runs.end(), RunComparator());
+	}
+}
+
+Cell* CellSpillFile::pop() {
+	Run& r=runs.front();
+
+	file.seekg(r.pos);
+
+	Cell* c=proto->spawn(proto->box);
+	c->read(file);
+
+	r.remaining--;
+	nb--;
+
+	if (r.remaining>0)
+		file.read((char*) &r.next_cost, sizeof(double));
+
+	if (file.fail()) {
+		stringstream s;
+		s << "CellSpillFile: reading error in file " << filename;
+		ibex_error(s.str().c_str());
+	}
+
+	r.pos=file.tellg();
+
+	if (r.remaining==0 || r.next_cost>max_cost)
+		drop(0);
+	else {
+		// restore the heap property
+		pop_heap(runs.begin(), runs.end(), RunComparator());
+		push_heap(runs.begin(), runs.end(), RunComparator());
+	}
+
+	truncate();
+
+	return c;
+}
+
+void CellSpillFile::drop(int i) {
+	nb-=runs[i].remaining;
+	runs[i]=runs.back();
+	runs.pop_back();
+	make_heap(runs.begin(), runs.end(), RunComparator());
+}
+
+void CellSpillFile::contract(double max_cost) {
+	if (max_cost<this->max_cost) this->max_cost=max_cost;
+
+	for (int i=runs.size()-1; i>=0; i--)
+		if (runs[i].next_cost>this->max_cost) drop(i);
+
+	truncate();
+}
+
+CellDiskHeap::CellDiskHeap(const char* filename, int hot_capacity) :
+		hot_capacity(hot_capacity), cold(filename) {
+
+	if (hot_capacity<2)
+		ibex_error("CellDiskHeap: at least 2 cells must be kept in memory");
+}
+
+CellDiskHeap::~CellDiskHeap() {
+	flush();
+}
+
+void CellDiskHeap::flush() {
+	for (vector<pair<Cell*,double> >::iterator it=hot.begin(); it!=hot.end(); it++)
+		delete it->first;
+	hot.clear();
+
+	cold.clear();
+}
+
+void CellDiskHeap::push(Cell* cell) {
+	hot.push_back(pair<Cell*,double>(cell,cost(*cell)));
+	push_heap(hot.begin(), hot.end(), CostComparator());
+
+	if ((int) hot.size()>hot_capacity) spill();
+
+	if (capacity>0 && size()==capacity) throw CellBufferOverflow();
+}
+
+Cell* CellDiskHeap::pop() {
+	refill();
+	Cell* c = hot.front().first;
+	pop_heap(hot.begin(), hot.end(), CostComparator()); // put the "best" at the end
+	hot.pop_back(); // removes the "best"
+	return c;       // and return it
+}
+
+Cell* CellDiskHeap::top() const {
+	refill();
+	return hot.front().first;
+}
+
+double CellDiskHeap::minimum() const {
+	refill();
+	return hot.front().second;
+}
+
+void CellDiskHeap::spill() {
+	sort(hot.begin(), hot.end(), CostOrder());
+
+	int keep=hot_capacity/2;
+
+	cold.write(hot.begin()+keep, hot.end());
+
+	hot.resize(keep);
+	make_heap(hot.begin(), hot.end(), CostComparator());
+}
+
+void CellDiskHeap::refill() const {
+	while (!cold.empty()) {
+		if (!hot.empty() && hot.front().second <= cold.minimum()) return;
+
+		double c=cold.minimum();
+		hot.push_back(pair<Cell*,double>(cold.pop(),c));
+		push_heap(hot.begin(), hot.end(), CostComparator());
+	}
+}
+
+} // end namespace ibex
@@ -0,0 +1,220 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CellDiskHeap.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+// Last Update : Oct 16, 2026
+//============================================================================
+
+#ifndef __IBEX_CELL_DISK_HEAP_H__
+#define __IBEX_CELL_DISK_HEAP_H__
+
+#include "ibex_CellBuffer.h"
+
+#include <vector>
+#include <string>
+#include <fstream>
+
+namespace ibex {
+
+/** \ingroup strategy
+ *
+ * \brief Cells written in a file, read back in increasing order of cost.
+ *
+ * Cells are written by batches ("runs") sorted by cost at the end of an
+ * append-only file. They are read back in increasing order of cost (k-way merge
+ * of the runs). The file is truncated when all the cells have been read back.
+ *
+ * A cell is written with #ibex::Cell::write(std::ostream&) const. Cells read back
+ * are created by #ibex::Cell::spawn(const IntervalVector&) from the first cell written
+ * (kept as "prototype"), so that they are of the same class, with the same data.
+ *
+ * This is the storage of the cells spilled by #ibex::CellDiskHeap and #ibex::CellDoubleHeap.
+ */
+class CellSpillFile {
+ public:
+  /**
+   * \brief Create the storage.
+   *
+   * \param filename - the file where cells are written (created, and removed by the destructor).
+   */
+  CellSpillFile(const char* filename);
+
+  /** Delete *this (and remove the file). */
+  ~CellSpillFile();
+
+  /**
+   * \brief Write the cells [first,last) as a new run.
+   *
+   * The cells must be sorted by increasing cost (the second field). The cells are deleted.
+   */
+  void write(std::vector<std::pair<Cell*,double> >::const_iterator first,
+		  std::vector<std::pair<Cell*,double> >::const_iterator last);
+
+  /**
+   * \brief Read the cell with the minimal cost.
+   *
+   * \pre The file is not empty.
+   */
+  Cell* pop();
+
+  /** Cost of the cell returned by the next call to #pop(). */
+  double minimum() const;
+
+  /**
+   * \brief Discard all the cells with a cost greater than \a max_cost.
+   *
+   * The cells of a run are discarded as soon as the next cell of the
+   * run is greater than \a max_cost, so #size() may count cells that will
+   * never be read back. However, #empty() and #minimum() are exact.
+   */
+  void contract(double max_cost);
+
+  /** Number of cells in the file. */
+  int size() const;
+
+  /** Return true if no cell can be read back. */
+  bool empty() const;
+
+  /** Discard all the cells and truncate the file. */
+  void clear();
+
+ private:
+  CellSpillFile(const CellSpillFile&); // forbidden
+
+  /* A sorted sequence of cells in the file. */
+  struct Run {
+	  std::streampos pos;  // position of the next cell
+	  int remaining;       // number of cells not read yet
+	  double next_cost;    // cost of the next cell
+  };
+
+  /* Remove the i-th run. */
+  void drop(int i);
+
+  /* Truncate the file if all the cells have been read back. */
+  void truncate();
+
+  std::string filename;
+
+  std::fstream file;
+
+  /* Runs in the file (the next cell of each run has a cost <= max_cost). */
+  std::vector<Run> runs;
+
+  /* Number of cells in the file. */
+  int nb;
+
+  /* Cells with a greater cost are discarded (see #contract(double)). */
+  double max_cost;
+
+  /* Cell used to create the cells read from the file. */
+  Cell* proto;
+};
+
+/** \ingroup strategy
+ *
+ * \brief Heap-organized buffer of cells with a bounded memory.
+ *
+ * Same as #ibex::CellHeap (the next cell is the one that minimizes
+ * the criterion defined by #cost(const Cell&)) except that at most
+ * #hot_capacity cells are kept in memory.
+ *
+ * When this number is exceeded, the worst half of the cells in memory (the ones
+ * with the highest cost) are written in a file (see #ibex::CellSpillFile) and deleted.
+ * Cells are read back in priority order, as soon as their cost is less than the ones
+ * of the cells in memory, so that #pop() always returns the cell with the minimal criterion.
+ *
+ * Cells read back are of the same class as the cells pushed (e.g., #ibex::OptimCell)
+ * and have the same fields and data (see #ibex::Cell::write(std::ostream&) const).
+ * To bound the memory of an optimizer, see #ibex::CellDoubleHeap::spill(const char*, int).
+ *
+ * \see #CellBuffer, #CellHeap
+ */
+class CellDiskHeap : public CellBuffer {
+
+ public:
+  /**
+   * \brief Create the buffer.
+   *
+   * \param filename     - the file where cells are written (created, and removed by the destructor).
+   * \param hot_capacity - maximal number of cells kept in memory (at least 2).
+   */
+  CellDiskHeap(const char* filename, int hot_capacity);
+
+  /**
+   * \brief Delete *this.
+   *
+   * The remaining cells are deleted.
+   */
+  ~CellDiskHeap();
+
+  /** Flush the buffer.
+   * All the remaining cells will be *deleted* */
+  void flush();
+
+  /** Return the size of the buffer (cells in memory and in the file). */
+  int size() const;
+
+  /** Return true if the buffer is empty. */
+  bool empty() const;
+
+  /** push a new cell on the heap. */
+  void push(Cell* cell);
+
+  /** Pop a cell from the heap and return it.*/
+  Cell* pop();
+
+  /** Return the next cell (but does not pop it).*/
+  Cell* top() const;
+
+  /**
+   * Return the minimum (the criterion for
+   * the first cell)
+   */
+  double minimum() const;
+
+  /** Number of cells currently in the file. */
+  int nb_spilled() const;
+
+  /** Maximal number of cells kept in memory. */
+  const int hot_capacity;
+
+ protected:
+  /** The "cost" of a cell. */
+  virtual double cost(const Cell&) const=0;
+
+ private:
+  CellDiskHeap(const CellDiskHeap&); // forbidden
+
+  /* Move the worst half of the cells in memory to the file. */
+  void spill();
+
+  /* Read back the cells that are better than the cells in memory. */
+  void refill() const;
+
+  /* Cells in the file. */
+  mutable CellSpillFile cold;
+
+  /* Cells in memory, with their cost (organized as a heap). */
+  mutable std::vector<std::pair<Cell*,double> > hot;
+};
+
+/*============================================ inline implementation ============================================ */
+
+inline double CellSpillFile::minimum() const    { return runs.front().next_cost; }
+
+inline int CellSpillFile::size() const          { return nb; }
+
+inline bool CellSpillFile::empty() const        { return runs.empty(); }
+
+inline int CellDiskHeap::size() const           { return hot.size()+cold.size(); }
+
+inline bool CellDiskHeap::empty() const         { return hot.empty() && cold.empty(); }
+
+inline int CellDiskHeap::nb_spilled() const     { return cold.size(); }
+
+} // end namespace ibex
+#endif // __IBEX_CELL_DISK_HEAP_H__
@@ -0,0 +1,238 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CellDoubleHeap.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+// Last Update : Oct 16, 2026
+//============================================================================
+
+#include "ibex_CellDoubleHeap.h"
+
+#include <cassert>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/* the ratio used by the Casado criteria (cf Markot Casado) */
+inline double casado(const OptimCell* c) {
+	return (c->loup - c->pf.lb()) / c->pf.diam();
+}
+
+}
+
+CellDoubleHeap::CellDoubleHeap(int y, CellHeapOptim::criterion crit2, bool second) : y(y), crit2(crit2), second(second),
+		cold(NULL), hot_capacity(-1), contracted(false), last_loup(POS_INFINITY) {
+
+}
+
+CellDoubleHeap::~CellDoubleHeap() {
+	flush();
+	if (cold) delete cold;
+}
+
+void CellDoubleHeap::flush() {
+	for (set<Key>::iterator it=tree.begin(); it!=tree.end(); it++)
+		delete it->cell;
+	tree.clear();
+	heap2.clear();
+	if (cold) cold->clear();
+	contracted=false;
+}
+
+void CellDoubleHeap::spill(const char* filename, int hot_capacity) {
+	if (hot_capacity<2)
+		ibex_error("CellDoubleHeap: at least 2 cells must be kept in memory");
+	if (cold) {
+		unspill();
+		delete cold;
+	}
+	cold=new CellSpillFile(filename);
+	this->hot_capacity=hot_capacity;
+	if ((int) tree.size()>hot_capacity) spill();
+}
+
+void CellDoubleHeap::unspill() {
+	if (!cold) return;
+	while (!cold->empty()) {
+		OptimCell* c=(OptimCell*) cold->pop();
+		if (contracted) c->loup=last_loup;
+		insert(c);
+	}
+}
+
+void CellDoubleHeap::spill() {
+	// the cells are written in increasing order of lower bound
+	vector<pair<Cell*,double> > worst;
+
+	set<Key>::iterator first=tree.begin();
+	for (int i=0; i<hot_capacity/2; i++) first++;
+
+	for (set<Key>::iterator it=first; it!=tree.end(); it++) {
+		if (second) remove2(it->cell);
+		worst.push_back(pair<Cell*,double>(it->cell,it->lb));
+	}
+	tree.erase(first,tree.end());
+
+	cold->write(worst.begin(),worst.end());
+}
+
+void CellDoubleHeap::refill() {
+	if (!cold) return;
+	while (!cold->empty() && (tree.empty() || cold->minimum() < tree.begin()->lb)) {
+		OptimCell* c=(OptimCell*) cold->pop();
+		// the loup used by the Casado criteria may have changed
+		if (contracted) c->loup=last_loup;
+		insert(c);
+	}
+}
+
+bool CellDoubleHeap::better2(const OptimCell* c1, const OptimCell* c2) const {
+	switch (crit2) {
+	case CellHeapOptim::LB :
+		if (c1->box[y].lb() != c2->box[y].lb())
+			return c1->box[y].lb() < c2->box[y].lb();
+		else
+			return c1->box[y].ub() < c2->box[y].ub();
+	case CellHeapOptim::UB :
+		if (c1->box[y].ub() != c2->box[y].ub())
+			return c1->box[y].ub() < c2->box[y].ub();
+		else
+			return c1->box[y].lb() < c2->box[y].lb();
+	case CellHeapOptim::C3 :
+		return casado(c1) > casado(c2);
+	case CellHeapOptim::C5 :
+		return c1->pu * casado(c1) > c2->pu * casado(c2);
+	case CellHeapOptim::C7 :
+		return c1->box[y].lb() / (c1->pu * casado(c1)) < c2->box[y].lb() / (c2->pu * casado(c2));
+	case CellHeapOptim::PU :
+		return c1->pu > c2->pu;
+	default :
+		ibex_error("CellDoubleHeap: unknown criterion");
+		return false;
+	}
+}
+
+void CellDoubleHeap::sift_up(int i) {
+	OptimCell* c=heap2[i];
+	while (i>0) {
+		int parent=(i-1)/2;
+		if (!better2(c,heap2[parent])) break;
+		heap2[i]=heap2[parent];
+		heap2[i]->heap_index=i;
+		i=parent;
+	}
+	heap2[i]=c;
+	c->heap_index=i;
+}
+
+void CellDoubleHeap::sift_down(int i) {
+	int n=heap2.size();
+	OptimCell* c=heap2[i];
+	while (2*i+1<n) {
+		int child=2*i+1;
+		if (child+1<n && better2(heap2[child+1],heap2[child])) child++;
+		if (!better2(heap2[child],c)) break;
+		heap2[i]=heap2[child];
+		heap2[i]->heap_index=i;
+		i=child;
+	}
+	heap2[i]=c;
+	c->heap_index=i;
+}
+
+void CellDoubleHeap::remove2(OptimCell* c) {
+	int i=c->heap_index;
+	OptimCell* last=heap2.back();
+	heap2.pop_back();
+	if (last!=c) {
+		heap2[i]=last;
+		last->heap_index=i;
+		sift_up(i);
+		sift_down(last->heap_index);
+	}
+	c->heap_index=-1;
+}
+
+void CellDoubleHeap::push(OptimCell* cell) {
+	if (capacity>0 && size()==capacity) throw CellBufferOverflow();
+
+	insert(cell);
+
+	if (cold && (int) tree.size()>hot_capacity) spill();
+}
+
+void CellDoubleHeap::insert(OptimCell* cell) {
+	tree.insert(Key(cell,y));
+
+	if (second) {
+		heap2.push_back(cell);
+		sift_up(heap2.size()-1);
+	}
+}
+
+OptimCell* CellDoubleHeap::pop() {
+	OptimCell* c=top();
+	tree.erase(tree.begin());
+	if (second) remove2(c);
+	refill();
+	return c;
+}
+
+OptimCell* CellDoubleHeap::pop2() {
+	assert(second);
+	OptimCell* c=top2();
+	remove2(c);
+	// the box of a cell is not modified while it is in the buffer,
+	// so the key is the one built by push
+	tree.erase(Key(c,y));
+	refill();
+	return c;
+}
+
+// E.g.: called in Optimizer in case of a new upper bound
+// on the objective ("loup"). Only the removed cells are visited
+// (except for the Casado criteria, where all the cells are updated).
+void CellDoubleHeap::contract(double loup) {
+	vector<OptimCell*> removed;
+	contract(loup, removed);
+	for (vector<OptimCell*>::iterator it=removed.begin(); it!=removed.end(); it++)
+		delete *it;
+}
+
+void CellDoubleHeap::contract(double loup, vector<OptimCell*>& removed) {
+	while (!tree.empty()) {
+		set<Key>::iterator it=--tree.end();
+		if (it->lb <= loup) break;
+		OptimCell* c=it->cell;
+		tree.erase(it);
+		if (second) remove2(c);
+		removed.push_back(c);
+	}
+
+	if (second && (crit2==CellHeapOptim::C3 || crit2==CellHeapOptim::C5 || crit2==CellHeapOptim::C7)) {
+		for (vector<OptimCell*>::iterator it=heap2.begin(); it!=heap2.end(); it++)
+			(*it)->loup=loup;
+		for (int i=heap2.size()/2-1; i>=0; i--)
+			sift_down(i);
+		// same update for the cells in the file, when read back
+		contracted=true;
+		last_loup=loup;
+	}
+
+	if (cold) {
+		cold->contract(loup);
+		refill();
+	}
+}
+
+void CellDoubleHeap::cells(vector<OptimCell*>& l) const {
+	for (set<Key>::const_iterator it=tree.begin(); it!=tree.end(); it++)
+		l.push_back(it->cell);
+}
+
+} // end namespace ibex
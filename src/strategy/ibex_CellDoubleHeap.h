@@ -0,0 +1,225 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_CellDoubleHeap.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+// Last Update : Oct 16, 2026
+//============================================================================
+
+#ifndef __IBEX_CELL_DOUBLE_HEAP_H__
+#define __IBEX_CELL_DOUBLE_HEAP_H__
+
+#include "ibex_CellHeapOptim.h"
+#include "ibex_CellDiskHeap.h"
+
+#include <set>
+#include <vector>
+
+namespace ibex {
+
+/** \ingroup strategy
+ *
+ * \brief Buffer of cells ordered by two criteria.
+ *
+ * Used by the optimizer for node selection. The same cells are
+ * ordered by:
+ * <ul>
+ * <li> the first criterion: the lower bound of the objective estimate (the
+ *      interval of the variable "y" in the box), ties being broken with the upper bound
+ *      (the #ibex::CellHeapOptim::LB criterion);
+ * <li> a second criterion (#ibex::CellHeapOptim::UB by default, see #ibex::CellHeapOptim::criterion).
+ * </ul>
+ * A cell can be removed with respect to either criterion, in logarithmic time: it is then
+ * removed from both orders (there is no lazy deletion, as with two instances of #ibex::CellHeapOptim).
+ *
+ * The first order is a balanced tree, so that #contract(double) only visits the cells it removes.
+ * The second order is a binary heap where each cell knows its position (see #ibex::OptimCell::heap_index).
+ *
+ * The memory can be bounded with #spill(const char*, int): the cells with the highest lower bound
+ * are then written in a file and read back when they become the best ones w.r.t. the first criterion.
+ *
+ * \see #CellHeapOptim, #CellBuffer
+ */
+class CellDoubleHeap : public CellBuffer {
+public:
+	/**
+	 * \brief Build the buffer.
+	 *
+	 * \param y      - the index of the variable "y" that contains the objective estimate in each cell's box.
+	 * \param crit2  - the second criterion.
+	 * \param second - if false, the second order is not maintained (only the first criterion is used).
+	 */
+	CellDoubleHeap(int y, CellHeapOptim::criterion crit2=CellHeapOptim::UB, bool second=true);
+
+	/** Delete *this (and the remaining cells). */
+	~CellDoubleHeap();
+
+	/** Index of the objective variable. */
+	const int y;
+
+	/** The second criterion. */
+	const CellHeapOptim::criterion crit2;
+
+	/** True if the second order is maintained. */
+	const bool second;
+
+	/** Flush the buffer.
+	 * All the remaining cells will be *deleted* */
+	void flush();
+
+	/** Return the size of the buffer. */
+	int size() const;
+
+	/** Return true if the buffer is empty. */
+	bool empty() const;
+
+	/** Push a new cell.
+	 * \pre The cell is an #ibex::OptimCell. */
+	void push(Cell* cell);
+
+	/** Push a new cell. */
+	void push(OptimCell* cell);
+
+	/** Pop the best cell w.r.t. the first criterion and return it. */
+	OptimCell* pop();
+
+	/** Pop the best cell w.r.t. the second criterion and return it.
+	 * \pre The second order is maintained. */
+	OptimCell* pop2();
+
+	/** Return the best cell w.r.t. the first criterion (but does not pop it).*/
+	OptimCell* top() const;
+
+	/** Return the best cell w.r.t. the second criterion (but does not pop it).
+	 * \pre The second order is maintained. */
+	OptimCell* top2() const;
+
+	/**
+	 * \brief Remove (and delete) all the cells with a lower bound of
+	 * the objective greater than \a loup.
+	 *
+	 * With the C3, C5 and C7 criteria, the loup of the other cells
+	 * is updated and the second order is rebuilt.
+	 */
+	void contract(double loup);
+
+	/**
+	 * \brief Same as #contract(double) but the removed cells are
+	 * not deleted: they are appended to \a removed.
+	 *
+	 * Allows to delete the cells outside of a critical section.
+	 */
+	void contract(double loup, std::vector<OptimCell*>& removed);
+
+	/** Return the minimum (the lower bound of the objective
+	 * estimate of the first cell) */
+	double minimum() const;
+
+	/** Return all the cells (in the order of the first criterion).
+	 * \pre No cell is in the file (see #unspill()). */
+	void cells(std::vector<OptimCell*>& l) const;
+
+	/**
+	 * \brief Bound the number of cells in memory.
+	 *
+	 * When more than \a hot_capacity cells are in memory, the worst half of them
+	 * w.r.t. the first criterion (the highest lower bounds of the objective) are written
+	 * in \a filename (see #ibex::CellSpillFile) and deleted. A cell is read back as soon as
+	 * it is the best one w.r.t. the first criterion, so that #pop(), #minimum() and
+	 * #contract(double) are not affected. The cells removed by #contract(double) are
+	 * discarded from the file without being read.
+	 *
+	 * Cells read back are of the same class as the cells written (with their fields pf, pu, loup and
+	 * their backtrackable data, see #ibex::OptimCell::write(std::ostream&) const).
+	 *
+	 * \note The second criterion only selects among the cells in memory.
+	 *
+	 * \param filename     - the file (created, and removed by the destructor).
+	 * \param hot_capacity - maximal number of cells kept in memory (at least 2).
+	 */
+	void spill(const char* filename, int hot_capacity);
+
+	/** Read back in memory all the cells of the file (see #spill(const char*, int)). */
+	void unspill();
+
+	/** Number of cells in the file (see #spill(const char*, int)). */
+	int nb_spilled() const;
+
+private:
+	CellDoubleHeap(const CellDoubleHeap&); // forbidden
+
+	/* Key of a cell in the first order. */
+	struct Key {
+		Key(OptimCell* c, int y);
+		double lb, ub;
+		OptimCell* cell;
+		bool operator<(const Key& k) const;
+	};
+
+	/* Return true if c1 is better than c2 w.r.t. the second criterion. */
+	bool better2(const OptimCell* c1, const OptimCell* c2) const;
+
+	/* Move the cell at position i of heap2 up/down. */
+	void sift_up(int i);
+	void sift_down(int i);
+
+	/* Remove a cell from heap2. */
+	void remove2(OptimCell* c);
+
+	/* Add a cell in both orders. */
+	void insert(OptimCell* c);
+
+	/* Write the worst half of the cells in memory to the file. */
+	void spill();
+
+	/* Read back the cells of the file better than the cells in memory
+	 * (so that the best cell w.r.t. the first criterion is in memory). */
+	void refill();
+
+	/* First order. */
+	std::set<Key> tree;
+
+	/* Second order (binary heap). */
+	std::vector<OptimCell*> heap2;
+
+	/* Cells written in a file (NULL if the memory is not bounded). */
+	CellSpillFile* cold;
+
+	/* Maximal number of cells in memory. */
+	int hot_capacity;
+
+	/* With the Casado criteria: the argument of the last contraction,
+	 * given to the cells read back (if any). */
+	bool contracted;
+	double last_loup;
+};
+
+/*============================================ inline implementation ============================================ */
+
+inline int CellDoubleHeap::size() const        { return tree.size() + (cold? cold->size() : 0); }
+
+// note: if the tree is empty, so is the file (see refill())
+inline bool CellDoubleHeap::empty() const      { return tree.empty(); }
+
+inline void CellDoubleHeap::push(Cell* cell)   { push((OptimCell*) cell); }
+
+inline OptimCell* CellDoubleHeap::top() const  { return tree.begin()->cell; }
+
+inline OptimCell* CellDoubleHeap::top2() const { return heap2.front(); }
+
+inline double CellDoubleHeap::minimum() const  { return tree.begin()->lb; }
+
+inline int CellDoubleHeap::nb_spilled() const  { return cold? cold->size() : 0; }
+
+inline CellDoubleHeap::Key::Key(OptimCell* c, int y) : lb(c->box[y].lb()), ub(c->box[y].ub()), cell(c) { }
+
+inline bool CellDoubleHeap::Key::operator<(const Key& k) const {
+	if (lb!=k.lb) return lb<k.lb;
+	else if (ub!=k.ub) return ub<k.ub;
+	else return cell<k.cell;
+}
+
+} // end namespace ibex
+#endif // __IBEX_CELL_DOUBLE_HEAP_H__
@@ -8,7 +8,7 @@
 // Last Update : Apr 7, 2014
 //============================================================================
 
-// Implementation with 2 heaps : the first one with Comparatorlb, the second with another comparator 
+// Comparators : Comparatorlb for the classical criterion (LB), the others for the second criterion of the optimizer
 
 
 #include "ibex_CellHeapOptim.h"
@@ -104,17 +104,6 @@ struct CellComparatorub {
 
 
 
-  /* removes from the top of the heap the cells that have already been removed from the other heap (heap_present <2) */
-  void CellHeapOptim::cleantop()  {
-	while (!empty() && (lopt.front().first)->heap_present < 2)
-	  { OptimCell *c = pop();
-	    if (c->heap_present == 0) delete c;
-	  }
-	
-	
-  }
-  
-
   /* "heap destruction" made by another comparator and reconstruction of the heap with its comparator : useful for diversification by breaking the ties another way*/
   void CellHeapOptim:: makeheap()
   {
@@ -138,10 +127,7 @@ struct CellComparatorub {
 
     void CellHeapOptim::flush() {
     for (vector<pair<OptimCell*,Interval*> >::iterator it=lopt.begin(); it!=lopt.end(); it++)
-	  { OptimCell* cell=it->first;
-		cell->heap_present--;
-	    if (cell->heap_present==0)
-		  delete cell;
+	  { delete it->first;
 	    delete it->second;}
     lopt.clear();
   }
@@ -161,9 +147,7 @@ struct CellComparatorub {
   while (it0!=lopt.end() && it0->second->lb() > loup) { it0++; k++; }
 
   for (int i=0;i<k;i++) {
-	//	cout << " i " << " heap_present " << (lopt[i].first)->heap_present << endl;
-	  (lopt[i].first)->heap_present--;
-	  if ((lopt[i].first)->heap_present==0)delete lopt[i].first;
+	  delete lopt[i].first;
 	  delete lopt[i].second; 
 	}
 
@@ -183,10 +167,9 @@ struct CellComparatorub {
   }
 
   
-  // remove the cell from the buffer and decrements its heap_present counter
+  // remove the cell from the buffer
   OptimCell* CellHeapOptim::pop() {
     OptimCell* c = lopt.front().first;
-    c->heap_present--;
 	switch (crit)
 		{case LB : pop_heap(lopt.begin(), lopt.end(), CellComparatorlb()); break;
 		case UB : pop_heap(lopt.begin(), lopt.end(), CellComparatorub()); break;
@@ -211,8 +194,6 @@ struct CellComparatorub {
 		case C7: 	push_heap(lopt.begin(), lopt.end(), CellComparatorC7()); break;
 		case PU: 	push_heap(lopt.begin(), lopt.end(), CellComparatorpu()); break;
 		}
-	cell->heap_present++;
-	
 }
 
   void CellHeapOptim::push_costpf(OptimCell* cell) {
@@ -227,8 +208,6 @@ struct CellComparatorub {
 		case C7 : 	push_heap(lopt.begin(), lopt.end(), CellComparatorC7()); break;
 		case PU : 	push_heap(lopt.begin(), lopt.end(), CellComparatorpu()); break;
 		}
-	cell->heap_present++;
-
 }
 
   // returns the cell on the top of the heap without modifying the heap
@@ -243,6 +222,7 @@ struct CellComparatorub {
 int CellHeapOptim::size() const {
 	return lopt.size();
 }
+
 bool CellHeapOptim::empty() const {
 	return lopt.empty();
 }
@@ -78,9 +78,6 @@ public:
   /** Pop a cell from the heap and return it.*/
   OptimCell* pop();
   
-  /* clean the top of the heap by removing the cells already poped from another heap*/
-  void cleantop();
-  
   /** push a new cell on the heap. */
   void push(OptimCell* cell);
 
@@ -0,0 +1,127 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Checkpoint.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ibex_Checkpoint.h"
+#include "ibex_Exception.h"
+
+#include <sstream>
+#include <typeinfo>
+#include <string>
+#include <string.h>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+void check(istream& is) {
+	if (!is) ibex_error("Checkpoint: unexpected end of file");
+}
+
+}
+
+void Checkpoint::write_signature(ostream& os, const char* s) {
+	os.write(s, strlen(s)+1);
+}
+
+void Checkpoint::write_int(ostream& os, int x) {
+	os.write((char*) &x, sizeof(int));
+}
+
+void Checkpoint::write_double(ostream& os, double x) {
+	os.write((char*) &x, sizeof(double));
+}
+
+void Checkpoint::write_interval(ostream& os, const Interval& x) {
+	write_double(os,x.lb());
+	write_double(os,x.ub());
+}
+
+void Checkpoint::write_box(ostream& os, const IntervalVector& box) {
+	for (int i=0; i<box.size(); i++)
+		write_interval(os,box[i]);
+}
+
+void Checkpoint::write_cell(ostream& os, const Cell& c) {
+	write_box(os,c.box);
+
+	int nb=0;
+	for (int j=0; j<c.nb_data; j++)
+		if (c.data[j]) nb++;
+	write_int(os,nb);
+
+	for (int j=0; j<c.nb_data; j++) {
+		if (!c.data[j]) continue;
+		const char* name=typeid(*c.data[j]).name();
+		int len=strlen(name);
+		write_int(os,len);
+		os.write(name,len);
+		c.data[j]->write(os);
+	}
+}
+
+bool Checkpoint::read_signature(istream& is, const char* s) {
+	size_t len=strlen(s)+1;
+	string sig(len,'\0');
+	is.read(&sig[0],len);
+	return is && memcmp(sig.c_str(),s,len)==0;
+}
+
+int Checkpoint::read_int(istream& is) {
+	int x;
+	is.read((char*) &x, sizeof(int));
+	check(is);
+	return x;
+}
+
+double Checkpoint::read_double(istream& is) {
+	double x;
+	is.read((char*) &x, sizeof(double));
+	check(is);
+	return x;
+}
+
+Interval Checkpoint::read_interval(istream& is) {
+	double lb=read_double(is);
+	double ub=read_double(is);
+	return Interval(lb,ub);
+}
+
+void Checkpoint::read_box(istream& is, IntervalVector& box) {
+	for (int i=0; i<box.size(); i++)
+		box[i]=read_interval(is);
+}
+
+void Checkpoint::read_cell(istream& is, Cell& c) {
+	read_box(is,c.box);
+
+	int nb=read_int(is);
+	string name;
+
+	for (int l=0; l<nb; l++) {
+		int len=read_int(is);
+		name.resize(len);
+		if (len>0) is.read(&name[0],len);
+		check(is);
+
+		int j=0;
+		while (j<c.nb_data && (!c.data[j] || name!=typeid(*c.data[j]).name())) j++;
+		if (j==c.nb_data) {
+			stringstream s;
+			s << "Checkpoint: unknown backtrackable data " << name;
+			ibex_error(s.str().c_str());
+		}
+		c.data[j]->read(is);
+		check(is);
+	}
+}
+
+} // end namespace ibex
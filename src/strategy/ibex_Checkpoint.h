@@ -0,0 +1,86 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_Checkpoint.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef __IBEX_CHECKPOINT_H__
+#define __IBEX_CHECKPOINT_H__
+
+#include "ibex_Cell.h"
+
+#include <iostream>
+
+namespace ibex {
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Binary file of a search state.
+ *
+ * Primitives used to save and resume a search (see #ibex::Solver::save(const char*)
+ * and #ibex::Optimizer::save(const char*)).
+ *
+ * Contrary to #ibex::Cell::write(std::ostream&) const, which is used to spill
+ * cells in the same process, a backtrackable data is identified by its class name:
+ * the slots of the data (see #ibex::Backtrackable::slot()) depend on the order in
+ * which the classes are registered and may change from one process to another.
+ *
+ * A read error (e.g., an unexpected end of file) raises an ibex_error.
+ */
+class Checkpoint {
+public:
+	/** \brief Write a signature (the characters of \a s and the final '\\0'). */
+	static void write_signature(std::ostream& os, const char* s);
+
+	/** \brief Write an integer. */
+	static void write_int(std::ostream& os, int x);
+
+	/** \brief Write a double. */
+	static void write_double(std::ostream& os, double x);
+
+	/** \brief Write the bounds of an interval. */
+	static void write_interval(std::ostream& os, const Interval& x);
+
+	/** \brief Write the bounds of the components of a box (not its size). */
+	static void write_box(std::ostream& os, const IntervalVector& box);
+
+	/**
+	 * \brief Write the box and the backtrackable data of a cell.
+	 *
+	 * Each data is written with its class name, followed by
+	 * what #ibex::Backtrackable::write(std::ostream&) const writes.
+	 */
+	static void write_cell(std::ostream& os, const Cell& c);
+
+	/** \brief Return true if \a s is the next signature in the stream. */
+	static bool read_signature(std::istream& is, const char* s);
+
+	/** \brief Read an integer. */
+	static int read_int(std::istream& is);
+
+	/** \brief Read a double. */
+	static double read_double(std::istream& is);
+
+	/** \brief Read an interval. */
+	static Interval read_interval(std::istream& is);
+
+	/** \brief Read the components of \a box (its size is known). */
+	static void read_box(std::istream& is, IntervalVector& box);
+
+	/**
+	 * \brief Read what #write_cell(std::ostream&, const Cell&) has written.
+	 *
+	 * The cell must have been created by #ibex::Cell::spawn(const IntervalVector&)
+	 * from a root cell built as the one of the saved search (same data).
+	 */
+	static void read_cell(std::istream& is, Cell& c);
+};
+
+} // end namespace ibex
+
+#endif // __IBEX_CHECKPOINT_H__
@@ -9,6 +9,7 @@
 //============================================================================
 
 #include "ibex_EntailedCtr.h"
+#include "ibex_Exception.h"
 #include <stdlib.h>
 
 namespace ibex {
@@ -48,6 +49,23 @@ std::pair<Backtrackable*,Backtrackable*> EntailedCtr::down() {
 	return std::pair<Backtrackable*,Backtrackable*>(new EntailedCtr(*this),new EntailedCtr(*this));
 }
 
+void EntailedCtr::write(std::ostream& os) const {
+	os.write((char*) &orig_sys->nb_ctr, sizeof(int));
+	os.write((char*) &norm_sys->nb_ctr, sizeof(int));
+	os.write((char*) orig_entailed, orig_sys->nb_ctr*sizeof(bool));
+	os.write((char*) norm_entailed, norm_sys->nb_ctr*sizeof(bool));
+}
+
+void EntailedCtr::read(std::istream& is) {
+	int m1,m2;
+	is.read((char*) &m1, sizeof(int));
+	is.read((char*) &m2, sizeof(int));
+	if (!is || m1!=orig_sys->nb_ctr || m2!=norm_sys->nb_ctr)
+		ibex_error("EntailedCtr: the number of constraints does not match");
+	is.read((char*) orig_entailed, orig_sys->nb_ctr*sizeof(bool));
+	is.read((char*) norm_entailed, norm_sys->nb_ctr*sizeof(bool));
+}
+
 
 void EntailedCtr::set_normalized_entailed(int i) {
 	norm_entailed[i] = true;
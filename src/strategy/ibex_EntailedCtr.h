@@ -82,6 +82,16 @@ public:
 	 */
 	std::pair<Backtrackable*,Backtrackable*> down();
 
+	/**
+	 * \brief Write the entailed constraints into a binary stream.
+	 */
+	void write(std::ostream& os) const;
+
+	/**
+	 * \brief Read the entailed constraints from a binary stream.
+	 */
+	void read(std::istream& is);
+
 	/** number of constraints (normalized system) */
 	//const int n;
 
@@ -12,22 +12,40 @@
 
 namespace ibex {
 
-  OptimCell::OptimCell(const IntervalVector& box) : Cell(box),heap_present(0),loup(0) {
+  OptimCell::OptimCell(const IntervalVector& box) : Cell(box),heap_index(-1),loup(0) {
 
 }
 
 std::pair<OptimCell*,OptimCell*> OptimCell::bisect(const IntervalVector& left, const IntervalVector& right) {
+	CellArena::Scope scope(arena);
 
 	OptimCell* cleft = new OptimCell(left);
 	OptimCell* cright = new OptimCell(right);
-	for (IBEXMAP(Backtrackable*)::iterator it=data.begin(); it!=data.end(); it++) {
-		std::pair<Backtrackable*,Backtrackable*> child_data=it->second->down();
-		cleft->data.insert_new(it->first,child_data.first);
-		cright->data.insert_new(it->first,child_data.second);
-	}
+	down(*cleft,*cright);
 	return std::pair<OptimCell*,OptimCell*>(cleft,cright);
 }
 
+OptimCell* OptimCell::spawn(const IntervalVector& box) {
+	std::pair<OptimCell*,OptimCell*> cells=bisect(box,box);
+	delete cells.second;
+	return cells.first;
+}
+
+void OptimCell::write(std::ostream& os) const {
+	Cell::write(os);
+	double x[4] = { pf.lb(), pf.ub(), pu, loup };
+	os.write((char*) x, sizeof(x));
+}
+
+void OptimCell::read(std::istream& is) {
+	Cell::read(is);
+	double x[4];
+	is.read((char*) x, sizeof(x));
+	pf=Interval(x[0],x[1]);
+	pu=x[2];
+	loup=x[3];
+}
+
 
 
 } // end namespace ibex
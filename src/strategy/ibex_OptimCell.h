@@ -30,8 +30,18 @@ public:
  OptimCell(const IntervalVector& box);
 
  std::pair<OptimCell*,OptimCell*> bisect(const IntervalVector& left, const IntervalVector& right);
-/** for the management of the 2 heaps : a live cell has a value 2 for heap_present */
-	int heap_present;
+
+ /** Create an OptimCell (see #ibex::Cell::spawn(const IntervalVector&)). */
+ virtual OptimCell* spawn(const IntervalVector& box);
+
+ /** Write the cell, including pf, pu and loup (see #ibex::Cell::write(std::ostream&) const). */
+ virtual void write(std::ostream& os) const;
+
+ /** Read the cell, including pf, pu and loup (see #ibex::Cell::read(std::istream&)). */
+ virtual void read(std::istream& is);
+
+	/** position of the cell in the binary heap of a #ibex::CellDoubleHeap (-1 if none) */
+	int heap_index;
 	/** for the Casado criteria */
 	/** the image of the objective on the current box */
 	Interval pf;
@@ -0,0 +1,147 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_OptimCheckpoint.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+// Last Update : Oct 16, 2026
+//============================================================================
+
+#include "ibex_Optimizer.h"
+#include "ibex_Checkpoint.h"
+#include "ibex_Timer.h"
+
+#include <fstream>
+#include <sstream>
+
+using namespace std;
+
+namespace ibex {
+
+/*
+ * Format of the file (binary):
+ *
+ * - a signature and the number of variables n
+ * - the initial box (n intervals) and the initial bound of the objective
+ * - loup, pseudo_loup, uplo, uplo_of_epsboxes and nb_cells
+ * - the loup-point (n doubles) and the loup-box (n intervals)
+ * - the number of cells, then, for each cell, what
+ *   Checkpoint::write_cell has written (the extended box and
+ *   the backtrackable data) followed by pf, pu and loup.
+ */
+
+namespace {
+
+const char SIGNATURE[] = "IBEX_OPTIMIZER_1";
+
+}
+
+void Optimizer::save(const char* filename) {
+	ofstream os;
+	os.open(filename, ios::out | ios::trunc | ios::binary);
+
+	if (os.fail()) {
+		stringstream s;
+		s << "Optimizer [save]: cannot open file " << filename;
+		ibex_error(s.str().c_str());
+	}
+
+	Checkpoint::write_signature(os,SIGNATURE);
+	Checkpoint::write_int(os,n);
+
+	Checkpoint::write_box(os,root_box);
+	Checkpoint::write_double(os,initial_loup);
+
+	Checkpoint::write_double(os,loup);
+	Checkpoint::write_double(os,pseudo_loup);
+	Checkpoint::write_double(os,uplo);
+	Checkpoint::write_double(os,uplo_of_epsboxes);
+	Checkpoint::write_int(os,nb_cells);
+
+	for (int i=0; i<n; i++)
+		Checkpoint::write_double(os,loup_point[i]);
+	Checkpoint::write_box(os,loup_box);
+
+	// the cells written in the spill file (if any) are saved as well
+	buffer.unspill();
+
+	vector<OptimCell*> cells;
+	buffer.cells(cells);
+	Checkpoint::write_int(os,(int) cells.size());
+
+	for (vector<OptimCell*>::const_iterator it=cells.begin(); it!=cells.end(); it++) {
+		const OptimCell& c=**it;
+		Checkpoint::write_cell(os,c);
+		Checkpoint::write_interval(os,c.pf);
+		Checkpoint::write_double(os,c.pu);
+		Checkpoint::write_double(os,c.loup);
+	}
+
+	if (os.fail()) {
+		stringstream s;
+		s << "Optimizer [save]: writing error in file " << filename;
+		ibex_error(s.str().c_str());
+	}
+
+	os.close();
+}
+
+Optimizer::Status Optimizer::resume(const char* filename) {
+	ifstream is;
+	is.open(filename, ios::in | ios::binary);
+
+	if (is.fail()) {
+		stringstream s;
+		s << "Optimizer [resume]: cannot open file " << filename;
+		ibex_error(s.str().c_str());
+	}
+
+	if (!Checkpoint::read_signature(is,SIGNATURE))
+		ibex_error("Optimizer [resume]: not a file saved by an optimizer");
+
+	if (Checkpoint::read_int(is)!=n)
+		ibex_error("Optimizer [resume]: the number of variables does not match");
+
+	IntervalVector init_box(n);
+	Checkpoint::read_box(is,init_box);
+	double obj_init_bound=Checkpoint::read_double(is);
+
+	// The root cell holds the data required by the bisector
+	// and the optimizer. The data of the restored cells are
+	// created from the ones of the root.
+	OptimCell* root=init_root(init_box, obj_init_bound);
+
+	loup=Checkpoint::read_double(is);
+	pseudo_loup=Checkpoint::read_double(is);
+	uplo=Checkpoint::read_double(is);
+	uplo_of_epsboxes=Checkpoint::read_double(is);
+	nb_cells=Checkpoint::read_int(is);
+
+	for (int i=0; i<n; i++)
+		loup_point[i]=Checkpoint::read_double(is);
+	Checkpoint::read_box(is,loup_box);
+
+	int nb=Checkpoint::read_int(is);
+
+	for (int k=0; k<nb; k++) {
+		OptimCell* c=root->spawn(root->box);
+		Checkpoint::read_cell(is,*c);
+		c->pf=Checkpoint::read_interval(is);
+		c->pu=Checkpoint::read_double(is);
+		c->loup=Checkpoint::read_double(is);
+
+		buffer.push(c);
+	}
+
+	delete root;
+	is.close();
+
+	Timer::start();
+
+	update_uplo();
+
+	return explore(init_box);
+}
+
+} // end namespace ibex
@@ -63,13 +63,13 @@ Optimizer::Optimizer(System& user_sys, Ctc& ctc, Bsc& bsc, double prec,
                 				n(user_sys.nb_var), m(sys.nb_ctr) /* (warning: not user_sys.nb_ctr) */,
                 				ext_sys(user_sys,equ_eps),
                 				ctc(ctc),bsc(bsc),
-                				buffer(n),buffer2(n,crit),  // first buffer with LB, second buffer with ct (default UB))
+                				buffer(n,crit),  // first criterion LB, second criterion crit (default UB), maintained whatever critpr is
                 				prec(prec), goal_rel_prec(goal_rel_prec), goal_abs_prec(goal_abs_prec),
                 				sample_size(sample_size), mono_analysis_flag(true), in_HC4_flag(true), trace(false),
-                				critpr(critpr), timeout(1e08),
+                				critpr(critpr), timeout(1e08), cell_limit(-1),
                 				loup(POS_INFINITY), pseudo_loup(POS_INFINITY),uplo(NEG_INFINITY),
                 				loup_point(n), loup_box(n), nb_cells(0),
-                				df(*user_sys.goal,Function::DIFF), loup_changed(false),	initial_loup(POS_INFINITY), rigor(rigor),
+                				df(*user_sys.goal,Function::DIFF), loup_changed(false),	initial_loup(POS_INFINITY), root_box(n), rigor(rigor),
                 				uplo_of_epsboxes(POS_INFINITY) {
 
 	// ==== build the system of equalities only ====
@@ -117,7 +117,6 @@ Optimizer::~Optimizer() {
 		delete is_inside;
 	}
 	buffer.flush();
-	if (critpr > 0) buffer2.flush();
 	if (equs) delete equs;
 	delete mylp;
 	//	delete &(objshaver->ctc);
@@ -204,17 +203,18 @@ bool Optimizer::update_loup(const IntervalVector& box) {
 
 }
 
-void Optimizer::update_entailed_ctr(const IntervalVector& box) {
+bool Optimizer::update_entailed_ctr(const IntervalVector& box) {
 	for (int j=0; j<m; j++) {
 		if (entailed->normalized(j)) {
 			continue;
 		}
 		Interval y=sys.ctrs[j].f.eval(box);
-		if (y.lb()>0) throw EmptyBoxException();
+		if (y.lb()>0) return false;
 		else if (y.ub()<=0) {
 			entailed->set_normalized_entailed(j);
 		}
 	}
+	return true;
 }
 
 double minimum (double a, double b) {
@@ -254,36 +254,44 @@ void Optimizer::update_uplo() {
  */
 
 void Optimizer::handle_cell(OptimCell& c, const IntervalVector& init_box ){
-	try {
-		contract_and_bound(c, init_box);  // may throw EmptyBoxException
-		//       objshaver->contract(c.box);
-
+	if (contract_cell(c, init_box)) {
+		// the cell is put into the buffer (with the 2 criteria)
+		buffer.push(&c);
 
-		// Computations for the Casado C3, C5, C7 criteria
+		nb_cells++;
+	}
+	else {
+		delete &c;
+	}
+}
 
-		if ((buffer2.crit==CellHeapOptim::C3)||(buffer2.crit==CellHeapOptim::C5)||(buffer2.crit==CellHeapOptim::C7)) {
+bool Optimizer::contract_cell(OptimCell& c, const IntervalVector& init_box) {
+	try {
+		if (!contract_and_bound(c, init_box)) return false;
+	} catch(EmptyBoxException&) {
+		// may still be thrown by an overridden contract or firstorder_contract
+		return false;
+	}
+	//       objshaver->contract(c.box);
 
-			compute_pf(c);
 
-			if (loup < 1.e8)
-				c.loup=loup;
-			else
-				c.loup=1.e8;
-		}
+	// Computations for the Casado C3, C5, C7 criteria
 
-		// computations for C5, C7 and PU criteria
-		if ((buffer2.crit==CellHeapOptim::C5)||(buffer2.crit==CellHeapOptim::C7)||(buffer2.crit==CellHeapOptim::PU))
-			compute_pu(c);
+	if ((buffer.crit2==CellHeapOptim::C3)||(buffer.crit2==CellHeapOptim::C5)||(buffer.crit2==CellHeapOptim::C7)) {
 
-		// the cell is put into the 2 heaps
-		buffer.push(&c);
-		if (critpr > 0)      buffer2.push(&c);
+		compute_pf(c);
 
-		nb_cells++;
-	}
-	catch(EmptyBoxException&) {
-		delete &c;
+		if (loup < 1.e8)
+			c.loup=loup;
+		else
+			c.loup=1.e8;
 	}
+
+	// computations for C5, C7 and PU criteria
+	if ((buffer.crit2==CellHeapOptim::C5)||(buffer.crit2==CellHeapOptim::C7)||(buffer.crit2==CellHeapOptim::PU))
+		compute_pu(c);
+
+	return true;
 }
 
 void Optimizer::compute_pf(OptimCell& c) {
@@ -304,7 +312,7 @@ void Optimizer::compute_pu(OptimCell& c) {
 	c.pu=pu;
 }
 
-void Optimizer::contract_and_bound(OptimCell& c, const IntervalVector& init_box) {
+bool Optimizer::contract_and_bound(OptimCell& c, const IntervalVector& init_box) {
 
 	/*======================== contract y with y<=loup ========================*/
 	Interval& y=c.box[ext_sys.goal_var()];
@@ -325,7 +333,7 @@ void Optimizer::contract_and_bound(OptimCell& c, const IntervalVector& init_box)
 	y &= Interval(NEG_INFINITY,ymax);
 	if (y.is_empty()) {
 		c.box.set_empty();
-		throw EmptyBoxException();
+		return false;
 	}
 
 	/*================ contract x with f(x)=y and g(x)<=0 ================*/
@@ -334,6 +342,8 @@ void Optimizer::contract_and_bound(OptimCell& c, const IntervalVector& init_box)
 
 	contract(c.box, init_box);
 
+	if (c.box.is_empty()) return false;
+
 	//cout << " [contract]  x after=" << c.box << endl;
 	//cout << " [contract]  y after=" << y << endl;
 	// TODO: no more cell in argument here (just a box). Does it matter?
@@ -346,7 +356,7 @@ void Optimizer::contract_and_bound(OptimCell& c, const IntervalVector& init_box)
 	read_ext_box(c.box,tmp_box);
 
 	entailed = &c.get<EntailedCtr>();
-	update_entailed_ctr(tmp_box);
+	if (!update_entailed_ctr(tmp_box)) return false;
 
 	bool loup_ch=update_loup(tmp_box);
 
@@ -356,7 +366,7 @@ void Optimizer::contract_and_bound(OptimCell& c, const IntervalVector& init_box)
 	loup_changed |= loup_ch;
 
 	if (y.is_empty()) { // fix issue #44
-		throw EmptyBoxException();
+		return false;
 	}
 
 	/*====================================================================*/
@@ -369,7 +379,7 @@ void Optimizer::contract_and_bound(OptimCell& c, const IntervalVector& init_box)
 		// rem2: do not use a precision contractor here since it would make the box empty (and y==(-inf,-inf)!!)
 		// rem 3 : the extended  boxes with no bisectable  domains  should be catched for avoiding infinite bisections
 		update_uplo_of_epsboxes(y.lb());
-		throw EmptyBoxException();
+		return false;
 	}
 
 	//gradient=0 contraction for unconstrained optimization ; 
@@ -379,7 +389,7 @@ void Optimizer::contract_and_bound(OptimCell& c, const IntervalVector& init_box)
 	// the current extended box in the cell is updated
 	write_ext_box(tmp_box,c.box);
 
-
+	return true;
 }
 
 
@@ -411,10 +421,10 @@ void Optimizer::firstorder_contract(  IntervalVector& box, const  IntervalVector
 }
 
 void Optimizer::contract ( IntervalVector& box, const IntervalVector& init_box) {
-	ctc.contract(box);
+	ctc.try_contract(box);
 }
 
-Optimizer::Status Optimizer::optimize(const IntervalVector& init_box, double obj_init_bound) {
+OptimCell* Optimizer::init_root(const IntervalVector& init_box, double obj_init_bound) {
 	loup=obj_init_bound;
 	pseudo_loup=obj_init_bound;
 
@@ -428,7 +438,9 @@ Optimizer::Status Optimizer::optimize(const IntervalVector& init_box, double obj
 	diam_rand=0;
 
 	buffer.flush();
-	if (critpr > 0) buffer2.flush();
+
+	// the search tree is allocated in the arena
+	CellArena::Scope scope(arena);
 
 	OptimCell* root=new OptimCell(IntervalVector(n+1));
 
@@ -446,95 +458,37 @@ Optimizer::Status Optimizer::optimize(const IntervalVector& init_box, double obj
 	loup_changed=false;
 	initial_loup=obj_init_bound;
 	loup_point=init_box.mid();
+	root_box=init_box;
 	time=0;
-	Timer::start();
-	handle_cell(*root,init_box);
-	int indbuf=0;
 
-	update_uplo();
-
-	try {
-		while (!buffer.empty()) {
-			if (trace >= 2) cout << " buffer " << ((CellBuffer&) buffer) << endl;
-			if (critpr > 0 && trace >= 2) cout << "  buffer2 " << ((CellBuffer&) buffer2) << endl;
-			//		  cout << "buffer size "  << buffer.size() << " " << buffer2.size() << endl;
-			// removes from the heap buffer, the cells already chosen in the other buffer
-			if (critpr > 0) {
-				buffer.cleantop();
-				buffer2.cleantop();
-				// note if one buffer is empty, both are empty
-				// the condition could be replaced by buffer2.empty()
-				if (buffer.empty()) {
-					// this update is only necessary when buffer was not
-					// initially empty
-					update_uplo();
-					break;
-				}
-				assert(!buffer2.empty());
-			}
+	return root;
+}
 
-			loup_changed=false;
-			OptimCell *c;
-			// random choice between the 2 buffers corresponding to two criteria implemented in two heaps)
-			// critpr chances over 100 to choose the second heap
-			if (rand() % 100 >=critpr) {
-				indbuf=0;
-				c=buffer.top();  // the first heap is used
-			} else {
-				indbuf=1;
-				c=buffer2.top();  // the second heap is used
-			}
+Optimizer::Status Optimizer::optimize(const IntervalVector& init_box, double obj_init_bound) {
+	OptimCell* root=init_root(init_box, obj_init_bound);
 
-			try {
-				pair<IntervalVector,IntervalVector> boxes=bsc.bisect(*c);
+	Timer::start();
+	handle_cell(*root,init_box);
 
-				pair<OptimCell*,OptimCell*> new_cells=c->bisect(boxes.first,boxes.second);
-				if (indbuf ==0) 
-					buffer.pop();
-				else  
-					buffer2.pop();
-				if (c->heap_present==0) delete c; // deletes the cell if it is no more present in a heap.
+	update_uplo();
 
-				handle_cell(*new_cells.first, init_box);
-				handle_cell(*new_cells.second, init_box);
+	return explore(init_box);
+}
 
-				if (uplo_of_epsboxes == NEG_INFINITY) {
-					cout << " possible infinite minimum " << endl;
-					break;
-				}
-				if (loup_changed) {
-					// In case of a new upper bound (loup_changed == true), all the boxes
-					// with a lower bound greater than (loup - goal_prec) are removed and deleted.
-					// Note: if contraction was before bisection, we could have the problem
-					// that the current cell is removed by contract_heap. See comments in
-					// older version of the code (before revision 284).
-
-					double ymax= compute_ymax();
-
-					buffer.contract_heap(ymax);
-					//cout << " now buffer is contracted and min=" << buffer.minimum() << endl;
-					if (critpr > 0) buffer2.contract_heap(ymax);
-
-					if (ymax <=NEG_INFINITY) {
-						if (trace) cout << " infinite value for the minimum " << endl;
-						break;
-					}
-					if (trace) cout << setprecision(12) << "ymax=" << ymax << " uplo= " <<  uplo<< endl;
-				}
-				update_uplo();
-				time_limit_check();
+Optimizer::Status Optimizer::explore(const IntervalVector& init_box) {
 
-			}
-			catch (NoBisectableVariableException& ) {
-				update_uplo_of_epsboxes ((c->box)[ext_sys.goal_var()].lb());
-				if (indbuf ==0)
-					buffer.pop();
-				else  
-					buffer2.pop();
-				if (c->heap_present==0) delete c;
+	try {
+		while (!buffer.empty()) {
+			// random choice between the 2 criteria of the buffer
+			// critpr chances over 100 to choose the second criterion
+			if (!explore_step(init_box, rand() % 100)) break;
 
-				update_uplo(); // the heap has changed -> recalculate the uplo
+			time_limit_check();
 
+			if (cell_limit >=0 && nb_cells>=cell_limit && !buffer.empty()) {
+				Timer::stop();
+				time+= Timer::VIRTUAL_TIMELAPSE();
+				return CELL_LIMIT;
 			}
 		}
 	}
@@ -555,6 +509,71 @@ Optimizer::Status Optimizer::optimize(const IntervalVector& init_box, double obj
 		return SUCCESS;
 }
 
+bool Optimizer::explore_step(const IntervalVector& init_box, int draw) {
+	int indbuf=0;
+
+	if (trace >= 2) cout << " buffer " << ((CellBuffer&) buffer) << endl;
+
+	loup_changed=false;
+	OptimCell *c;
+	if (draw >=critpr) {
+		indbuf=0;
+		c=buffer.top();  // the first criterion is used
+	} else {
+		indbuf=1;
+		c=buffer.top2();  // the second criterion is used
+	}
+
+	try {
+		pair<IntervalVector,IntervalVector> boxes=bsc.bisect(*c);
+
+		pair<OptimCell*,OptimCell*> new_cells=c->bisect(boxes.first,boxes.second);
+		if (indbuf ==0)
+			buffer.pop();
+		else
+			buffer.pop2();
+		delete c;
+
+		handle_cell(*new_cells.first, init_box);
+		handle_cell(*new_cells.second, init_box);
+
+		if (uplo_of_epsboxes == NEG_INFINITY) {
+			cout << " possible infinite minimum " << endl;
+			return false;
+		}
+		if (loup_changed) {
+			// In case of a new upper bound (loup_changed == true), all the boxes
+			// with a lower bound greater than (loup - goal_prec) are removed and deleted.
+			// Note: if contraction was before bisection, we could have the problem
+			// that the current cell is removed by contract. See comments in
+			// older version of the code (before revision 284).
+
+			double ymax= compute_ymax();
+
+			buffer.contract(ymax);
+			//cout << " now buffer is contracted and min=" << buffer.minimum() << endl;
+
+			if (ymax <=NEG_INFINITY) {
+				if (trace) cout << " infinite value for the minimum " << endl;
+				return false;
+			}
+			if (trace) cout << setprecision(12) << "ymax=" << ymax << " uplo= " <<  uplo<< endl;
+		}
+		update_uplo();
+	}
+	catch (NoBisectableVariableException& ) {
+		update_uplo_of_epsboxes ((c->box)[ext_sys.goal_var()].lb());
+		if (indbuf ==0)
+			buffer.pop();
+		else
+			buffer.pop2();
+		delete c;
+
+		update_uplo(); // the heap has changed -> recalculate the uplo
+	}
+	return true;
+}
+
 void Optimizer::update_uplo_of_epsboxes(double ymin) {
 
 	// the current box cannot be bisected.  ymin is a lower bound of the objective on this box
@@ -16,7 +16,7 @@
 #include "ibex_Ctc3BCid.h"
 #include "ibex_CtcUnion.h"
 #include "ibex_Backtrackable.h"
-#include "ibex_CellHeapOptim.h"
+#include "ibex_CellDoubleHeap.h"
 #include "ibex_NormalizedSystem.h"
 #include "ibex_ExtendedSystem.h"
 #include "ibex_EntailedCtr.h"
@@ -26,6 +26,9 @@
 
 namespace ibex {
 
+class ParallelOptimizer;
+class PortfolioOptimizer;
+
 /**
  * \ingroup strategy
  *
@@ -79,7 +82,7 @@ public:
 	/**
 	 * \brief Return status of the optimizer
 	 */
-	typedef enum {SUCCESS, INFEASIBLE, NO_FEASIBLE_FOUND, UNBOUNDED_OBJ, TIME_OUT} Status;
+	typedef enum {SUCCESS, INFEASIBLE, NO_FEASIBLE_FOUND, UNBOUNDED_OBJ, TIME_OUT, CELL_LIMIT} Status;
 
 	/**
 	 * \brief Run the optimization.
@@ -104,9 +107,36 @@ public:
 	 *         UNBOUNDED_OBJ       the objective function seems unbounded (tends to -oo).
 	 *
 	 *         TIMEOUT             time is out.
+	 *
+	 *         CELL_LIMIT          the maximal number of cells is reached (see #cell_limit).
 	 */
 	Status optimize(const IntervalVector& init_box, double obj_init_bound=POS_INFINITY);
 
+	/**
+	 * \brief Save the state of the search into a file.
+	 *
+	 * Typically called after #optimize(const IntervalVector&, double) has returned TIME_OUT
+	 * or CELL_LIMIT.
+	 * The file is a binary file that contains the initial box, the bounds (loup, uplo, etc.),
+	 * the loup-point and all the cells remaining in the buffer (box and backtrackable data).
+	 * The cells spilled to a file by the buffer, if any, are first read back in memory.
+	 *
+	 * \see #resume(const char*).
+	 */
+	void save(const char* filename);
+
+	/**
+	 * \brief Resume a search saved with #save(const char*).
+	 *
+	 * The optimizer must be built in the same way (same system, contractor,
+	 * bisector and heap criteria) as the one that has saved the search.
+	 * The time limit (see #timeout) applies to this run only, the cell
+	 * limit (see #cell_limit) to the total number of cells of the search.
+	 *
+	 * \return see #optimize(const IntervalVector&, double).
+	 */
+	Status resume(const char* filename);
+
 	/**
 	 * \brief Displays on standard output a report of the last call to #optimize(const IntervalVector&).
 	 *
@@ -190,13 +220,15 @@ public:
 	/** Bisector. */
 	Bsc& bsc;
 
-	/** Cell buffers.
-	Two buffers are used for node selection. the first one corresponds to minimize  the minimum of the objective estimate,
+	/** Cell buffer.
+	Two criteria are used for node selection. the first one corresponds to minimize  the minimum of the objective estimate,
 	the second one to minimize another criterion (by default the maximum of the objective estimate).
-	The second one is chosen at each node with a probability critpr/100 (default value critpr=50)
+	The second one is chosen at each node with a probability critpr/100 (default value critpr=50).
+	To bound the memory used by the search, the cells can be spilled to a file before
+	calling #optimize(const IntervalVector&, double), e.g.: buffer.spill("cells.tmp",1000000)
+	(see #ibex::CellDoubleHeap::spill(const char*, int)).
 	 */
-	CellHeapOptim buffer;
-	CellHeapOptim buffer2;
+	CellDoubleHeap buffer;
 
 	/**
 	 * \brief Index of the goal variable y in the extended box.
@@ -233,7 +265,7 @@ public:
 	/** Probability to choose the second criterion in node selection in percentage
 	 * integer in [0,100] default value 50
 	 * the value 0 corresponds to use a single criterion for node selection (the classical one : minimizing the lower bound of the estimate of the objective) 
-	 * the value 100 corresponds to use a single criterion for node selection (the second one used in buffer2) */
+	 * the value 100 corresponds to use a single criterion for node selection (the second criterion of the buffer) */
 	 int critpr;
 	
 	/**
@@ -245,6 +277,15 @@ public:
 	 */
 	double timeout;
 
+	/**
+	 * \brief Cell limit.
+	 *
+	 * Maximal number of cells created by the strategy (see #nb_cells).
+	 * This parameter allows to bound the size of the search tree.
+	 * The value can be fixed by the user. By default, it is -1 (no limit).
+	 */
+	long cell_limit;
+
 	/* Remember running time of the last exploration */
 	double time;
 
@@ -300,6 +341,9 @@ public:
 	int nb_cells;
 
 protected:
+	friend class ParallelOptimizer;
+	friend class PortfolioOptimizer;
+
 	/**
 	 * \brief Return an upper bound of f(x).
 	 *
@@ -325,6 +369,22 @@ protected:
 	 */
 	void handle_cell(OptimCell& c, const IntervalVector& init_box);
 
+	/**
+	 * \brief Contract and bound a cell and compute the data of its second criterion.
+	 *
+	 * Same as #handle_cell except that the cell is not pushed into the buffer.
+	 *
+	 * \return false if the cell can be discarded.
+	 */
+	bool contract_cell(OptimCell& c, const IntervalVector& init_box);
+
+	/**
+	 * \brief Reset the search and build the root cell.
+	 *
+	 * The root cell is neither contracted nor pushed into the buffer (see #handle_cell).
+	 */
+	OptimCell* init_root(const IntervalVector& init_box, double obj_init_bound);
+
 	/**
 	 * \brief Contract and bound procedure for processing a box.
 	 *
@@ -335,8 +395,26 @@ protected:
 	 * <li> call the first order contractor
 	 * </ul>
 	 *
+	 * \return false if the cell can be discarded.
+	 */
+	bool contract_and_bound(OptimCell& c, const IntervalVector& init_box);
+
+	/**
+	 * \brief Main loop: process the cells of the buffer until it is empty.
+	 */
+	Status explore(const IntervalVector& init_box);
+
+	/**
+	 * \brief One iteration of the main loop.
+	 *
+	 * Select a cell in the buffer, bisect it and handle the two subcells (or
+	 * update #uplo_of_epsboxes if the cell cannot be bisected).
+	 *
+	 * \param draw - random number in [0,100). The cell is selected with the second
+	 *               criterion of the buffer if draw < #critpr.
+	 * \return false if the search must be stopped (unbounded objective).
 	 */
-	void contract_and_bound(OptimCell& c, const IntervalVector& init_box);
+	bool explore_step(const IntervalVector& init_box, int draw);
 
 	/**
 	 * \brief Contraction procedure for processing a box.
@@ -345,6 +423,7 @@ protected:
 	 * <li> contract with the contractor ctc,
 	 * </ul>
 	 *
+	 * The box is set to the empty set if it can be discarded.
 	 */
 	 virtual void contract(IntervalVector& box, const IntervalVector& init_box );
 
@@ -364,8 +443,10 @@ protected:
 
 	/**
 	 * \brief Update the entailed constraint for the current box
+	 *
+	 * \return false if a constraint is proven to be violated.
 	 */
-	void update_entailed_ctr(const IntervalVector& box);
+	bool update_entailed_ctr(const IntervalVector& box);
 
 
 	/**
@@ -440,6 +521,12 @@ protected:
 	 */
 	bool check_candidate(const Vector& pt, bool is_inner);
 
+	/**
+	 * \brief Same as #check_candidate(const Vector&, bool) with
+	 * \a res an upper bound of the criterion at \a pt, already calculated.
+	 */
+	bool check_candidate(const Vector& pt, double res, bool is_inner);
+
 	/**
 	 * Look for a loup box (in rigor mode) starting from a pseudo-loup.
 	 *
@@ -548,6 +635,12 @@ protected:
     void compute_pf(OptimCell& c);
 	
 	void compute_pu (OptimCell& c);
+
+	/** Memory of the search tree (cells, boxes and backtrackable data). */
+	CellArena arena;
+
+	/** The initial box of the last search (see #save(const char*)). */
+	IntervalVector root_box;
 	
 private:
 
@@ -0,0 +1,360 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ParallelOptimizer.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+// Last Update : Oct 16, 2026
+//============================================================================
+
+#include "ibex_ParallelOptimizer.h"
+#include "ibex_EmptyBoxException.h"
+#include "ibex_NoBisectableVariableException.h"
+
+#include <stdlib.h>
+#include <cassert>
+#include <iomanip>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/* Time (in seconds) an idle worker waits before looking again at the buffer. */
+const double IDLE_WAIT = 0.001;
+
+}
+
+/*
+ * A worker of the parallel optimizer.
+ */
+class OptimizerWorker : public Thread {
+public:
+	OptimizerWorker(ParallelOptimizer& optimizer, int id) : optimizer(optimizer), id(id) { }
+
+	ParallelOptimizer& optimizer;
+
+	const int id;
+
+protected:
+	void run() {
+		optimizer.work(id);
+	}
+};
+
+ParallelOptimizer::ParallelOptimizer(const Array<Optimizer>& opt) :
+		nb_threads(opt.size()), opt(opt), timeout(-1), trace(0),
+		loup(POS_INFINITY), uplo(NEG_INFINITY), loup_point(opt[0].n), nb_cells(0), time(0),
+		shared_loup(POS_INFINITY), loup_point_value(POS_INFINITY), in_flight(0), current_lb(opt.size()),
+		contracted_loup(POS_INFINITY), contracted_ymax(POS_INFINITY), uplo_of_epsboxes(POS_INFINITY),
+		initial_loup(POS_INFINITY), init_box(NULL), stopped(false), timed_out(false), start_time(0) {
+
+	for (int i=0; i<nb_threads; i++)
+		if (opt[i].n!=opt[0].n || opt[i].m!=opt[0].m)
+			ibex_error("ParallelOptimizer: all the optimizers must have the same system");
+}
+
+ParallelOptimizer::~ParallelOptimizer() {
+
+}
+
+Optimizer::Status ParallelOptimizer::optimize(const IntervalVector& init_box, double obj_init_bound) {
+	Optimizer& o0=opt[0];
+	CellDoubleHeap& buffer=o0.buffer;
+
+	this->init_box=&init_box;
+	loup=obj_init_bound;
+	uplo=NEG_INFINITY;
+	uplo_of_epsboxes=POS_INFINITY;
+	initial_loup=obj_init_bound;
+	shared_loup.set(obj_init_bound);
+	loup_point=init_box.mid();
+	loup_point_value=obj_init_bound;
+	nb_cells=0;
+	in_flight=0;
+	stopped=false;
+	timed_out=false;
+	time=0;
+
+	// the buffer (and the arena) of the first optimizer are shared by all the workers
+	o0.arena.set_thread_safe(true);
+	OptimCell* root=o0.init_root(init_box, obj_init_bound);
+	for (int i=1; i<nb_threads; i++) {
+		delete opt[i].init_root(init_box, obj_init_bound);
+		// add data required by the other bisectors
+		opt[i].bsc.add_backtrackable(*root);
+	}
+
+	contracted_loup=obj_init_bound;
+	contracted_ymax=obj_init_bound==POS_INFINITY? POS_INFINITY : o0.compute_ymax();
+
+	start_time=Thread::real_time();
+
+	if (o0.contract_cell(*root, init_box)) {
+		buffer.push(root);
+		nb_cells++;
+	} else {
+		delete root;
+	}
+	publish_loup(o0);
+	uplo_of_epsboxes=o0.uplo_of_epsboxes;
+	if (shared_loup.get()<contracted_loup) {
+		contracted_loup=shared_loup.get();
+		contracted_ymax=o0.compute_ymax();
+	}
+	update_uplo();
+
+	for (int i=0; i<nb_threads; i++) {
+		current_lb[i]=POS_INFINITY;
+		workers.push_back(new OptimizerWorker(*this,i));
+	}
+
+	for (int i=0; i<nb_threads; i++)
+		workers[i]->start();
+
+	for (int i=0; i<nb_threads; i++) {
+		workers[i]->join();
+		delete workers[i];
+	}
+	workers.clear();
+	o0.arena.set_thread_safe(false);
+
+	time = Thread::real_time()-start_time;
+
+	loup=shared_loup.get();
+	update_uplo();
+
+	if (timed_out)
+		return Optimizer::TIME_OUT;
+
+	// note: the cells remaining in the heaps (after an interruption)
+	// are deleted with the first optimizer.
+
+	if (uplo_of_epsboxes == POS_INFINITY && (loup==POS_INFINITY || (loup==initial_loup && o0.goal_abs_prec==0 && o0.goal_rel_prec==0)))
+		return Optimizer::INFEASIBLE;
+	else if (loup==initial_loup)
+		return Optimizer::NO_FEASIBLE_FOUND;
+	else if (uplo_of_epsboxes == NEG_INFINITY)
+		return Optimizer::UNBOUNDED_OBJ;
+	else
+		return Optimizer::SUCCESS;
+}
+
+void ParallelOptimizer::work(int i) {
+	Optimizer& o=opt[i];
+	const int goal_var=o.ext_sys.goal_var();
+	vector<OptimCell*> cells;
+	OptimCell* c;
+	// each worker has its own random sequence (rand() is not thread-safe)
+	unsigned int seed=i+1;
+
+	while ((c=next_cell(i, rand_r(&seed) % 100))!=NULL) {
+
+		// take into account the loup found by the other workers
+		sync_loup(o);
+
+		try {
+			pair<IntervalVector,IntervalVector> boxes=o.bsc.bisect(*c);
+			pair<OptimCell*,OptimCell*> new_cells=c->bisect(boxes.first,boxes.second);
+			delete c;
+
+			o.loup_changed=false;
+
+			OptimCell* sub[2] = { new_cells.first, new_cells.second };
+			for (int j=0; j<2; j++) {
+				if (o.contract_cell(*sub[j], *init_box))
+					cells.push_back(sub[j]);
+				else
+					delete sub[j];
+			}
+		}
+		catch (NoBisectableVariableException&) {
+			o.update_uplo_of_epsboxes((c->box)[goal_var].lb());
+			delete c;
+		}
+
+		publish_loup(o);
+
+		push_cells(i, cells);
+		cells.clear();
+	}
+}
+
+OptimCell* ParallelOptimizer::next_cell(int i, int draw) {
+	Optimizer& o0=opt[0];
+	CellDoubleHeap& buffer=o0.buffer;
+
+	Lock l(heap_lock);
+
+	while (true) {
+		if (stopped) return NULL;
+
+		if (!buffer.empty()) break;
+
+		if (in_flight==0) {
+			// no more cell in the heaps and no cell under processing: the search is over
+			work_available.broadcast();
+			return NULL;
+		}
+
+		work_available.wait(heap_lock, IDLE_WAIT);
+	}
+
+	OptimCell *c;
+	// random choice between the 2 criteria of the buffer
+	// critpr chances over 100 to choose the second criterion
+	if (draw >= o0.critpr)
+		c=buffer.pop();
+	else
+		c=buffer.pop2();
+
+	in_flight++;
+	current_lb[i]=c->box[o0.ext_sys.goal_var()].lb();
+	return c;
+}
+
+void ParallelOptimizer::push_cells(int i, vector<OptimCell*>& cells) {
+	Optimizer& o=opt[i];
+	CellDoubleHeap& buffer=opt[0].buffer;
+	const int goal_var=o.ext_sys.goal_var();
+
+	// cells removed from the heaps by a new loup
+	vector<OptimCell*> pruned;
+
+	{
+		Lock l(heap_lock);
+
+		in_flight--;
+		current_lb[i]=POS_INFINITY;
+
+		if (o.uplo_of_epsboxes < uplo_of_epsboxes)
+			uplo_of_epsboxes = o.uplo_of_epsboxes;
+
+		// In case of a new upper bound, all the boxes with a lower bound
+		// greater than (loup - goal_prec) are removed.
+		double g=shared_loup.get();
+		if (g < contracted_loup) {
+			sync_loup(o);
+			contracted_loup=o.loup;
+			contracted_ymax=o.compute_ymax();
+
+			buffer.contract(contracted_ymax, pruned);
+
+			if (contracted_ymax <= NEG_INFINITY) {
+				if (trace) cout << " infinite value for the minimum " << endl;
+				interrupt();
+			}
+			if (trace) cout << setprecision(12) << "ymax=" << contracted_ymax << " uplo= " << uplo << endl;
+		}
+
+		for (vector<OptimCell*>::iterator it=cells.begin(); it!=cells.end(); it++) {
+			// the cell may have been contracted with an older loup
+			if ((*it)->box[goal_var].lb() > contracted_ymax) {
+				pruned.push_back(*it);
+				continue;
+			}
+			buffer.push(*it);
+			nb_cells++;
+		}
+
+		if (uplo_of_epsboxes == NEG_INFINITY) {
+			cout << " possible infinite minimum " << endl;
+			interrupt();
+		}
+
+		update_uplo();
+
+		if (timeout>0 && Thread::real_time()-start_time>=timeout) {
+			timed_out=true;
+			interrupt();
+		}
+		else if (!cells.empty() || in_flight==0)
+			work_available.broadcast();
+	}
+
+	// The pruned cells are deleted outside of the critical section, in
+	// parallel with the other workers (the arena of the cells is thread-safe).
+	for (vector<OptimCell*>::iterator it=pruned.begin(); it!=pruned.end(); it++)
+		delete *it;
+}
+
+void ParallelOptimizer::sync_loup(Optimizer& o) {
+	double g=shared_loup.get();
+	// the loup and the loup point are read together
+	if (g < o.loup) {
+		Lock l(loup_lock);
+		if (loup_point_value < o.loup) {
+			o.loup=loup_point_value;
+			o.loup_point=loup_point;
+		}
+	}
+	if (g < o.pseudo_loup) o.pseudo_loup=g;
+}
+
+void ParallelOptimizer::publish_loup(Optimizer& o) {
+	// fast path, without lock
+	if (o.loup >= shared_loup.get()) return;
+
+	// the loup and the loup point are written together; the
+	// shared loup is only lowered once the point is written
+	Lock l(loup_lock);
+	if (o.loup < loup_point_value) {
+		loup_point_value=o.loup;
+		loup_point=o.loup_point;
+		shared_loup.set(o.loup);
+		if (trace) cout << setprecision(12) << " loup update " << o.loup << " loup point " << loup_point << endl;
+	}
+}
+
+void ParallelOptimizer::update_uplo() {
+	Optimizer& o0=opt[0];
+	CellDoubleHeap& buffer=o0.buffer;
+
+	double new_uplo=uplo_of_epsboxes;
+
+	if (!buffer.empty() && buffer.minimum() < new_uplo)
+		new_uplo=buffer.minimum();
+
+	for (int i=0; i<nb_threads; i++)
+		if (current_lb[i] < new_uplo) new_uplo=current_lb[i];
+
+	if (!buffer.empty() || in_flight>0)
+		uplo=new_uplo;
+	else if (contracted_loup != POS_INFINITY) {
+		// empty buffer : new uplo is set to ymax (loup - precision) if a loup has been found
+		if (contracted_ymax < new_uplo) new_uplo=contracted_ymax;
+		if (uplo < new_uplo) uplo = new_uplo;
+	}
+}
+
+void ParallelOptimizer::interrupt() {
+	// note: heap_lock is already locked
+	stopped=true;
+	work_available.broadcast();
+}
+
+void ParallelOptimizer::report() {
+	Optimizer& o0=opt[0];
+
+	if (timed_out) {
+		cout << "time limit " << timeout << "s. reached " << endl;
+	}
+	// No solution found and optimization stopped with empty buffer before the required precision is reached => means infeasible problem
+	if (!timed_out && uplo_of_epsboxes == POS_INFINITY && (loup==POS_INFINITY || (loup==initial_loup && o0.goal_abs_prec==0 && o0.goal_rel_prec==0))) {
+		cout << " infeasible problem " << endl;
+	}
+	else {
+		cout << " best bound in: [" << uplo << "," << loup << "]" << endl;
+		if (loup==initial_loup)
+			cout << " no feasible point found " << endl;
+		else
+			cout << " best feasible point " << loup_point << endl;
+	}
+	cout << " real time used " << time << "s." << endl;
+	cout << " number of cells " << nb_cells << endl;
+	cout << " number of threads " << nb_threads << endl;
+}
+
+} // end namespace ibex
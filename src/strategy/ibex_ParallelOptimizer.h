@@ -0,0 +1,220 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ParallelOptimizer.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+// Last Update : Oct 16, 2026
+//============================================================================
+
+#ifndef __IBEX_PARALLEL_OPTIMIZER_H__
+#define __IBEX_PARALLEL_OPTIMIZER_H__
+
+#include "ibex_Optimizer.h"
+#include "ibex_Array.h"
+#include "ibex_Thread.h"
+
+#include <vector>
+
+namespace ibex {
+
+class OptimizerWorker;
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Multi-threaded global optimizer.
+ *
+ * This class implements the same branch and bound algorithm as #ibex::Optimizer
+ * but the cells are handled by several threads (the "workers") at the same time.
+ *
+ * The workers share the buffer of cells (that of the first optimizer)
+ * and the "loup". A worker takes the best cell w.r.t. one of the two criteria, bisects it
+ * and contracts/bounds the two subcells in parallel with the other workers.
+ * Only the heap operations are done in mutual exclusion. The loup is a lock-free
+ * shared value: a worker that finds a better feasible point publishes it immediately
+ * and every worker reads it before handling a new cell (so that a loup found by one
+ * worker is used by all the others to contract the goal variable). A lock is only
+ * taken when the loup actually changes, to read or write the loup point with it.
+ * The heaps are pruned by the worker that observes a new loup: the cells are removed
+ * from the heaps in mutual exclusion but deleted in parallel with the other workers.
+ *
+ * Contractors, bisectors and functions are not thread-safe so each worker
+ * is a full #ibex::Optimizer, typically built from its own copy of the system.
+ * For instance:
+ *
+ * <pre>
+ *   System* sys[n];
+ *   Array<Optimizer> opt(n);
+ *   for (int i=0; i<n; i++) {
+ *      sys[i] = new System(filename);
+ *      opt.set_ref(i, *new DefaultOptimizer(*sys[i],prec,goal_prec));
+ *   }
+ *   ParallelOptimizer o(opt);
+ *   o.optimize(sys[0]->box);
+ * </pre>
+ *
+ * The parameters of the search (precisions, node selection, etc.) are those of
+ * the first optimizer. All the optimizers must be built with the same parameters.
+ *
+ * \note The minimum found is the same as with the sequential optimizer (up to the
+ * required precision) but the number of cells and the loup point may differ from
+ * one run to the other.
+ */
+class ParallelOptimizer {
+public:
+	/**
+	 * \brief Build a parallel optimizer.
+	 *
+	 * \param opt  - the optimizers, one for each worker.
+	 *
+	 * The number of workers is the size of the array.
+	 */
+	ParallelOptimizer(const Array<Optimizer>& opt);
+
+	/**
+	 * \brief Delete *this.
+	 */
+	~ParallelOptimizer();
+
+	/**
+	 * \brief Run the optimization.
+	 *
+	 * Same parameters and return values as #ibex::Optimizer::optimize(const IntervalVector&, double).
+	 */
+	Optimizer::Status optimize(const IntervalVector& init_box, double obj_init_bound=POS_INFINITY);
+
+	/**
+	 * \brief Displays on standard output a report of the last call to #optimize(const IntervalVector&, double).
+	 *
+	 * Information provided:
+	 * <ul><li> interval of the cost  [uplo,loup]
+	 *     <li> the best feasible point found
+	 *     <li> total running (real) time
+	 *     <li> total number of cells created during the exploration
+	 * </ul>
+	 */
+	void report();
+
+	/** Number of workers (threads). */
+	const int nb_threads;
+
+	/** Optimizers (one per worker). */
+	Array<Optimizer> opt;
+
+	/**
+	 * \brief Time limit.
+	 *
+	 * Maximum real time used by the strategy.
+	 * The value can be fixed by the user. By default, it is -1 (no limit).
+	 */
+	double timeout;
+
+	/** Trace activation flag.
+	 * The value can be fixed by the user. By default: 0  nothing is printed
+	 * 1 for printing each better loup found. */
+	int trace;
+
+	/** The "loup" (lowest upper bound of the criterion) */
+	double loup;
+
+	/** The "uplo" (uppermost lower bound of the criterion) */
+	double uplo;
+
+	/** The point satisfying the constraints corresponding to the loup */
+	Vector loup_point;
+
+	/** Number of cells put into the heaps (which passed through the contractors) */
+	int nb_cells;
+
+	/** Real time of the last exploration (in seconds) */
+	double time;
+
+protected:
+	friend class OptimizerWorker;
+
+	/** Main loop of the \a i-th worker. */
+	void work(int i);
+
+	/**
+	 * \brief Take the next cell to handle for the \a i-th worker.
+	 *
+	 * \param draw - random number in [0,100). The cell is selected with the second
+	 *               criterion of the buffer if draw < critpr.
+	 *
+	 * Return NULL if the search is over.
+	 */
+	OptimCell* next_cell(int i, int draw);
+
+	/**
+	 * \brief Push the subcells produced by the \a i-th worker onto the heaps.
+	 *
+	 * Also prune the heaps if the loup has decreased, and update the uplo.
+	 * The pruned cells are deleted after heap_lock is released.
+	 */
+	void push_cells(int i, std::vector<OptimCell*>& cells);
+
+	/** Read the shared loup into the optimizer of a worker. */
+	void sync_loup(Optimizer& o);
+
+	/** Publish the loup of the optimizer of a worker (if better). */
+	void publish_loup(Optimizer& o);
+
+	/** Update the uplo (heap_lock must be locked). */
+	void update_uplo();
+
+	/** Signal all the workers that the search must be stopped (heap_lock must be locked). */
+	void interrupt();
+
+	/** The workers. */
+	std::vector<OptimizerWorker*> workers;
+
+	/* The shared loup. */
+	AtomicDouble shared_loup;
+
+	/* Protects the heaps and the search state below. */
+	Mutex heap_lock;
+
+	/* Signaled when new cells are available or the search is over. */
+	Condition work_available;
+
+	/* Protects loup_point and loup_point_value. The shared loup
+	 * is only lowered under this lock, once loup_point is written. */
+	Mutex loup_lock;
+
+	/* The loup corresponding to loup_point. */
+	double loup_point_value;
+
+	/* Number of cells taken from the heaps and under processing. */
+	int in_flight;
+
+	/* Lower bound of the goal in the cell under processing by each worker
+	 * (+oo if the worker has no cell). */
+	std::vector<double> current_lb;
+
+	/* The loup used for the last contraction of the heaps and the corresponding "ymax". */
+	double contracted_loup;
+	double contracted_ymax;
+
+	/* Lower bound of the small boxes taken by the precision (all workers) */
+	double uplo_of_epsboxes;
+
+	/* The bound on the objective given by the user, +oo otherwise. */
+	double initial_loup;
+
+	/* The initial box of the current search */
+	const IntervalVector* init_box;
+
+	/* Set when the search is interrupted (timeout or unbounded objective). */
+	volatile bool stopped;
+
+	/* Set when the time limit is reached. */
+	bool timed_out;
+
+	/* Time of the start of the search. */
+	double start_time;
+};
+
+} // end namespace ibex
+#endif // __IBEX_PARALLEL_OPTIMIZER_H__
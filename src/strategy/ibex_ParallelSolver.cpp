@@ -0,0 +1,260 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ParallelSolver.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+// Last Update : Oct 16, 2026
+//============================================================================
+
+#include "ibex_ParallelSolver.h"
+#include "ibex_CellDeque.h"
+#include "ibex_EmptyBoxException.h"
+#include "ibex_NoBisectableVariableException.h"
+#include <cassert>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/* Time (in seconds) an idle worker waits before looking again for a cell to steal. */
+const double IDLE_WAIT = 0.001;
+
+}
+
+/*
+ * A worker of the parallel solver.
+ */
+class SolverWorker : public Thread {
+public:
+	SolverWorker(ParallelSolver& solver, int id) : solver(solver), id(id),
+		ctc(solver.ctc[id]), bsc(solver.bsc[id]), impact(BitSet::all(ctc.nb_var)) {
+
+	}
+
+	~SolverWorker() {
+		deque.flush();
+	}
+
+	/* Push a cell in the local deque. */
+	void push(Cell* c) {
+		Lock l(deque_lock);
+		deque.push(c);
+	}
+
+	/* Take a cell from the bottom of the local deque (called by other workers). */
+	Cell* steal() {
+		Lock l(deque_lock);
+		return deque.empty() ? NULL : deque.steal();
+	}
+
+	ParallelSolver& solver;
+
+	const int id;
+
+	Ctc& ctc;
+
+	Bsc& bsc;
+
+	/* Solutions found by this worker. */
+	vector<IntervalVector> sols;
+
+protected:
+
+	void run() {
+		Cell* c;
+		while ((c=next_cell())!=NULL)
+			if (!process(c)) break;
+	}
+
+	/* Get the next cell to handle, or NULL if the search is over. */
+	Cell* next_cell() {
+		while (true) {
+			{
+				Lock l(deque_lock);
+				if (!deque.empty()) return deque.pop();
+			}
+
+			Cell* c=solver.steal(id);
+			if (c) return c;
+
+			Lock l(solver.state_lock);
+			if (solver.stopped || solver.pending==0) break;
+			solver.nb_idle++;
+			solver.work_available.wait(solver.state_lock, IDLE_WAIT);
+			solver.nb_idle--;
+		}
+		return NULL;
+	}
+
+	/*
+	 * Contract and bisect a cell (same as one iteration of Solver::next).
+	 * Return false if the search is interrupted.
+	 */
+	bool process(Cell* c) {
+		int v=c->get<BisectedVar>().var;      // last bisected var.
+		try {
+			if (v!=-1)                          // no root node :  impact set to 1 for last bisected var only
+				impact.add(v);
+			else                                // root node : impact set to 1 for all variables
+				impact.fill(0,ctc.nb_var-1);
+
+			ctc.contract(c->box,impact);
+
+			if (v!=-1)
+				impact.remove(v);
+			else                                // root node : impact set to 0 for all variables after contraction
+				impact.clear();
+
+			try {
+				pair<IntervalVector,IntervalVector> boxes=bsc.bisect(*c);
+				pair<Cell*,Cell*> new_cells=c->bisect(boxes.first,boxes.second);
+				delete c;
+				// count the new cells before they can be stolen (and closed)
+				bool go_on=solver.cells_created(2);
+				push(new_cells.first);
+				push(new_cells.second);
+				return go_on;
+			}
+			catch (NoBisectableVariableException&) {
+				sols.push_back(c->box);
+				solver.new_sol(id, c->box);
+				delete c;
+				return solver.cell_closed();
+			}
+		} catch(EmptyBoxException&) {
+			assert(c->box.is_empty());
+			delete c;
+			if (v!=-1) impact.remove(v);
+			else impact.clear();
+			return solver.cell_closed();
+		}
+	}
+
+private:
+	/* The local buffer */
+	CellDeque deque;
+
+	/* Protects the local buffer (from thieves) */
+	Mutex deque_lock;
+
+	BitSet impact;
+};
+
+ParallelSolver::ParallelSolver(const Array<Ctc>& ctc, const Array<Bsc>& bsc) :
+		nb_threads(ctc.size()), ctc(ctc), bsc(bsc), time_limit(-1), cell_limit(-1), trace(0),
+		nb_cells(0), nb_steals(0), time(0), pending(0), nb_idle(0), nb_sols(0), stopped(false), start_time(0) {
+
+	if (ctc.size()!=bsc.size())
+		ibex_error("ParallelSolver: the number of contractors and bisectors must match");
+
+	for (int i=0; i<nb_threads; i++)
+		if (ctc[i].nb_var!=ctc[0].nb_var)
+			ibex_error("ParallelSolver: all the contractors must have the same number of variables");
+}
+
+ParallelSolver::~ParallelSolver() {
+
+}
+
+vector<IntervalVector> ParallelSolver::solve(const IntervalVector& init_box) {
+	assert(init_box.size()==ctc[0].nb_var);
+
+	nb_cells=0;
+	nb_steals=0;
+	nb_idle=0;
+	nb_sols=0;
+	stopped=false;
+
+	for (int i=0; i<nb_threads; i++)
+		workers.push_back(new SolverWorker(*this,i));
+
+	Cell* root=new Cell(init_box);
+
+	// add data required by this solver
+	root->add<BisectedVar>();
+
+	// add data required by the bisectors
+	for (int i=0; i<nb_threads; i++)
+		bsc[i].add_backtrackable(*root);
+
+	workers[0]->push(root);
+	pending=1;
+
+	start_time=Thread::real_time();
+
+	for (int i=0; i<nb_threads; i++)
+		workers[i]->start();
+
+	for (int i=0; i<nb_threads; i++)
+		workers[i]->join();
+
+	time = Thread::real_time()-start_time;
+
+	if (stopped) {
+		if (cell_limit>=0 && nb_cells>=cell_limit)
+			cout << "cell limit " << cell_limit << " reached " << endl;
+		else
+			cout << "time limit " << time_limit << "s. reached " << endl;
+	}
+
+	// merge the solutions
+	vector<IntervalVector> sols;
+	for (int i=0; i<nb_threads; i++) {
+		sols.insert(sols.end(), workers[i]->sols.begin(), workers[i]->sols.end());
+		delete workers[i]; // delete the remaining cells (if interrupted)
+	}
+	workers.clear();
+
+	return sols;
+}
+
+bool ParallelSolver::cells_created(int n) {
+	Lock l(state_lock);
+	pending+=n-1;
+	nb_cells+=n;
+	if (cell_limit>=0 && nb_cells>=cell_limit) interrupt();
+	else if (time_limit>0 && Thread::real_time()-start_time>=time_limit) interrupt();
+	else if (nb_idle>0) work_available.broadcast();
+	return !stopped;
+}
+
+bool ParallelSolver::cell_closed() {
+	Lock l(state_lock);
+	pending--;
+	if (pending==0) work_available.broadcast();
+	else if (time_limit>0 && Thread::real_time()-start_time>=time_limit) interrupt();
+	return !stopped;
+}
+
+void ParallelSolver::new_sol(int worker, const IntervalVector& box) {
+	Lock l(state_lock);
+	nb_sols++;
+	if (trace>=1) {
+		cout.precision(12);
+		cout << " sol " << nb_sols << " nb_cells " << nb_cells << " (worker " << worker << ") " << box << endl;
+	}
+}
+
+Cell* ParallelSolver::steal(int thief) {
+	for (int i=1; i<nb_threads; i++) {
+		Cell* c=workers[(thief+i)%nb_threads]->steal();
+		if (c) {
+			Lock l(state_lock);
+			nb_steals++;
+			return c;
+		}
+	}
+	return NULL;
+}
+
+void ParallelSolver::interrupt() {
+	// note: state_lock is already locked
+	stopped=true;
+	work_available.broadcast();
+}
+
+} // end namespace ibex
@@ -0,0 +1,170 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ParallelSolver.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+// Last Update : Oct 16, 2026
+//============================================================================
+
+#ifndef __IBEX_PARALLEL_SOLVER_H__
+#define __IBEX_PARALLEL_SOLVER_H__
+
+#include "ibex_Ctc.h"
+#include "ibex_Bsc.h"
+#include "ibex_Array.h"
+#include "ibex_Thread.h"
+
+#include <vector>
+
+namespace ibex {
+
+class SolverWorker;
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Multi-threaded solver.
+ *
+ * This class implements the same branch and prune algorithm as #ibex::Solver
+ * but the search tree is explored by several threads (the "workers") at the same time.
+ *
+ * Each worker owns a local #ibex::CellDeque that it explores in depth-first order.
+ * When a worker runs out of cells, it steals the oldest cell (i.e., the
+ * largest box) of another worker. The search is over when all the deques
+ * are empty and no worker is processing a cell.
+ *
+ * Contractors and bisectors are not thread-safe (they store intermediate
+ * results in the underlying functions) so each worker requires its own
+ * contractor and its own bisector, typically built from its own copy
+ * of the system. For instance:
+ *
+ * <pre>
+ *   System* sys[n];
+ *   DefaultSolver* s[n];
+ *   Array<Ctc> ctc(n);
+ *   Array<Bsc> bsc(n);
+ *   for (int i=0; i<n; i++) {
+ *      sys[i] = new System(filename);
+ *      s[i] = new DefaultSolver(*sys[i],prec);
+ *      ctc.set_ref(i,s[i]->Solver::ctc);
+ *      bsc.set_ref(i,s[i]->bsc);
+ *   }
+ *   ParallelSolver solver(ctc,bsc);
+ * </pre>
+ *
+ * The set of solutions is the same as the one returned by the sequential solver
+ * (provided that the contractors are deterministic) but the order may differ.
+ */
+class ParallelSolver {
+public:
+	/**
+	 * \brief Build a parallel solver.
+	 *
+	 * \param ctc  -  the contractors, one for each worker.
+	 * \param bsc  -  the bisectors, one for each worker (contains the stop criterion).
+	 *
+	 * The number of workers is the size of the arrays.
+	 */
+	ParallelSolver(const Array<Ctc>& ctc, const Array<Bsc>& bsc);
+
+	/**
+	 * \brief Delete *this.
+	 */
+	~ParallelSolver();
+
+	/**
+	 * \brief Solve the system.
+	 *
+	 * \param init_box - the initial box (the search space)
+	 *
+	 * Return: the vector of solutions (small boxes with the required precision) found by the workers.
+	 */
+	std::vector<IntervalVector> solve(const IntervalVector& init_box);
+
+	/** Number of workers (threads). */
+	const int nb_threads;
+
+	/** Contractors (one per worker). */
+	Array<Ctc> ctc;
+
+	/** Bisectors (one per worker). */
+	Array<Bsc> bsc;
+
+	/** Maximum real time used by the solver.
+	 * The value can be fixed by the user. By default, it is -1 (no limit). */
+	double time_limit;
+
+	/** Maximal number of cells created by the solver.
+	 * The value can be fixed by the user. By default, it is -1 (no limit). */
+	long cell_limit;
+
+	/**
+	 * \brief Trace level
+	 *
+	 *  0  : no trace  (default value)
+	 *  1  : the solutions are printed each time a new solution is found
+	 */
+	int trace;
+
+	/** Number of nodes in the search tree */
+	int nb_cells;
+
+	/** Number of cells stolen by a worker from another one */
+	int nb_steals;
+
+	/** Real time of the last exploration (in seconds) */
+	double time;
+
+protected:
+	friend class SolverWorker;
+
+	/**
+	 * Called by a worker that is about to produce \a n new cells from one cell.
+	 * Return false if the search is interrupted.
+	 */
+	bool cells_created(int n);
+
+	/**
+	 * Called by a worker that has discarded a cell (empty or solution).
+	 * Return false if the search is interrupted.
+	 */
+	bool cell_closed();
+
+	/** Called by a worker that has found a solution. */
+	void new_sol(int worker, const IntervalVector& box);
+
+	/** Try to steal a cell for worker \a thief. Return NULL if impossible. */
+	Cell* steal(int thief);
+
+	/** Signal all the workers that the search must be stopped. */
+	void interrupt();
+
+	/** The workers. */
+	std::vector<SolverWorker*> workers;
+
+	/* Protects the counters below and the trace output. */
+	Mutex state_lock;
+
+	/* Signaled when new cells are available or the search is over. */
+	Condition work_available;
+
+	/* Number of cells currently in the deques or under processing. */
+	long pending;
+
+	/* Number of workers waiting for a cell. */
+	int nb_idle;
+
+	/* Number of solutions found (for the trace). */
+	int nb_sols;
+
+	/* Set when the search is interrupted (time or cell limit). Read and written under state_lock. */
+	bool stopped;
+
+	/* Time of the start of the search. */
+	double start_time;
+};
+
+} // end namespace ibex
+#endif // __IBEX_PARALLEL_SOLVER_H__
@@ -0,0 +1,222 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_PortfolioOptimizer.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+// Last Update : Oct 16, 2026
+//============================================================================
+
+#include "ibex_PortfolioOptimizer.h"
+
+#include <stdlib.h>
+#include <iomanip>
+
+using namespace std;
+
+namespace ibex {
+
+/*
+ * A thread of the portfolio.
+ */
+class PortfolioWorker : public Thread {
+public:
+	PortfolioWorker(PortfolioOptimizer& portfolio, int id) : portfolio(portfolio), id(id) { }
+
+	PortfolioOptimizer& portfolio;
+
+	const int id;
+
+protected:
+	void run() {
+		portfolio.work(id);
+	}
+};
+
+PortfolioOptimizer::PortfolioOptimizer(const Array<Optimizer>& opt) :
+		nb_threads(opt.size()), opt(opt), timeout(-1), trace(0), winner(-1),
+		loup(POS_INFINITY), uplo(NEG_INFINITY), loup_point(opt[0].n), time(0),
+		status(opt.size(),Optimizer::TIME_OUT), shared_loup(POS_INFINITY), loup_point_value(POS_INFINITY),
+		init_box(NULL), initial_loup(POS_INFINITY), stopped(0), start_time(0) {
+
+	for (int i=0; i<nb_threads; i++)
+		if (opt[i].n!=opt[0].n || opt[i].m!=opt[0].m)
+			ibex_error("PortfolioOptimizer: all the optimizers must have the same system");
+}
+
+PortfolioOptimizer::~PortfolioOptimizer() {
+
+}
+
+Optimizer::Status PortfolioOptimizer::optimize(const IntervalVector& init_box, double obj_init_bound) {
+
+	this->init_box=&init_box;
+	initial_loup=obj_init_bound;
+	shared_loup.set(obj_init_bound);
+	loup_point=init_box.mid();
+	loup_point_value=obj_init_bound;
+	winner=-1;
+	stopped=0;
+	time=0;
+
+	for (int i=0; i<nb_threads; i++)
+		status[i]=Optimizer::TIME_OUT;
+
+	start_time=Thread::real_time();
+
+	for (int i=0; i<nb_threads; i++) {
+		workers.push_back(new PortfolioWorker(*this,i));
+		workers.back()->start();
+	}
+
+	for (int i=0; i<nb_threads; i++) {
+		workers[i]->join();
+		delete workers[i];
+	}
+	workers.clear();
+
+	time = Thread::real_time()-start_time;
+
+	loup=shared_loup.get();
+
+	if (winner!=-1) {
+		uplo=opt[winner].uplo;
+		return status[winner];
+	} else {
+		// all the uplos are lower bounds of the same problem
+		uplo=NEG_INFINITY;
+		for (int i=0; i<nb_threads; i++)
+			if (opt[i].uplo > uplo) uplo=opt[i].uplo;
+		return Optimizer::TIME_OUT;
+	}
+}
+
+void PortfolioOptimizer::work(int i) {
+	Optimizer& o=opt[i];
+	CellDoubleHeap& buffer=o.buffer;
+
+	OptimCell* root=o.init_root(*init_box, initial_loup);
+
+	o.handle_cell(*root,*init_box);
+	o.update_uplo();
+	publish_loup(i);
+
+	// each optimizer has its own (reproducible) sequence of random numbers
+	unsigned int seed=i+1;
+
+	bool interrupted=false;
+
+	while (!buffer.empty()) {
+
+		if (is_stopped()) {
+			// another optimizer has completed its search or the time limit is reached
+			interrupted=true;
+			break;
+		}
+
+		// take into account the loup found by the other optimizers
+		sync_loup(i);
+		if (buffer.empty()) break;
+
+		// critpr chances over 100 to choose the second criterion
+		if (!o.explore_step(*init_box, rand_r(&seed) % 100)) break;
+
+		if (o.loup_changed) publish_loup(i);
+
+		// note: Optimizer::time_limit_check() is based on the (process-wide) CPU timer
+		if (timeout>0 && Thread::real_time()-start_time>=timeout) {
+			stop();
+		}
+	}
+
+	if (interrupted) return;
+
+	Lock l(loup_lock);
+
+	if (o.uplo_of_epsboxes == POS_INFINITY && (o.loup==POS_INFINITY || (o.loup==initial_loup && o.goal_abs_prec==0 && o.goal_rel_prec==0)))
+		status[i]=Optimizer::INFEASIBLE;
+	else if (o.loup==initial_loup)
+		status[i]=Optimizer::NO_FEASIBLE_FOUND;
+	else if (o.uplo_of_epsboxes == NEG_INFINITY)
+		status[i]=Optimizer::UNBOUNDED_OBJ;
+	else
+		status[i]=Optimizer::SUCCESS;
+
+	if (winner==-1) {
+		winner=i;
+		stop();
+		if (trace) cout << " optimizer " << i << " has completed the search" << endl;
+	}
+}
+
+void PortfolioOptimizer::sync_loup(int i) {
+	Optimizer& o=opt[i];
+	double g=shared_loup.get();
+
+	if (g < o.pseudo_loup) o.pseudo_loup=g;
+
+	if (g < o.loup) {
+		{
+			// the loup and the loup point are read together
+			Lock l(loup_lock);
+			if (loup_point_value < o.loup) {
+				o.loup=loup_point_value;
+				o.loup_point=loup_point;
+			}
+		}
+		// the cells with a lower bound greater than (loup - goal_prec) are removed
+		o.buffer.contract(o.compute_ymax());
+		o.update_uplo();
+	}
+}
+
+void PortfolioOptimizer::publish_loup(int i) {
+	Optimizer& o=opt[i];
+
+	// fast path, without lock
+	if (o.loup >= shared_loup.get()) return;
+
+	// the loup and the loup point are written together; the
+	// shared loup is only lowered once the point is written
+	Lock l(loup_lock);
+	if (o.loup < loup_point_value) {
+		loup_point_value=o.loup;
+		loup_point=o.loup_point;
+		shared_loup.set(o.loup);
+		if (trace) cout << setprecision(12) << " loup update " << o.loup << " (optimizer " << i << ") loup point " << loup_point << endl;
+	}
+}
+
+bool PortfolioOptimizer::is_stopped() {
+	return __sync_fetch_and_add(&stopped, 0)!=0;
+}
+
+void PortfolioOptimizer::stop() {
+	__sync_bool_compare_and_swap(&stopped, 0, 1);
+}
+
+void PortfolioOptimizer::report() {
+
+	if (winner==-1) {
+		cout << "time limit " << timeout << "s. reached " << endl;
+	} else {
+		cout << " winner: optimizer " << winner << endl;
+	}
+
+	if (winner!=-1 && status[winner]==Optimizer::INFEASIBLE) {
+		cout << " infeasible problem " << endl;
+	}
+	else {
+		cout << " best bound in: [" << uplo << "," << loup << "]" << endl;
+		if (loup==initial_loup)
+			cout << " no feasible point found " << endl;
+		else
+			cout << " best feasible point " << loup_point << endl;
+	}
+	cout << " real time used " << time << "s." << endl;
+	for (int i=0; i<nb_threads; i++)
+		cout << " number of cells (optimizer " << i << ") " << opt[i].nb_cells << endl;
+}
+
+} // end namespace ibex
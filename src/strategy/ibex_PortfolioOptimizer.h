@@ -0,0 +1,186 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_PortfolioOptimizer.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+// Last Update : Oct 16, 2026
+//============================================================================
+
+#ifndef __IBEX_PORTFOLIO_OPTIMIZER_H__
+#define __IBEX_PORTFOLIO_OPTIMIZER_H__
+
+#include "ibex_Optimizer.h"
+#include "ibex_Array.h"
+#include "ibex_Thread.h"
+
+#include <vector>
+
+namespace ibex {
+
+class PortfolioWorker;
+
+/**
+ * \ingroup strategy
+ *
+ * \brief Portfolio of optimizers.
+ *
+ * Runs several optimizers (typically with different contractors and bisectors)
+ * on the same problem, each in its own thread, and stops as soon as one of them
+ * has completed its search.
+ *
+ * Contrary to #ibex::ParallelOptimizer, each optimizer explores the whole search
+ * space with its own buffer of cells. The only shared information is the "loup":
+ * a loup found by one optimizer is used by all the others to contract the goal
+ * variable and prune their buffer.
+ *
+ * Contractors, bisectors and functions are not thread-safe so each optimizer
+ * must be built from its own copy of the system. For instance:
+ *
+ * <pre>
+ *   System sys1(filename), sys2(filename);
+ *   DefaultOptimizer o1(sys1,prec,goal_prec);
+ *   ExtendedSystem ext_sys2(sys2,Optimizer::default_equ_eps);
+ *   CtcHC4 hc4(ext_sys2.ctrs);
+ *   RoundRobin rr(prec);
+ *   Optimizer o2(sys2,hc4,rr,prec,goal_prec,goal_prec);
+ *   Array<Optimizer> opt(o1,o2);
+ *   PortfolioOptimizer p(opt);
+ *   p.optimize(sys1.box);
+ *   cout << "winner: " << p.winner << endl;
+ * </pre>
+ *
+ * \note Only optimizers are supported: there is no portfolio of solvers
+ * (e.g., of #ibex::DefaultSolver), since a #ibex::Solver cannot be stopped
+ * by another thread.
+ */
+class PortfolioOptimizer {
+public:
+	/**
+	 * \brief Build a portfolio.
+	 *
+	 * \param opt  - the optimizers (one thread for each).
+	 */
+	PortfolioOptimizer(const Array<Optimizer>& opt);
+
+	/**
+	 * \brief Delete *this.
+	 */
+	~PortfolioOptimizer();
+
+	/**
+	 * \brief Run the optimization.
+	 *
+	 * Same parameters and return values as #ibex::Optimizer::optimize(const IntervalVector&, double).
+	 * The status is the one of the winner (TIME_OUT if no optimizer has completed its search
+	 * within the time limit).
+	 */
+	Optimizer::Status optimize(const IntervalVector& init_box, double obj_init_bound=POS_INFINITY);
+
+	/**
+	 * \brief Displays on standard output a report of the last call to #optimize(const IntervalVector&, double).
+	 *
+	 * Information provided:
+	 * <ul><li> the winner
+	 *     <li> interval of the cost  [uplo,loup]
+	 *     <li> the best feasible point found
+	 *     <li> total running (real) time
+	 *     <li> number of cells created by each optimizer
+	 * </ul>
+	 */
+	void report();
+
+	/** Number of optimizers (threads). */
+	const int nb_threads;
+
+	/** The optimizers. */
+	Array<Optimizer> opt;
+
+	/**
+	 * \brief Time limit.
+	 *
+	 * Maximum real time used by the strategy.
+	 * The value can be fixed by the user. By default, it is -1 (no limit).
+	 */
+	double timeout;
+
+	/** Trace activation flag.
+	 * The value can be fixed by the user. By default: 0  nothing is printed
+	 * 1 for printing each better loup found and the winner. */
+	int trace;
+
+	/**
+	 * \brief Index of the optimizer that has completed its search first.
+	 *
+	 * -1 if the search has been stopped by the time limit.
+	 */
+	int winner;
+
+	/** The "loup" (lowest upper bound of the criterion), over all the optimizers. */
+	double loup;
+
+	/**
+	 * \brief The "uplo" (uppermost lower bound of the criterion).
+	 *
+	 * The uplo of the winner or, if there is no winner, the greatest uplo
+	 * of all the optimizers.
+	 */
+	double uplo;
+
+	/** The point satisfying the constraints corresponding to the loup */
+	Vector loup_point;
+
+	/** Real time of the last exploration (in seconds) */
+	double time;
+
+protected:
+	friend class PortfolioWorker;
+
+	/** Search of the \a i-th optimizer. */
+	void work(int i);
+
+	/** Read the shared loup into the \a i-th optimizer (and prune its buffer). */
+	void sync_loup(int i);
+
+	/** Publish the loup of the \a i-th optimizer (if better). */
+	void publish_loup(int i);
+
+	/** True if the search must be stopped. */
+	bool is_stopped();
+
+	/** Signal all the optimizers that the search must be stopped. */
+	void stop();
+
+	/** The threads. */
+	std::vector<PortfolioWorker*> workers;
+
+	/* Status returned by each optimizer. */
+	std::vector<Optimizer::Status> status;
+
+	/* The shared loup. */
+	AtomicDouble shared_loup;
+
+	/* Protects loup_point, loup_point_value and winner. The shared
+	 * loup is only lowered under this lock, once loup_point is written. */
+	Mutex loup_lock;
+
+	/* The loup corresponding to loup_point. */
+	double loup_point_value;
+
+	/* The initial box of the current search */
+	const IntervalVector* init_box;
+
+	/* The bound on the objective given by the user, +oo otherwise. */
+	double initial_loup;
+
+	/* Set (to 1) when an optimizer has completed its search or the time
+	 * limit is reached. Only accessed by atomic operations (see #is_stopped()). */
+	int stopped;
+
+	/* Time of the start of the search. */
+	double start_time;
+};
+
+} // end namespace ibex
+#endif // __IBEX_PORTFOLIO_OPTIMIZER_H__
@@ -11,7 +11,10 @@
 #include "ibex_Solver.h"
 #include "ibex_EmptyBoxException.h"
 #include "ibex_NoBisectableVariableException.h"
+#include "ibex_Checkpoint.h"
 #include <cassert>
+#include <fstream>
+#include <sstream>
 
 using namespace std;
 
@@ -29,15 +32,7 @@ void Solver::start(const IntervalVector& init_box) {
 
 	assert(init_box.size()==ctc.nb_var);
 
-	Cell* root=new Cell(init_box);
-
-	// add data required by this solver
-	root->add<BisectedVar>();
-
-	// add data required by the bisector
-	bsc.add_backtrackable(*root);
-
-	buffer.push(root);
+	buffer.push(new_root(init_box));
 
 	int nb_var=init_box.size();
 
@@ -56,53 +51,48 @@ bool Solver::next(std::vector<IntervalVector>& sols) {
 			Cell* c=buffer.top();
 
 			int v=c->get<BisectedVar>().var;      // last bisected var.
-			try {
 
-				if (v!=-1)                          // no root node :  impact set to 1 for last bisected var only
-                               	  impact.add(v);
-				else                                // root node : impact set to 1 for all variables
-				  impact.fill(0,ctc.nb_var-1);
-
-				ctc.contract(c->box,impact);
-
-				if (v!=-1)
-				  impact.remove(v);
-				else                              // root node : impact set to 0 for all variables after contraction
-	    			  impact.clear();
-			
-				try {
-
-					pair<IntervalVector,IntervalVector> boxes=bsc.bisect(*c);
-					pair<Cell*,Cell*> new_cells=c->bisect(boxes.first,boxes.second);
-
-					delete buffer.pop();
-					buffer.push(new_cells.first);
-					buffer.push(new_cells.second);
-					nb_cells+=2;
-					if (cell_limit >=0 && nb_cells>=cell_limit) throw CellLimitException();}
-
-				catch (NoBisectableVariableException&) {
-					new_sol(sols, c->box);
-					delete buffer.pop();
-					return !buffer.empty();
-					// note that we skip time_limit_check() here.
-					// In the case where "next" is called by "solve",
-					// and if time has exceeded, the exception will be raised by the
-					// very next call to "next" anyway. This holds, unless "next" finds
-					// new solutions again and again endlessly. So there is a little risk
-					// of uncaught timeout in this case (but this case is probably already
-					// an error case).
-				}
-				time_limit_check();
-
-			} catch(EmptyBoxException&) {
-				assert(c->box.is_empty());
+			if (v!=-1)                          // no root node :  impact set to 1 for last bisected var only
+				impact.add(v);
+			else                                // root node : impact set to 1 for all variables
+				impact.fill(0,ctc.nb_var-1);
+
+			if (!ctc.try_contract(c->box,impact)) {
 				delete buffer.pop();
 				impact.remove(v); // note: in case of the root node, we should clear the bitset
 				                  // instead but since the search is over, the impact is not used anymore.
+				continue;
+			}
+
+			if (v!=-1)
+				impact.remove(v);
+			else                              // root node : impact set to 0 for all variables after contraction
+				impact.clear();
+
+			try {
+
+				pair<IntervalVector,IntervalVector> boxes=bsc.bisect(*c);
+				pair<Cell*,Cell*> new_cells=c->bisect(boxes.first,boxes.second);
 
+				delete buffer.pop();
+				buffer.push(new_cells.first);
+				buffer.push(new_cells.second);
+				nb_cells+=2;
+				if (cell_limit >=0 && nb_cells>=cell_limit) throw CellLimitException();}
 
+			catch (NoBisectableVariableException&) {
+				new_sol(sols, c->box);
+				delete buffer.pop();
+				return !buffer.empty();
+				// note that we skip time_limit_check() here.
+				// In the case where "next" is called by "solve",
+				// and if time has exceeded, the exception will be raised by the
+				// very next call to "next" anyway. This holds, unless "next" finds
+				// new solutions again and again endlessly. So there is a little risk
+				// of uncaught timeout in this case (but this case is probably already
+				// an error case).
 			}
+			time_limit_check();
 		}
 	}
 	catch (TimeOutException&) {
@@ -119,6 +109,110 @@ bool Solver::next(std::vector<IntervalVector>& sols) {
 
 }
 
+Cell* Solver::new_root(const IntervalVector& init_box) {
+	// the search tree is allocated in the arena
+	CellArena::Scope scope(arena);
+
+	Cell* root=new Cell(init_box);
+
+	// add data required by this solver
+	root->add<BisectedVar>();
+
+	// add data required by the bisector
+	bsc.add_backtrackable(*root);
+
+	return root;
+}
+
+/*
+ * Format of the file (binary):
+ *
+ * - a signature and the number of variables n
+ * - the number of cells created so far (nb_cells)
+ * - the number of cells in the buffer, then, for each cell,
+ *   what Checkpoint::write_cell has written.
+ *
+ * The cells are written in the reverse order of extraction from the
+ * buffer, so that pushing them in the order of the file restores the
+ * buffer, whatever its type (stack, heap, etc.).
+ */
+
+namespace {
+
+const char SIGNATURE[] = "IBEX_SOLVER_1";
+
+}
+
+void Solver::save(const char* filename) {
+	ofstream os;
+	os.open(filename, ios::out | ios::trunc | ios::binary);
+
+	if (os.fail()) {
+		stringstream s;
+		s << "Solver [save]: cannot open file " << filename;
+		ibex_error(s.str().c_str());
+	}
+
+	vector<Cell*> cells;
+	while (!buffer.empty())
+		cells.push_back(buffer.pop());
+
+	Checkpoint::write_signature(os,SIGNATURE);
+	Checkpoint::write_int(os,ctc.nb_var);
+	Checkpoint::write_int(os,nb_cells);
+	Checkpoint::write_int(os,(int) cells.size());
+
+	for (vector<Cell*>::reverse_iterator it=cells.rbegin(); it!=cells.rend(); it++) {
+		Checkpoint::write_cell(os,**it);
+		buffer.push(*it);
+	}
+
+	if (os.fail()) {
+		stringstream s;
+		s << "Solver [save]: writing error in file " << filename;
+		ibex_error(s.str().c_str());
+	}
+
+	os.close();
+}
+
+void Solver::resume(const char* filename) {
+	ifstream is;
+	is.open(filename, ios::in | ios::binary);
+
+	if (is.fail()) {
+		stringstream s;
+		s << "Solver [resume]: cannot open file " << filename;
+		ibex_error(s.str().c_str());
+	}
+
+	if (!Checkpoint::read_signature(is,SIGNATURE))
+		ibex_error("Solver [resume]: not a file saved by a solver");
+
+	if (Checkpoint::read_int(is)!=ctc.nb_var)
+		ibex_error("Solver [resume]: the number of variables does not match");
+
+	buffer.flush();
+
+	nb_cells=Checkpoint::read_int(is);
+
+	// The data of the restored cells are created
+	// from the ones of a root cell.
+	Cell* root=new_root(IntervalVector(ctc.nb_var));
+
+	int nb=Checkpoint::read_int(is);
+	for (int k=0; k<nb; k++) {
+		Cell* c=root->spawn(root->box);
+		Checkpoint::read_cell(is,*c);
+		buffer.push(c);
+	}
+
+	delete root;
+	is.close();
+
+	Timer::start();
+}
+
 vector<IntervalVector> Solver::solve(const IntervalVector& init_box) {
 	vector<IntervalVector> sols;
 	start(init_box);
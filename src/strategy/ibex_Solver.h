@@ -69,6 +69,28 @@ public:
 	 */
 	bool next(std::vector<IntervalVector>& sols);
 
+	/**
+	 * \brief Save the state of the search into a file.
+	 *
+	 * Typically called after #next(std::vector<IntervalVector>&) has stopped
+	 * because of the time limit or the cell limit. The file is a binary file that
+	 * contains the number of cells and all the cells remaining in the buffer
+	 * (box and backtrackable data). The solutions already found are not saved.
+	 *
+	 * \see #resume(const char*).
+	 */
+	void save(const char* filename);
+
+	/**
+	 * \brief Resume a search saved with #save(const char*) (interactive mode).
+	 *
+	 * Like #start(const IntervalVector&), with the cells of the file as initial buffer.
+	 * The solver must be built in the same way (same contractor, bisector and type
+	 * of buffer) as the one that has saved the search. The number of cells (see #nb_cells),
+	 * hence the cell limit, includes the cells created before the search was saved.
+	 */
+	void resume(const char* filename);
+
 
 	/**
 	 * \brief  The contractor 
@@ -120,8 +142,14 @@ protected :
 
 	void new_sol(std::vector<IntervalVector> & sols, IntervalVector & box);
 
+	/** Create a root cell (allocated in the arena) with the data required by the search. */
+	Cell* new_root(const IntervalVector& init_box);
+
 	BitSet impact;
 
+	/** Memory of the search tree (cells, boxes and backtrackable data). */
+	CellArena arena;
+
 };
 
 } // end namespace ibex
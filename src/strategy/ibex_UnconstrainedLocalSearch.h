@@ -147,15 +147,16 @@ private:
 	void update_B_SR1(Matrix& Bk, const Vector& sk, const Vector& gk, const Vector& gk1);
 
 	/*
-	 * \brief Return the midpoint if the interval is not empty,
+	 * \brief Return f(x) (in floating-point arithmetic) if it is finite,
 	 * throw a InvalidPointException otherwise.
 	 */
-	double _mid(const Interval& x);
+	double _eval(const Vector& x);
 
 	/**
-	 * \see #_mid(const Interval&).
+	 * \brief Return the gradient of f at x (in floating-point arithmetic) if it is finite,
+	 * throw a InvalidPointException otherwise.
 	 */
-	Vector _mid(const IntervalVector& x);
+	Vector _gradient(const Vector& x);
 
 };
 
@@ -168,14 +169,18 @@ inline int UnconstrainedLocalSearch::nb_iter() const {
 	return this->niter;
 }
 
-inline double UnconstrainedLocalSearch::_mid(const Interval& x) {
-	if (x.is_empty() || x.is_unbounded()) throw InvalidPointException();
-	else return x.mid();
+inline double UnconstrainedLocalSearch::_eval(const Vector& x) {
+	double y=f.eval_point(x);
+	if (!(fabs(y)<POS_INFINITY)) throw InvalidPointException(); // NaN or infinite
+	else return y;
 }
 
-inline Vector UnconstrainedLocalSearch::_mid(const IntervalVector& x) {
-	if (x.is_empty() || x.is_unbounded()) throw InvalidPointException();
-	else return x.mid();
+inline Vector UnconstrainedLocalSearch::_gradient(const Vector& x) {
+	Vector g(n);
+	f.gradient_point(x,g);
+	for (int i=0; i<n; i++)
+		if (!(fabs(g[i])<POS_INFINITY)) throw InvalidPointException();
+	return g;
 }
 
 } // end namespace
@@ -0,0 +1,115 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ExprCSE.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+// Last Update : Oct 16, 2026
+//============================================================================
+
+#include "ibex_ExprCSE.h"
+#include "ibex_Expr.h"
+
+#include <typeinfo>
+#include <sstream>
+#include <algorithm>
+
+using namespace std;
+
+namespace ibex {
+
+void ExprCSE::visit(const ExprNode& e) {
+	if (clone.found(e)) return;
+
+	// copy the children first. They are marked so that their copies,
+	// which are in the table, are never deleted by ExprCopy::copy
+	// (even if e is eventually merged with another node).
+	const ExprIndex* i;
+	const ExprUnaryOp* u;
+	const ExprBinaryOp* b;
+	const ExprNAryOp* n;
+
+	if ((i=dynamic_cast<const ExprIndex*>(&e))) {
+		visit(i->expr);
+		mark(i->expr);
+	} else if ((u=dynamic_cast<const ExprUnaryOp*>(&e))) {
+		visit(u->expr);
+		mark(u->expr);
+	} else if ((b=dynamic_cast<const ExprBinaryOp*>(&e))) {
+		visit(b->left);
+		visit(b->right);
+		mark(b->left);
+		mark(b->right);
+	} else if ((n=dynamic_cast<const ExprNAryOp*>(&e))) {
+		for (int k=0; k<n->nb_args; k++) {
+			visit(n->arg(k));
+			mark(n->arg(k));
+		}
+	}
+
+	string k=key(e);
+
+	if (!k.empty()) {
+		map<string, const ExprNode*>::const_iterator it=table.find(k);
+		if (it!=table.end()) {
+			clone.insert(e,it->second);
+			_nb_shared++;
+			return;
+		}
+	}
+
+	e.acceptVisitor(*this);
+
+	if (!k.empty()) table[k]=clone[e];
+}
+
+string ExprCSE::key(const ExprNode& e) {
+	ostringstream os;
+	os.precision(17);
+
+	os << typeid(e).name() << ' ' << (int) e.dim.type() << ' '
+	   << e.dim.dim1 << ' ' << e.dim.dim2 << ' ' << e.dim.dim3;
+
+	const ExprConstant* c;
+	const ExprIndex* i;
+	const ExprUnaryOp* u;
+	const ExprBinaryOp* b;
+	const ExprNAryOp* n;
+
+	if ((c=dynamic_cast<const ExprConstant*>(&e))) {
+		// only scalar constants are shared (comparing vectors or
+		// matrices is not worth it)
+		if (!c->dim.is_scalar()) return "";
+		os << " [" << c->get_value().lb() << ',' << c->get_value().ub() << ']';
+	} else if (dynamic_cast<const ExprLeaf*>(&e)) {
+		return ""; // symbols
+	} else if ((i=dynamic_cast<const ExprIndex*>(&e))) {
+		os << ' ' << clone[i->expr]->id << ' ' << i->index;
+	} else if ((u=dynamic_cast<const ExprUnaryOp*>(&e))) {
+		os << ' ' << clone[u->expr]->id;
+		const ExprPower* p=dynamic_cast<const ExprPower*>(&e);
+		if (p) os << ' ' << p->expon;
+	} else if ((b=dynamic_cast<const ExprBinaryOp*>(&e))) {
+		int l=clone[b->left]->id;
+		int r=clone[b->right]->id;
+		bool commutative=dynamic_cast<const ExprAdd*>(&e) || dynamic_cast<const ExprMax*>(&e)
+				|| dynamic_cast<const ExprMin*>(&e)
+				|| (dynamic_cast<const ExprMul*>(&e) && b->left.dim.is_scalar() && b->right.dim.is_scalar());
+		if (commutative && r<l) std::swap(l,r);
+		os << ' ' << l << ' ' << r;
+	} else if ((n=dynamic_cast<const ExprNAryOp*>(&e))) {
+		const ExprApply* a=dynamic_cast<const ExprApply*>(&e);
+		if (a) os << ' ' << &a->func;
+		const ExprVector* v=dynamic_cast<const ExprVector*>(&e);
+		if (v) os << ' ' << v->row_vector();
+		for (int k=0; k<n->nb_args; k++)
+			os << ' ' << clone[n->arg(k)]->id;
+	} else {
+		return "";
+	}
+
+	return os.str();
+}
+
+} // end namespace ibex
@@ -0,0 +1,73 @@
+//============================================================================
+//                                  I B E X
+// File        : ibex_ExprCSE.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+// Last Update : Oct 16, 2026
+//============================================================================
+
+#ifndef __IBEX_EXPR_CSE_H__
+#define __IBEX_EXPR_CSE_H__
+
+#include "ibex_ExprCopy.h"
+#include <map>
+#include <string>
+
+namespace ibex {
+
+/**
+ * \ingroup symbolic
+ *
+ * \brief Copy of expressions with common subexpression elimination.
+ *
+ * Duplicate expressions like #ibex::ExprCopy does, except that two structurally
+ * identical subexpressions (same operator, same copies of the operands, same
+ * parameter like the exponent or the index) are copied into a single node.
+ * The commutativity of +, (scalar) *, max and min is taken into account.
+ *
+ * The table of the nodes created is kept from one call of #copy(...) to the next,
+ * so that the subexpressions common to several expressions (e.g., the constraints
+ * of a system) are shared in the resulting DAG, as long as the same new symbols
+ * are given to each call. The copies are therefore only valid together (no copy
+ * can be deleted independently of the others).
+ *
+ * Constants are shared if they are scalar. The symbols are never merged.
+ */
+class ExprCSE : public ExprCopy {
+public:
+	/**
+	 * \brief Create the CSE (with an empty table).
+	 */
+	ExprCSE();
+
+	/**
+	 * \brief Number of subexpressions that have been merged so far.
+	 */
+	int nb_shared() const;
+
+protected:
+	using ExprCopy::visit;
+	void visit(const ExprNode& e);
+
+	/* calculate the key of e, once its children have been copied */
+	std::string key(const ExprNode& e);
+
+	// node created for each key
+	std::map<std::string, const ExprNode*> table;
+
+	int _nb_shared;
+};
+
+/*================================== inline implementations ========================================*/
+
+inline ExprCSE::ExprCSE() : _nb_shared(0) { }
+
+inline int ExprCSE::nb_shared() const {
+	return _nb_shared;
+}
+
+} // end namespace ibex
+
+#endif // __IBEX_EXPR_CSE_H__
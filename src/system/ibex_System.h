@@ -138,6 +138,9 @@ public:
 	Function* goal;
 
 	/** The main (vector-valued) function.
+	 *
+	 * The subexpressions common to several constraints are
+	 * shared in the expression of f (see #ibex::ExprCSE).
 	 *
 	 * \warning - if this system represents an unconstrained optimization problem,
 	 * this field is not initialized and must be ignored. */
@@ -12,6 +12,7 @@
 #include "ibex_Exception.h"
 #include "ibex_ExprCtr.h"
 #include "ibex_ExprCopy.h"
+#include "ibex_ExprCSE.h"
 #include "ibex_EmptySystemException.h"
 
 using std::vector;
@@ -104,6 +105,10 @@ void System::init_f_from_ctrs() {
 	Array<const ExprNode> image(total_output_size);
 	int i=0;
 
+	// The subexpressions common to several constraints are
+	// shared in the DAG of f (and evaluated only once).
+	ExprCSE cse;
+
 	// concatenate all the components of all the constraints function
 	for (int j=0; j<ctrs.size(); j++) {
 		Function& fj=ctrs[j].f;
@@ -132,7 +137,7 @@ void System::init_f_from_ctrs() {
 		 * instead of
 		 *    x[0]=0 and x[1]=1.
 		 */
-		const ExprNode& e=ExprCopy().copy(fj.args(), args, fj.expr());
+		const ExprNode& e=cse.copy(fj.args(), args, fj.expr());
 
 		const Dim& fjd=fj.expr().dim;
 		switch (fjd.type()) {
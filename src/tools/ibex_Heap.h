@@ -26,8 +26,15 @@ namespace ibex {
  *  <li> #pop() returns in logarithmic time
  *       the element with the minimal "cost" (criterion).</li>
  *  <li> #push() is also in logarithmic time.</li>
+ *  <li> #contract() removes the elements with a cost greater than a
+ *       threshold in logarithmic time per removed element (the other
+ *       elements are not visited).</li>
  *  </ul>
  *
+ * The elements are stored in a min-max heap (Atkinson et al., 1986):
+ * the elements at even depth are smaller than their descendants
+ * and the elements at odd depth are greater than their descendants.
+ * So both the minimum and the maximum are at the top.
  */
 template<class T>
 class Heap  {
@@ -78,9 +85,30 @@ protected:
 	/** The way to compare two pairs (element,crit). */
 	bool operator()(const std::pair<T*,double>& c1, const std::pair<T*,double>& c2) const;
 
-	// elements and associated "costs"
+	// elements and associated "costs" (min-max heap)
 	std::vector<std::pair<T*,double> > l;
 
+private:
+	/* Index of the greatest element. */
+	int max_index() const;
+
+	/* Remove the element at index i (i must be 0 or max_index()). */
+	void remove(int i);
+
+	/* Move the element at index i up/down. */
+	void bubble_up(int i);
+	void trickle_down(int i);
+
+	/* Index of the best descendant of i (children and grandchildren),
+	 * i.e., the smallest if min==true, the greatest otherwise. -1 if i is a leaf. */
+	int best_descendant(int i, bool min) const;
+
+	/* True if the level of index i is a min level. */
+	static bool min_level(int i);
+
+	/* True if c1 is before c2 (smaller if min==true, greater otherwise). */
+	static bool before(double c1, double c2, bool min);
+
 	template<class U>
 	friend std::ostream& operator<<(std::ostream&, const Heap<U>&);
 };
@@ -93,18 +121,6 @@ std::ostream& operator<<(std::ostream&, const Heap<T>&);
 /*================================== inline implementations ========================================*/
 
 
-/* we need this dummy class just because
- * the xxx_heap functions take the comparator
- * argument by copy (hence, we cannot give
- * "*this" since the class is abstract) */
-template<class T>
-struct HeapComparator {
-	bool operator()(const std::pair<T*,double>& c1, const std::pair<T*,double>& c2) {
-		return c1.second >= c2.second;
-	}
-};
-
-
 template<class T>
 Heap<T>::~Heap() {
 
@@ -133,24 +149,14 @@ int Heap<T>::size() const {
 // the heap all the cells with a cost greater than loup.
 template<class T>
 void Heap<T>::contract(double loup) {
-	//cout << " before contract heap  " << l.size() << endl;
-
-	sort_heap(l.begin(),l.end(),HeapComparator<T>());
-	std::vector<std::pair<Cell*,double> >::iterator it0=l.begin();
-
-	int k=0;
-	while (it0!=l.end() && it0->second > loup) { it0++; k++; }
-
-	for (int i=0;i<k;i++) {
+	// the greatest element is always at the top:
+	// only the removed elements are visited
+	while (!l.empty()) {
+		int i=max_index();
+		if (l[i].second <= loup) break;
 		delete l[i].first;
+		remove(i);
 	}
-
-	if (k>0) l.erase(l.begin(),it0);
-
-	make_heap(l.begin(), l.end() ,HeapComparator<T>());
-
-	//cout << " after contract heap " << l.size() << endl;
-
 }
 
 template<class T>
@@ -161,15 +167,14 @@ bool Heap<T>::empty() const {
 template<class T>
 void Heap<T>::push(T* el) {
 	l.push_back(std::pair<T*,double>(el,cost(*el)));
-	push_heap(l.begin(), l.end(), HeapComparator<T>());
+	bubble_up(l.size()-1);
 }
 
 template<class T>
 T* Heap<T>::pop() {
-	Cell* c = l.front().first;
-	pop_heap(l.begin(),l.end(), HeapComparator<T>()); // put the "best" at the end
-	l.pop_back(); // removes the "best"
-	return c;     // and return it
+	T* c = l.front().first;
+	remove(0);  // removes the "best"
+	return c;   // and return it
 }
 
 template<class T>
@@ -182,6 +187,90 @@ double Heap<T>::minimum() const {
 	return l.begin()->second;
 }
 
+template<class T>
+bool Heap<T>::min_level(int i) {
+	int depth=0;
+	for (i++; i>1; i/=2) depth++;
+	return depth%2==0;
+}
+
+template<class T>
+bool Heap<T>::before(double c1, double c2, bool min) {
+	return min? c1 < c2 : c1 > c2;
+}
+
+template<class T>
+int Heap<T>::max_index() const {
+	if (l.size()==1) return 0;
+	else if (l.size()==2 || l[1].second >= l[2].second) return 1;
+	else return 2;
+}
+
+template<class T>
+void Heap<T>::remove(int i) {
+	l[i]=l.back();
+	l.pop_back();
+	if (i<(int) l.size()) trickle_down(i);
+}
+
+template<class T>
+void Heap<T>::bubble_up(int i) {
+	if (i==0) return;
+
+	bool min=min_level(i);
+	int parent=(i-1)/2;
+
+	if (before(l[parent].second, l[i].second, min)) {
+		// the element goes to the levels of the other kind
+		std::swap(l[i],l[parent]);
+		i=parent;
+		min=!min;
+	}
+
+	// move up through the levels of the same kind
+	while (i>2) {
+		int grandparent=((i-1)/2-1)/2;
+		if (!before(l[i].second, l[grandparent].second, min)) break;
+		std::swap(l[i],l[grandparent]);
+		i=grandparent;
+	}
+}
+
+template<class T>
+int Heap<T>::best_descendant(int i, bool min) const {
+	int n=l.size();
+	int first=2*i+1;
+	if (first>=n) return -1;
+
+	int best=first;
+	if (first+1<n && before(l[first+1].second, l[best].second, min)) best=first+1;
+
+	for (int j=2*first+1; j<n && j<=2*first+4; j++)
+		if (before(l[j].second, l[best].second, min)) best=j;
+
+	return best;
+}
+
+template<class T>
+void Heap<T>::trickle_down(int i) {
+	bool min=min_level(i);
+
+	int m;
+	while ((m=best_descendant(i,min))!=-1) {
+		if (!before(l[m].second, l[i].second, min)) break;
+
+		std::swap(l[i],l[m]);
+
+		if (m<=2*i+2) break; // m is a child (leaf of the subtree)
+
+		// m is a grandchild: restore the order with its parent
+		int parent=(m-1)/2;
+		if (before(l[parent].second, l[m].second, min))
+			std::swap(l[m],l[parent]);
+		i=m;
+	}
+}
+
 template<class T>
 std::ostream& operator<<(std::ostream& os, const Heap<T>& heap) {
 	os << "[ ";
@@ -18,6 +18,7 @@
 #include <cstring>
 #include <assert.h>
 #include <sstream>
+#include <fenv.h>
 
 using namespace std;
 
@@ -212,7 +213,12 @@ void PixelMap::load(const char *filename) {
     }
 
 	try {
-        read_header(in_file, *this);
+		// the header is parsed in round-to-nearest mode (the
+		// interval arithmetic may keep the FPU rounded upward)
+		const int round=fegetround();
+		if (round!=FE_TONEAREST) fesetround(FE_TONEAREST);
+		read_header(in_file, *this);
+		if (round!=FE_TONEAREST) fesetround(round);
 		for(unsigned int i = 0; i < data.size(); i++) {
 			DATA_TYPE tmp = 0;
 			in_file.read((char*)&tmp,sizeof(DATA_TYPE));
@@ -232,12 +238,19 @@ void PixelMap::write_header(ofstream& out_file, const PixelMap& input) {
 	std::ostringstream oss;
 	oss.imbue (std::locale::classic ());
 
+	// printed in round-to-nearest mode (see load)
+	const int round=fegetround();
+	if (round!=FE_TONEAREST) fesetround(FE_TONEAREST);
+
 	oss << "VERSION " << FORMAT_VERSION;
 	oss << "\nTYPE " << FF_DATA_IMAGE_ND << " " << ndim << " " << sizeof(DATA_TYPE);
 	oss << "\nLEAF_SIZE"; for(unsigned int i =0; i < ndim;  i++) oss << " " << input.leaf_size_[i];
 	oss << "\nORIGIN";    for(unsigned int i =0; i < ndim;  i++) oss << " " << input.origin_[i];
 	oss << "\nGRID_SIZE"; for(unsigned int i =0; i < ndim;  i++) oss << " " << input.grid_size_[i];
 	oss << "\nEND_HEADER\n";
+
+	if (round!=FE_TONEAREST) fesetround(round);
+
 	try {
 		out_file << oss.str();
 	} catch (std::exception& e) {
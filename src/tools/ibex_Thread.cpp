@@ -0,0 +1,149 @@
+//============================================================================
+//                                  I B E X                                   
+// File        : ibex_Thread.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+// Last Update : Oct 16, 2026
+//============================================================================
+
+#include "ibex_Thread.h"
+#include "ibex_Exception.h"
+
+#include <sys/time.h>
+#include <unistd.h>
+#include <errno.h>
+#include <math.h>
+#include <string.h>
+
+namespace ibex {
+
+Mutex::Mutex() {
+	pthread_mutex_init(&m,NULL);
+}
+
+Mutex::~Mutex() {
+	pthread_mutex_destroy(&m);
+}
+
+void Mutex::lock() {
+	pthread_mutex_lock(&m);
+}
+
+void Mutex::unlock() {
+	pthread_mutex_unlock(&m);
+}
+
+Condition::Condition() {
+	pthread_cond_init(&c,NULL);
+}
+
+Condition::~Condition() {
+	pthread_cond_destroy(&c);
+}
+
+void Condition::wait(Mutex& m, double timeout) {
+	struct timeval now;
+	struct timespec deadline;
+	gettimeofday(&now, NULL);
+	double sec=floor(timeout);
+	long nsec=now.tv_usec*1000 + (long) ((timeout-sec)*1e9);
+	deadline.tv_sec = now.tv_sec + (time_t) sec + nsec/1000000000;
+	deadline.tv_nsec = nsec%1000000000;
+	pthread_cond_timedwait(&c, &m.m, &deadline);
+}
+
+void Condition::signal() {
+	pthread_cond_signal(&c);
+}
+
+void Condition::broadcast() {
+	pthread_cond_broadcast(&c);
+}
+
+namespace {
+
+inline long long double_to_bits(double x) {
+	long long b;
+	memcpy(&b, &x, sizeof(double));
+	return b;
+}
+
+inline double bits_to_double(long long b) {
+	double x;
+	memcpy(&x, &b, sizeof(double));
+	return x;
+}
+
+}
+
+AtomicDouble::AtomicDouble(double x) : bits(double_to_bits(x)) {
+
+}
+
+double AtomicDouble::get() const {
+	// note: a plain load may be torn on 32-bit platforms
+	return bits_to_double(__sync_fetch_and_add((volatile long long*) &bits, 0));
+}
+
+void AtomicDouble::set(double x) {
+	long long old=bits;
+	long long b=double_to_bits(x);
+	long long prev;
+	while ((prev=__sync_val_compare_and_swap(&bits, old, b))!=old)
+		old=prev;
+}
+
+bool AtomicDouble::update_min(double x) {
+	long long old=bits;
+	long long b=double_to_bits(x);
+	while (x < bits_to_double(old)) {
+		long long prev=__sync_val_compare_and_swap(&bits, old, b);
+		if (prev==old) return true;
+		old=prev;
+	}
+	return false;
+}
+
+Thread::Thread() : running(false) {
+
+}
+
+Thread::~Thread() {
+	if (running) join();
+}
+
+void* Thread::entry(void* thread) {
+	((Thread*) thread)->run();
+	return NULL;
+}
+
+void Thread::start() {
+	if (pthread_create(&tid, NULL, entry, this)!=0)
+		ibex_error("Thread: cannot create a new thread");
+	running=true;
+}
+
+void Thread::join() {
+	if (!running) return;
+	pthread_join(tid, NULL);
+	running=false;
+}
+
+int Thread::nb_cores() {
+#ifdef _SC_NPROCESSORS_ONLN
+	long n=sysconf(_SC_NPROCESSORS_ONLN);
+	return n>0 ? (int) n : 1;
+#else
+	return 1;
+#endif
+}
+
+double Thread::real_time() {
+	struct timeval tp;
+	gettimeofday(&tp, NULL);
+	return (double) tp.tv_sec + (double) tp.tv_usec / 1000000.0;
+}
+
+} // end namespace ibex
@@ -0,0 +1,162 @@
+//============================================================================
+//                                  I B E X                                   
+// File        : ibex_Thread.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+// Last Update : Oct 16, 2026
+//============================================================================
+
+#ifndef __IBEX_THREAD_H__
+#define __IBEX_THREAD_H__
+
+#include <pthread.h>
+
+namespace ibex {
+
+/** \ingroup tools
+ *
+ * \brief Mutual exclusion lock (thin wrapper around POSIX threads).
+ */
+class Mutex {
+public:
+	/** Create an unlocked mutex. */
+	Mutex();
+
+	/** Delete *this. */
+	~Mutex();
+
+	/** Lock the mutex (blocking). */
+	void lock();
+
+	/** Unlock the mutex. */
+	void unlock();
+
+private:
+	friend class Condition;
+	Mutex(const Mutex&); // forbidden
+	pthread_mutex_t m;
+};
+
+/** \ingroup tools
+ *
+ * \brief Scoped lock.
+ *
+ * Lock the mutex at construction and unlock it at destruction.
+ */
+class Lock {
+public:
+	Lock(Mutex& m) : m(m) { m.lock(); }
+	~Lock() { m.unlock(); }
+private:
+	Lock(const Lock&); // forbidden
+	Mutex& m;
+};
+
+/** \ingroup tools
+ *
+ * \brief Condition variable.
+ */
+class Condition {
+public:
+	/** Create a condition. */
+	Condition();
+
+	/** Delete *this. */
+	~Condition();
+
+	/**
+	 * \brief Wait until the condition is signaled or until
+	 * \a timeout seconds are elapsed.
+	 *
+	 * \pre \a m must be locked by the calling thread.
+	 */
+	void wait(Mutex& m, double timeout);
+
+	/** Wake up one waiting thread. */
+	void signal();
+
+	/** Wake up all the waiting threads. */
+	void broadcast();
+
+private:
+	Condition(const Condition&); // forbidden
+	pthread_cond_t c;
+};
+
+/** \ingroup tools
+ *
+ * \brief Double-precision value that can be read and lowered
+ * by several threads without lock.
+ *
+ * Used, e.g., to share the "loup" between the workers of
+ * the parallel optimizer.
+ */
+class AtomicDouble {
+public:
+	/** Create a shared value initialized to \a x. */
+	AtomicDouble(double x=0);
+
+	/** Read the value. */
+	double get() const;
+
+	/** Set the value (overwrite). */
+	void set(double x);
+
+	/**
+	 * \brief Replace the value by \a x if \a x is lower.
+	 *
+	 * \return true if the value has been decreased to \a x
+	 *         by this call.
+	 */
+	bool update_min(double x);
+
+private:
+	AtomicDouble(const AtomicDouble&); // forbidden
+
+	/* the bits of the double */
+	volatile long long bits;
+};
+
+/** \ingroup tools
+ *
+ * \brief Thread.
+ *
+ * Subclasses implement #run(). The thread is launched with #start()
+ * and must be joined with #join() before the object is deleted.
+ */
+class Thread {
+public:
+	/** Create a (not running) thread. */
+	Thread();
+
+	/** Delete *this. */
+	virtual ~Thread();
+
+	/** Launch #run() in a new thread. */
+	void start();
+
+	/** Wait for the termination of #run(). */
+	void join();
+
+	/** Number of hardware threads (at least 1). */
+	static int nb_cores();
+
+	/** Elapsed real time (in seconds) since an arbitrary origin. */
+	static double real_time();
+
+protected:
+	/** The code executed by the thread. */
+	virtual void run()=0;
+
+private:
+	Thread(const Thread&); // forbidden
+	static void* entry(void* thread);
+	pthread_t tid;
+	bool running;
+};
+
+} // end namespace ibex
+
+#endif // __IBEX_THREAD_H__
@@ -0,0 +1,47 @@
+//============================================================================
+//                                  I B E X
+// File        : ExSystem.cpp
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#include "ExSystem.h"
+#include "ibex_SystemFactory.h"
+
+namespace ibex {
+
+System* issue50_sys() {
+	SystemFactory f;
+	const ExprSymbol& x=ExprSymbol::new_();
+	f.add_var(x);
+	f.add_ctr(x>=0);
+	f.add_goal(x);
+	return new System(f);
+}
+
+System* quadratic_sys() {
+	SystemFactory f;
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+	f.add_var(x);
+	f.add_var(y);
+	f.add_ctr(x+y<=1);
+	f.add_goal(sqr(x-1)+sqr(y-2));
+	return new System(f);
+}
+
+System* circle_sys() {
+	SystemFactory f;
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+	f.add_var(x);
+	f.add_var(y);
+	f.add_ctr(sqr(x)+sqr(y)=1);
+	f.add_ctr(y-x=0);
+	return new System(f);
+}
+
+} // end namespace ibex
@@ -0,0 +1,35 @@
+//============================================================================
+//                                  I B E X
+// File        : ExSystem.h
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 17, 2026
+// Last Update : Oct 17, 2026
+//============================================================================
+
+#ifndef EXSYSTEM_H_
+#define EXSYSTEM_H_
+
+#include "ibex_System.h"
+
+namespace ibex {
+
+/*
+ * Systems shared by the tests of the strategies.
+ * Each function returns a new system, to be deleted by the caller.
+ */
+
+// minimize x s.t. x>=0.
+// true minimum is 0.
+System* issue50_sys();
+
+// minimize (x-1)^2+(y-2)^2 s.t. x+y<=1
+// true minimum is 2, reached at (0,1).
+System* quadratic_sys();
+
+// intersection of the unit circle and the line y=x
+System* circle_sys();
+
+} // end namespace ibex
+#endif // EXSYSTEM_H_
@@ -37,6 +37,72 @@ void TestAffine2::test02() {
 
 }
 
+typedef Affine2Main<AF_fAF2_sparse> SparseAffine2;
+
+// the sparse form x must be the dense form y, up to rounding
+static bool same_af2(const SparseAffine2& x, const Affine2& y) {
+	if (x.size()!=y.size()) return false;
+	if (!x.is_actif()) return x.itv()==y.itv();
+	double eps=1e-10*(1+y.itv().mag());
+	for (int i=0; i<=x.size(); i++)
+		if (fabs(x.val(i)-y.val(i))>eps) return false;
+	return fabs(x.err()-y.err())<=eps;
+}
+
+void TestAffine2::test_sparse01() {
+	int n=10;
+	IntervalVector box(n);
+	for (int i=0; i<n; i++) box[i]=Interval(i+1,i+1.5);
+
+	SparseAffine2 x0(n,1,box[0]), x1(n,2,box[1]), x3(n,4,box[3]);
+	Affine2 y0(n,1,box[0]), y1(n,2,box[1]), y3(n,4,box[3]);
+
+	SparseAffine2 x=x0*x1+3*x3-sqr(x0,box[0])-Interval(1,2);
+	Affine2 y=y0*y1+3*y3-sqr(y0,box[0])-Interval(1,2);
+
+	TEST_ASSERT(same_af2(x,y));
+	TEST_ASSERT(x.val(3)==0 && x.val(n)==0);
+	TEST_ASSERT(x.itv().is_subset(Interval(y.itv()).inflate(1e-10)));
+
+	x-=x0*x1;
+	y-=y0*y1;
+	TEST_ASSERT(same_af2(x,y));
+
+	// a noise symbol cancelled
+	x=x3-x3;
+	TEST_ASSERT(x.val(4)==0);
+	TEST_ASSERT(x.itv().is_subset(Interval(-1e-10,1e-10)));
+}
+
+void TestAffine2::test_sparse02() {
+	int n=5;
+	IntervalVector box(n,Interval(0.5,1));
+
+	SparseAffine2 x1(n,1,box[0]), x2(n,2,box[1]);
+	Affine2 y1(n,1,box[0]), y2(n,2,box[1]);
+
+	SparseAffine2 x=exp(x1)*x2/(x1+x2);
+	Affine2 y=exp(y1)*y2/(y1+y2);
+	TEST_ASSERT(same_af2(x,y));
+
+	Interval exact=exp(box[0])*box[1]/(box[0]+box[1]);
+	TEST_ASSERT(exact.mid()>=x.itv().lb() && exact.mid()<=x.itv().ub());
+
+	x=x1;
+	x+=Interval::ALL_REALS;
+	y=y1;
+	y+=Interval::ALL_REALS;
+	TEST_ASSERT(same_af2(x,y));
+
+	x=x2*SparseAffine2(Interval::EMPTY_SET);
+	TEST_ASSERT(x.is_empty());
+
+	// forms with a different number of variables
+	x=x1*SparseAffine2(n+1,3,box[2]);
+	y=y1*Affine2(n+1,3,box[2]);
+	TEST_ASSERT(same_af2(x,y));
+}
+
 void TestAffine2::test_pow2() {
 	Variable x;
 	Interval itv;
@@ -36,6 +36,9 @@ public:
 		TEST_ADD(TestAffine2::test_sinh);
 		TEST_ADD(TestAffine2::test_tanh);
 
+		TEST_ADD(TestAffine2::test_sparse01);
+		TEST_ADD(TestAffine2::test_sparse02);
+
 
 
 	}
@@ -72,6 +75,10 @@ public:
 	void test01();
 	void test02();
 
+	// AF_fAF2_sparse compared to AF_fAF2
+	void test_sparse01();
+	void test_sparse02(); // with non-linear functions and unbounded/empty forms
+
 };
 
 
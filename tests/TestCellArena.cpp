@@ -0,0 +1,173 @@
+/* ============================================================================
+ * I B E X - Cell Arena Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 16, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestCellArena.h"
+#include "ibex_CellArena.h"
+#include "ibex_Cell.h"
+#include "ibex_Bsc.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+class Depth : public Backtrackable {
+public:
+	Depth(int d=0) : d(d) { }
+
+	std::pair<Backtrackable*,Backtrackable*> down() {
+		return std::pair<Backtrackable*,Backtrackable*>(new Depth(d+1),new Depth(d+1));
+	}
+
+	int d;
+};
+
+}
+
+void TestCellArena::recycle01() {
+	CellArena arena;
+	CellArena::Scope scope(arena);
+
+	void* p=CellArena::alloc(40);
+	void* q=CellArena::alloc(100000); // large block
+	TEST_ASSERT(arena.nb_blocks()==2);
+	CellArena::free(p);
+	TEST_ASSERT(arena.nb_blocks()==1);
+	TEST_ASSERT(CellArena::alloc(33)==p);
+	CellArena::free(p);
+	CellArena::free(q);
+	TEST_ASSERT(arena.nb_blocks()==0);
+}
+
+void TestCellArena::bisect01() {
+	CellArena arena;
+	IntervalVector box(2,Interval(0,1));
+
+	Cell* root;
+	{
+		CellArena::Scope scope(arena);
+		root=new Cell(box);
+		root->add<BisectedVar>();
+	}
+	// cell + data array + data (the box is stored inside the cell)
+	TEST_ASSERT(arena.nb_blocks()==3);
+	TEST_ASSERT(CellArena::current()==NULL);
+
+	pair<IntervalVector,IntervalVector> boxes=box.bisect(0);
+	pair<Cell*,Cell*> cells=root->bisect(boxes.first,boxes.second);
+	TEST_ASSERT(arena.nb_blocks()==9);
+	TEST_ASSERT(cells.first->box==boxes.first);
+	TEST_ASSERT(cells.second->box==boxes.second);
+	TEST_ASSERT(cells.first->get<BisectedVar>().var==-1);
+
+	delete root;
+	delete cells.first;
+	TEST_ASSERT(arena.nb_blocks()==3);
+	delete cells.second;
+	TEST_ASSERT(arena.nb_blocks()==0);
+	TEST_ASSERT(arena.memory()>0);
+}
+
+void TestCellArena::bisect02() {
+	CellArena arena;
+	IntervalVector box(IntervalVector::INLINE_SIZE+1,Interval(0,1));
+
+	Cell* root;
+	{
+		CellArena::Scope scope(arena);
+		root=new Cell(box);
+		root->add<BisectedVar>();
+	}
+	// cell + box + data array + data
+	TEST_ASSERT(arena.nb_blocks()==4);
+
+	pair<IntervalVector,IntervalVector> boxes=box.bisect(0);
+	pair<Cell*,Cell*> cells=root->bisect(boxes.first,boxes.second);
+	TEST_ASSERT(arena.nb_blocks()==12);
+	TEST_ASSERT(cells.first->box==boxes.first);
+	TEST_ASSERT(cells.second->box==boxes.second);
+
+	delete root;
+	delete cells.first;
+	TEST_ASSERT(arena.nb_blocks()==4);
+	delete cells.second;
+	TEST_ASSERT(arena.nb_blocks()==0);
+}
+
+void TestCellArena::heap01() {
+	IntervalVector box(3,Interval(-1,1));
+	Cell* root=new Cell(box);
+	root->add<BisectedVar>();
+	pair<IntervalVector,IntervalVector> boxes=box.bisect(1);
+	pair<Cell*,Cell*> cells=root->bisect(boxes.first,boxes.second);
+	TEST_ASSERT(cells.second->box==boxes.second);
+	delete root;
+	delete cells.first;
+	delete cells.second;
+}
+
+void TestCellArena::orphan01() {
+	CellArena* arena=new CellArena();
+	Cell* c;
+	{
+		CellArena::Scope scope(*arena);
+		c=new Cell(IntervalVector(2,Interval(0,1)));
+	}
+	delete arena;
+	TEST_ASSERT(c->box[1]==Interval(0,1));
+	delete c;
+}
+
+void TestCellArena::slots01() {
+	int s1=Backtrackable::slot<BisectedVar>();
+	int s2=Backtrackable::slot<Depth>();
+	TEST_ASSERT(s1!=s2);
+	TEST_ASSERT(Backtrackable::slot<BisectedVar>()==s1);
+	TEST_ASSERT(s1<Backtrackable::nb_slots() && s2<Backtrackable::nb_slots());
+
+	Cell* c=new Cell(IntervalVector(1));
+	c->add<Depth>();
+	TEST_ASSERT(c->nb_data>s2);
+	TEST_ASSERT(s1>=c->nb_data || c->data[s1]==NULL);
+	c->add<BisectedVar>();
+	c->get<BisectedVar>().var=3;
+	TEST_ASSERT(c->data[s1]==&c->get<BisectedVar>());
+	TEST_ASSERT(c->get<BisectedVar>().var==3);
+
+	pair<Cell*,Cell*> cells=c->bisect(c->box,c->box);
+	TEST_ASSERT(cells.first->get<Depth>().d==1);
+	TEST_ASSERT(cells.second->get<BisectedVar>().var==3);
+	delete cells.first;
+	delete cells.second;
+	delete c;
+}
+
+void TestCellArena::resize01() {
+	CellArena arena;
+	IntervalVector box(IntervalVector::INLINE_SIZE+1,Interval(0,1));
+	Cell* c;
+	{
+		CellArena::Scope scope(arena);
+		c=new Cell(box);
+	}
+	TEST_THROWS(c->box.resize(2), InvalidIntervalVectorOp);
+	TEST_ASSERT(c->box==box);
+#if __cplusplus >= 201103L
+	IntervalVector moved(std::move(c->box));
+	TEST_ASSERT(moved==box);
+	TEST_ASSERT(c->box==box);
+#endif
+	delete c;
+	TEST_ASSERT(arena.nb_blocks()==0);
+}
+
+} // namespace ibex
@@ -0,0 +1,51 @@
+/* ============================================================================
+ * I B E X - Cell Arena Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 16, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_CELL_ARENA_H__
+#define __TEST_CELL_ARENA_H__
+
+#include "cpptest.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestCellArena : public TestIbex {
+
+public:
+	TestCellArena() {
+
+		TEST_ADD(TestCellArena::recycle01);
+		TEST_ADD(TestCellArena::bisect01);
+		TEST_ADD(TestCellArena::bisect02);
+		TEST_ADD(TestCellArena::heap01);
+		TEST_ADD(TestCellArena::orphan01);
+		TEST_ADD(TestCellArena::slots01);
+		TEST_ADD(TestCellArena::resize01);
+	}
+
+	// freed blocks are recycled
+	void recycle01();
+	// subcells and their data are allocated in the arena of the cell
+	void bisect01();
+	// same with a box too large to be stored inside the cell
+	void bisect02();
+	// cells allocated outside of any scope
+	void heap01();
+	// cells deleted after the arena
+	void orphan01();
+	// data are indexed by slots
+	void slots01();
+	// a box stored in the arena cannot be resized
+	void resize01();
+};
+
+} // namespace ibex
+#endif // __TEST_CELL_ARENA_H__
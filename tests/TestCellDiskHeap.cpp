@@ -0,0 +1,146 @@
+/* ============================================================================
+ * I B E X - Cell Disk Heap Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 16, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestCellDiskHeap.h"
+#include "ibex_CellDiskHeap.h"
+#include "ibex_OptimCell.h"
+#include "ibex_CellStack.h"
+#include "ibex_Solver.h"
+#include "ibex_RoundRobin.h"
+#include "ibex_CtcHC4.h"
+#include "ibex_SystemFactory.h"
+
+#include <stdlib.h>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// lower bound of the first variable
+class CellDiskHeapLB : public CellDiskHeap {
+public:
+	CellDiskHeapLB(int hot_capacity) : CellDiskHeap("test.cells", hot_capacity) { }
+
+	double cost(const Cell& c) const {
+		return c.box[0].lb();
+	}
+};
+
+Cell* new_cell(double x) {
+	Cell* c=new Cell(IntervalVector(2,Interval(x,x+1)));
+	c->add<BisectedVar>();
+	c->get<BisectedVar>().var=(int) x;
+	return c;
+}
+
+}
+
+void TestCellDiskHeap::order01() {
+	CellDiskHeapLB heap(4);
+
+	srand(1);
+	for (int i=0; i<100; i++)
+		heap.push(new_cell(rand()%1000));
+
+	TEST_ASSERT(heap.size()==100);
+	TEST_ASSERT(heap.nb_spilled()>=96);
+
+	double last=NEG_INFINITY;
+	while (!heap.empty()) {
+		Cell* c=heap.pop();
+		double x=c->box[0].lb();
+		TEST_ASSERT(x>=last);
+		TEST_ASSERT(c->box[1]==Interval(x,x+1));
+		TEST_ASSERT(c->get<BisectedVar>().var==(int) x);
+		last=x;
+		delete c;
+	}
+	TEST_ASSERT(heap.nb_spilled()==0);
+}
+
+void TestCellDiskHeap::interleave01() {
+	CellDiskHeapLB heap(6);
+
+	int nb=0;
+	for (int i=0; i<50; i++) {
+		heap.push(new_cell(100-i));
+		heap.push(new_cell(200+i));
+		heap.push(new_cell(i));
+		Cell* c=heap.pop();
+		TEST_ASSERT(c->box[0].lb()<=heap.minimum());
+		delete c;
+		nb+=2;
+	}
+	TEST_ASSERT(heap.size()==nb);
+	heap.flush();
+	TEST_ASSERT(heap.empty());
+	TEST_ASSERT(heap.nb_spilled()==0);
+}
+
+void TestCellDiskHeap::solver01() {
+	// the circle x^2+y^2=1 intersected with y=x^2
+	SystemFactory fac;
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	const ExprSymbol& y=ExprSymbol::new_("y");
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_ctr(sqr(x)+sqr(y)=1);
+	fac.add_ctr(y=sqr(x));
+	System sys(fac);
+
+	CtcHC4 hc4(sys);
+	RoundRobin rr1(1e-05), rr2(1e-05);
+	CellStack stack;
+	CellDiskHeapLB heap(4);
+
+	IntervalVector box(2,Interval(-2,2));
+
+	Solver s1(hc4,rr1,stack);
+	vector<IntervalVector> sols1=s1.solve(box);
+
+	Solver s2(hc4,rr2,heap);
+	vector<IntervalVector> sols2=s2.solve(box);
+
+	TEST_ASSERT(sols1.size()==sols2.size());
+	TEST_ASSERT(s1.nb_cells==s2.nb_cells);
+}
+
+void TestCellDiskHeap::optim01() {
+	CellDiskHeapLB heap(4);
+
+	for (int i=0; i<20; i++) {
+		OptimCell* c=new OptimCell(IntervalVector(2,Interval(i,i+1)));
+		c->add<BisectedVar>();
+		c->get<BisectedVar>().var=i;
+		c->pf=Interval(-i,i);
+		c->pu=1.0/(i+1);
+		c->loup=10*i;
+		heap.push(c);
+	}
+	TEST_ASSERT(heap.nb_spilled()>0);
+
+	for (int i=0; i<20; i++) {
+		OptimCell* c=dynamic_cast<OptimCell*>(heap.pop());
+		TEST_ASSERT(c!=NULL);
+		if (!c) continue;
+		TEST_ASSERT(c->box[0]==Interval(i,i+1));
+		TEST_ASSERT(c->get<BisectedVar>().var==i);
+		TEST_ASSERT(c->pf==Interval(-i,i));
+		TEST_ASSERT(c->pu==1.0/(i+1));
+		TEST_ASSERT(c->loup==10*i);
+		delete c;
+	}
+	TEST_ASSERT(heap.empty());
+}
+
+} // namespace ibex
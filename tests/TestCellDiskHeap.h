@@ -0,0 +1,42 @@
+/* ============================================================================
+ * I B E X - Cell Disk Heap Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 16, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_CELL_DISK_HEAP_H__
+#define __TEST_CELL_DISK_HEAP_H__
+
+#include "cpptest.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestCellDiskHeap : public TestIbex {
+
+public:
+	TestCellDiskHeap() {
+
+		TEST_ADD(TestCellDiskHeap::order01);
+		TEST_ADD(TestCellDiskHeap::interleave01);
+		TEST_ADD(TestCellDiskHeap::solver01);
+		TEST_ADD(TestCellDiskHeap::optim01);
+	}
+
+	// cells are popped in increasing order of cost, with their data
+	void order01();
+	// push and pop alternately
+	void interleave01();
+	// a solver with a bounded memory finds the same solutions
+	void solver01();
+	// cells read back are OptimCells with their fields
+	void optim01();
+};
+
+} // namespace ibex
+#endif // __TEST_CELL_DISK_HEAP_H__
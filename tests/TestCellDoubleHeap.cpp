@@ -0,0 +1,160 @@
+/* ============================================================================
+ * I B E X - Cell Double Heap Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 16, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestCellDoubleHeap.h"
+#include "ibex_CellDoubleHeap.h"
+
+#include <stdlib.h>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// a cell with objective estimate [lb,ub] (the variable "y" is the second one)
+OptimCell* new_cell(double lb, double ub) {
+	IntervalVector box(2);
+	box[1]=Interval(lb,ub);
+	return new OptimCell(box);
+}
+
+}
+
+void TestCellDoubleHeap::order01() {
+	CellDoubleHeap heap(1);
+
+	srand(1);
+	for (int i=0; i<100; i++) {
+		double lb=rand()%1000;
+		heap.push(new_cell(lb,lb+rand()%1000));
+	}
+	TEST_ASSERT(heap.size()==100);
+
+	double last=NEG_INFINITY;
+	for (int i=0; i<50; i++) {
+		OptimCell* c=heap.pop();
+		TEST_ASSERT(c->box[1].lb()>=last);
+		last=c->box[1].lb();
+		delete c;
+	}
+
+	last=NEG_INFINITY;
+	while (!heap.empty()) {
+		OptimCell* c=heap.pop2();
+		TEST_ASSERT(c->box[1].ub()>=last);
+		last=c->box[1].ub();
+		delete c;
+	}
+}
+
+void TestCellDoubleHeap::interleave01() {
+	CellDoubleHeap heap(1);
+
+	srand(2);
+	for (int i=0; i<200; i++) {
+		double lb=rand()%1000;
+		heap.push(new_cell(lb,lb+rand()%1000));
+	}
+
+	int nb=200;
+	while (!heap.empty()) {
+		OptimCell* c = nb%3==0 ? heap.pop2() : heap.pop();
+		TEST_ASSERT(c->heap_index==-1);
+		nb--;
+		TEST_ASSERT(heap.size()==nb);
+		if (!heap.empty()) {
+			TEST_ASSERT(heap.top()->heap_index>=0);
+			TEST_ASSERT(heap.top2()->box[1].ub()>=heap.minimum());
+		}
+		delete c;
+	}
+	TEST_ASSERT(nb==0);
+}
+
+void TestCellDoubleHeap::contract01() {
+	CellDoubleHeap heap(1);
+
+	for (int i=0; i<100; i++)
+		heap.push(new_cell(i,200-i));
+
+	heap.contract(49.5);
+	TEST_ASSERT(heap.size()==50);
+	TEST_ASSERT(heap.minimum()==0);
+
+	// the best cell w.r.t. the upper bound is now [49,151]
+	TEST_ASSERT(heap.top2()->box[1]==Interval(49,151));
+
+	vector<OptimCell*> cells;
+	heap.cells(cells);
+	TEST_ASSERT(cells.size()==50);
+	for (unsigned int i=0; i<cells.size(); i++)
+		TEST_ASSERT(cells[i]->box[1].lb()==i);
+
+	heap.flush();
+	TEST_ASSERT(heap.empty());
+}
+
+void TestCellDoubleHeap::contract02() {
+	CellDoubleHeap heap(1);
+
+	for (int i=0; i<10; i++)
+		heap.push(new_cell(i,20-i));
+
+	vector<OptimCell*> removed;
+	heap.contract(6.5, removed);
+	TEST_ASSERT(heap.size()==7);
+	TEST_ASSERT(removed.size()==3);
+	for (unsigned int i=0; i<removed.size(); i++) {
+		TEST_ASSERT(removed[i]->box[1].lb()>6.5);
+		delete removed[i];
+	}
+	TEST_ASSERT(heap.top2()->box[1]==Interval(6,14));
+	heap.flush();
+}
+
+void TestCellDoubleHeap::spill01() {
+	CellDoubleHeap heap(1);
+	heap.spill("test.cells",10);
+
+	srand(1);
+	for (int i=0; i<100; i++) {
+		double lb=rand()%1000;
+		heap.push(new_cell(lb,lb+rand()%1000));
+	}
+	TEST_ASSERT(heap.size()==100);
+	TEST_ASSERT(heap.nb_spilled()>=90);
+
+	// cells with a lower bound greater than 500 are discarded from the file
+	heap.contract(500);
+	TEST_ASSERT(heap.minimum()<=500);
+
+	double last=NEG_INFINITY;
+	int nb=0;
+	while (!heap.empty()) {
+		OptimCell* c;
+		if (nb%3==0)
+			// the second criterion only selects among the cells in memory
+			c=heap.pop2();
+		else {
+			c=heap.pop();
+			TEST_ASSERT(c->box[1].lb()>=last);
+			last=c->box[1].lb();
+		}
+		TEST_ASSERT(c->box[1].lb()<=500);
+		nb++;
+		delete c;
+	}
+	TEST_ASSERT(nb>0 && nb<100);
+	TEST_ASSERT(heap.nb_spilled()==0);
+}
+
+} // namespace ibex
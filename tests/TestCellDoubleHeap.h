@@ -0,0 +1,45 @@
+/* ============================================================================
+ * I B E X - Cell Double Heap Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 16, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_CELL_DOUBLE_HEAP_H__
+#define __TEST_CELL_DOUBLE_HEAP_H__
+
+#include "cpptest.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestCellDoubleHeap : public TestIbex {
+
+public:
+	TestCellDoubleHeap() {
+
+		TEST_ADD(TestCellDoubleHeap::order01);
+		TEST_ADD(TestCellDoubleHeap::interleave01);
+		TEST_ADD(TestCellDoubleHeap::contract01);
+		TEST_ADD(TestCellDoubleHeap::contract02);
+		TEST_ADD(TestCellDoubleHeap::spill01);
+	}
+
+	// cells are popped in the order of each criterion
+	void order01();
+	// a cell popped w.r.t. one criterion is removed from the other order
+	void interleave01();
+	// contraction removes the cells with a lower bound greater than the loup
+	void contract01();
+	// the removed cells are returned instead of being deleted
+	void contract02();
+	// cells spilled to a file are popped in the order of the first criterion
+	void spill01();
+};
+
+} // namespace ibex
+#endif // __TEST_CELL_DOUBLE_HEAP_H__
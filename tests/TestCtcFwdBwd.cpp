@@ -23,4 +23,20 @@ void TestCtcFwdBwd::sqrt_issue28() {
 	TEST_THROWS_ANYTHING(ctc.contract(box)); // should raise EmptyBoxException
 }
 
+void TestCtcFwdBwd::try_contract01() {
+	Variable x;
+	Function f(x,sqrt(x));
+	NumConstraint c(f);
+
+	CtcFwdBwd ctc(c);
+
+	IntervalVector box(1,Interval(-2,4));
+	TEST_ASSERT(ctc.try_contract(box));
+	TEST_ASSERT(box[0]==Interval::ZERO);
+
+	box[0]=Interval(-2,-1);
+	TEST_ASSERT(!ctc.try_contract(box)); // no exception
+	TEST_ASSERT(box.is_empty());
+}
+
 } // namespace ibex
@@ -21,9 +21,11 @@ public:
 
 	TestCtcFwdBwd() {
 		TEST_ADD(TestCtcFwdBwd::sqrt_issue28);
+		TEST_ADD(TestCtcFwdBwd::try_contract01);
 	}
 
 	void sqrt_issue28();
+	void try_contract01();
 };
 
 } // namespace ibex
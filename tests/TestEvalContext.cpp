@@ -0,0 +1,178 @@
+/* ============================================================================
+ * I B E X - Evaluation Context Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 16, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestEvalContext.h"
+#include "ibex_Function.h"
+#include "ibex_EvalContext.h"
+#include "ibex_Thread.h"
+#include "ibex_EmptyBoxException.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+const int NB_BOXES = 200;
+
+IntervalVector box(int k) {
+	IntervalVector b(2);
+	b[0]=Interval(-1+0.01*k,-0.9+0.01*k);
+	b[1]=Interval(0.5-0.005*k,0.7-0.005*k);
+	return b;
+}
+
+// f uses a sub-function (apply node) and g is vector-valued
+class Functions {
+public:
+	Functions() : h("a","b","a*b+cos(a)"), x(ExprSymbol::new_("x")), y(ExprSymbol::new_("y")),
+	              f(x,y,h(x,y)+sqr(y)-x), g("x","y","(x*y,x+sin(y))") { }
+
+	Function h;
+	const ExprSymbol& x;
+	const ExprSymbol& y;
+	Function f;
+	Function g;
+};
+
+// results of the evaluations for a given box
+class Results {
+public:
+	Results() : grad(2), jac(2,2), bwd(2) { }
+
+	void compute(Functions& fs, const IntervalVector& b) {
+		eval=fs.f.eval(b);
+		fs.f.gradient(b,grad);
+		fs.g.jacobian(b,jac);
+		bwd=b;
+		try {
+			fs.f.backward(Interval(0,1),bwd);
+		} catch(EmptyBoxException&) {
+			bwd.set_empty();
+		}
+	}
+
+	bool operator==(const Results& r) const {
+		return eval==r.eval && grad==r.grad && jac==r.jac && bwd==r.bwd;
+	}
+
+	Interval eval;
+	IntervalVector grad;
+	IntervalMatrix jac;
+	IntervalVector bwd;
+};
+
+class EvalThread : public Thread {
+public:
+	EvalThread(Functions& fs, const vector<Results>& ref, int first) :
+		fs(fs), ref(ref), first(first), nb_errors(0) { }
+
+	Functions& fs;
+	const vector<Results>& ref;
+	int first;
+	int nb_errors;
+
+protected:
+	void run() {
+		EvalContext context;
+		Results r;
+		for (int i=0; i<3*NB_BOXES; i++) {
+			int k=(first+i)%NB_BOXES;
+			r.compute(fs,box(k));
+			if (!(r==ref[k])) nb_errors++;
+		}
+	}
+};
+
+}
+
+void TestEvalContext::separate01() {
+	Functions fs;
+	IntervalVector b1=box(0);
+	IntervalVector b2=box(100);
+	Interval y1=fs.f.eval(b1);
+	Interval y2;
+	{
+		EvalContext context;
+		y2=fs.f.eval(b2);
+		TEST_ASSERT(fs.f.expr_label().d->i()==y2);
+		TEST_ASSERT(fs.f.expr().deco.d->i()==y1);
+	}
+	TEST_ASSERT(fs.f.expr_label().d->i()==y1);
+	TEST_ASSERT(y2==fs.f.eval(b2));
+}
+
+void TestEvalContext::nested01() {
+	Functions fs;
+	EvalContext c1;
+	Interval y1=fs.f.eval(box(0));
+	{
+		EvalContext c2;
+		TEST_ASSERT(EvalContext::current()==&c2);
+		fs.f.eval(box(100));
+	}
+	TEST_ASSERT(EvalContext::current()==&c1);
+	TEST_ASSERT(fs.f.expr_label().d->i()==y1);
+}
+
+void TestEvalContext::threads01() {
+	Functions fs;
+	vector<Results> ref(NB_BOXES);
+	for (int k=0; k<NB_BOXES; k++)
+		ref[k].compute(fs,box(k));
+
+	vector<EvalThread*> threads;
+	for (int i=0; i<4; i++)
+		threads.push_back(new EvalThread(fs,ref,i*NB_BOXES/4));
+	for (int i=0; i<4; i++)
+		threads[i]->start();
+	for (int i=0; i<4; i++) {
+		threads[i]->join();
+		TEST_ASSERT(threads[i]->nb_errors==0);
+		delete threads[i];
+	}
+}
+
+void TestEvalContext::reuse01() {
+	int id=EvalContext::new_id();
+	EvalContext::release_id(id);
+	TEST_ASSERT(EvalContext::new_id()==id);
+	EvalContext::release_id(id);
+
+	EvalContext context;
+	IntervalVector b(1,Interval(1,2));
+
+	const ExprSymbol& x1=ExprSymbol::new_("x");
+	Function* f1=new Function(x1,sqr(x1));
+	TEST_ASSERT(f1->eval(b)==Interval(1,4));
+	delete f1;
+
+	// f2 takes the identifier of f1 and must not use its workspace
+	const ExprSymbol& x2=ExprSymbol::new_("x");
+	Function* f2=new Function(x2,x2+1);
+	TEST_ASSERT(f2->eval(b)==Interval(2,3));
+	delete f2;
+}
+
+void TestEvalContext::arg01() {
+	const ExprSymbol& x=ExprSymbol::new_("x");
+	Function f(x,sqr(x));
+	f.write_arg_domains(IntervalVector(1,Interval(1,2)));
+	{
+		EvalContext context;
+		f.write_arg_domains(IntervalVector(1,Interval(3,4)));
+		TEST_ASSERT(f.arg_domains()[0].i()==Interval(3,4));
+		TEST_ASSERT(&f.arg_domains()[0]==&f.workspace().arg_domains[0]);
+	}
+	TEST_ASSERT(f.arg_domains()[0].i()==Interval(1,2));
+}
+
+} // end namespace
@@ -0,0 +1,45 @@
+/* ============================================================================
+ * I B E X - Evaluation Context Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 16, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_EVAL_CONTEXT_H__
+#define __TEST_EVAL_CONTEXT_H__
+
+#include "cpptest.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestEvalContext : public TestIbex {
+
+public:
+	TestEvalContext() {
+
+		TEST_ADD(TestEvalContext::separate01);
+		TEST_ADD(TestEvalContext::nested01);
+		TEST_ADD(TestEvalContext::threads01);
+		TEST_ADD(TestEvalContext::reuse01);
+		TEST_ADD(TestEvalContext::arg01);
+	}
+
+	// the context does not modify the labels of the DAG
+	void separate01();
+	// nested contexts
+	void nested01();
+	// the same function evaluated by 4 threads
+	void threads01();
+	// identifiers of deleted functions are reused
+	void reuse01();
+	// the argument domains of the calling thread
+	void arg01();
+};
+
+} // namespace ibex
+#endif // __TEST_EVAL_CONTEXT_H__
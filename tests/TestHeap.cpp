@@ -0,0 +1,100 @@
+/* ============================================================================
+ * I B E X - Heap Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 16, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestHeap.h"
+#include "ibex_Heap.h"
+
+#include <stdlib.h>
+#include <set>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+class DoubleHeap : public Heap<double> {
+public:
+	~DoubleHeap() { flush(); }
+
+	double cost(const double& x) const { return x; }
+};
+
+}
+
+void TestHeap::pop01() {
+	DoubleHeap heap;
+
+	srand(1);
+	for (int i=0; i<1000; i++)
+		heap.push(new double(rand()%100));
+
+	double last=NEG_INFINITY;
+	while (!heap.empty()) {
+		TEST_ASSERT(heap.minimum()==*heap.top());
+		double* x=heap.pop();
+		TEST_ASSERT(*x>=last);
+		last=*x;
+		delete x;
+	}
+}
+
+void TestHeap::contract01() {
+	DoubleHeap heap;
+
+	for (int i=0; i<100; i++)
+		heap.push(new double((i*37)%100));
+
+	heap.contract(49.5);
+	TEST_ASSERT(heap.size()==50);
+
+	for (int i=0; i<50; i++) {
+		double* x=heap.pop();
+		TEST_ASSERT(*x==i);
+		delete x;
+	}
+	TEST_ASSERT(heap.empty());
+}
+
+void TestHeap::contract02() {
+	DoubleHeap heap;
+	multiset<double> ref;
+
+	srand(2);
+	double threshold=1000;
+	for (int i=0; i<100; i++) {
+		for (int j=0; j<20; j++) {
+			double x=rand()%1000;
+			heap.push(new double(x));
+			ref.insert(x);
+		}
+		double* x=heap.pop();
+		TEST_ASSERT(*x==*ref.begin());
+		ref.erase(ref.begin());
+		delete x;
+
+		threshold-=5;
+		heap.contract(threshold);
+		ref.erase(ref.upper_bound(threshold),ref.end());
+
+		TEST_ASSERT(heap.size()==(int) ref.size());
+		if (!heap.empty()) TEST_ASSERT(heap.minimum()==*ref.begin());
+	}
+
+	while (!heap.empty()) {
+		double* x=heap.pop();
+		TEST_ASSERT(*x==*ref.begin());
+		ref.erase(ref.begin());
+		delete x;
+	}
+}
+
+} // namespace ibex
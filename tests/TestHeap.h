@@ -0,0 +1,39 @@
+/* ============================================================================
+ * I B E X - Heap Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 16, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_HEAP_H__
+#define __TEST_HEAP_H__
+
+#include "cpptest.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestHeap : public TestIbex {
+
+public:
+	TestHeap() {
+
+		TEST_ADD(TestHeap::pop01);
+		TEST_ADD(TestHeap::contract01);
+		TEST_ADD(TestHeap::contract02);
+	}
+
+	// elements are popped in increasing order of cost
+	void pop01();
+	// contraction removes the elements with a cost greater than the threshold
+	void contract01();
+	// contractions interleaved with push and pop
+	void contract02();
+};
+
+} // namespace ibex
+#endif // __TEST_HEAP_H__
@@ -10,6 +10,7 @@
  * ---------------------------------------------------------------------------- */
 
 #include "TestIntervalMatrix.h"
+#include "ibex_LinearKernel.h"
 #include "ibex_IntervalMatrix.h"
 #include "utils.h"
 
@@ -399,6 +400,134 @@ void TestIntervalMatrix::mul02() {
 	TEST_ASSERT((m2*=m1).is_empty());
 }
 
+static IntervalMatrix big_mat(int m, int n, double shift) {
+	IntervalMatrix A(m,n);
+	for (int i=0; i<m; i++)
+		for (int j=0; j<n; j++)
+			A[i][j]=Interval((i-j)/3.0-shift,(i-j)/3.0+shift+(i+j+1)/7.0);
+	return A;
+}
+
+static bool check_mul(const IntervalMatrix& A, const IntervalMatrix& B, const IntervalMatrix& C) {
+	for (int i=0; i<A.nb_rows(); i++)
+		for (int j=0; j<B.nb_cols(); j++) {
+			Interval c=Interval::ZERO;
+			for (int k=0; k<A.nb_cols(); k++) c+=A[i][k]*B[k][j];
+			if (c!=C[i][j]) return false;
+		}
+	return true;
+}
+
+void TestIntervalMatrix::mul03() {
+	IntervalMatrix A(big_mat(9,11,0.1));
+	IntervalMatrix B(big_mat(11,10,0.25));
+	Matrix mA(A.mid());
+	Matrix mB(B.mid());
+
+	TEST_ASSERT(check_mul(A,B,A*B));
+	TEST_ASSERT(check_mul(mA,B,mA*B));
+	TEST_ASSERT(check_mul(A,mB,A*mB));
+}
+
+void TestIntervalMatrix::mul04() {
+	IntervalMatrix A(big_mat(9,11,0.1));
+	IntervalMatrix B(big_mat(11,10,0.25));
+	A[2][0]=Interval::POS_REALS;
+	B[0][3]=Interval::ZERO;
+	B[5][1]=Interval::ALL_REALS;
+
+	TEST_ASSERT(check_mul(A,B,A*B));
+}
+
+void TestIntervalMatrix::mul05() {
+	IntervalMatrix A(big_mat(9,11,0.1));
+	IntervalMatrix x(big_mat(11,1,0.25));
+	IntervalMatrix v(x.mid());
+	IntervalMatrix mA(A.mid());
+
+	IntervalMatrix y(9,1); y.set_col(0,A*x.col(0));
+	IntervalMatrix w(9,1); w.set_col(0,A*v.col(0).mid());
+	IntervalMatrix z(9,1); z.set_col(0,A.mid()*x.col(0));
+
+	TEST_ASSERT(check_mul(A,x,y));
+	TEST_ASSERT(check_mul(A,v,w));
+	TEST_ASSERT(check_mul(mA,x,z));
+}
+
+// check that C2 encloses C1 and that the radii of C2 are not greater than
+// 1.5 times the radii of C1, up to the rounding errors (the bounds of C1 and
+// C2 are both rounded outward but not the same way)
+static bool check_midrad(const IntervalMatrix& C1, const IntervalMatrix& C2) {
+	for (int i=0; i<C1.nb_rows(); i++)
+		for (int j=0; j<C1.nb_cols(); j++) {
+			double eps=1e-12*C1[i][j].mag();
+			if (C2[i][j].lb()>C1[i][j].lb()+eps || C2[i][j].ub()<C1[i][j].ub()-eps) return false;
+			if (C2[i][j].rad()>1.5*C1[i][j].rad()+eps) return false;
+		}
+	return true;
+}
+
+void TestIntervalMatrix::mul_midrad01() {
+	IntervalMatrix A(big_mat(70,75,0.1));
+	IntervalMatrix B(big_mat(75,72,0.25));
+	Matrix mA(A.mid());
+	Matrix mB(B.mid());
+
+	// force the matrices to be split in several blocks
+	int block_size=LinearKernel::BLOCK_SIZE;
+	LinearKernel::BLOCK_SIZE=32;
+
+	TEST_ASSERT(check_midrad(A*B,mul(A,B,IntervalMatrix::MID_RAD)));
+	TEST_ASSERT(check_midrad(mA*B,mul(mA,B,IntervalMatrix::MID_RAD)));
+	TEST_ASSERT(check_midrad(A*mB,mul(A,mB,IntervalMatrix::MID_RAD)));
+
+	IntervalMatrix C(mul(IntervalMatrix(mA),mB,IntervalMatrix::MID_RAD));
+	TEST_ASSERT(check_midrad(IntervalMatrix(mA)*mB,C));
+	TEST_ASSERT(C.is_superset(mA*mB));
+
+	LinearKernel::BLOCK_SIZE=block_size;
+}
+
+void TestIntervalMatrix::mul_midrad02() {
+	IntervalMatrix A(big_mat(9,11,0.1));
+	IntervalMatrix B(big_mat(11,10,0.25));
+	A[2][0]=Interval::POS_REALS;
+	B[0][3]=Interval::ZERO;
+
+	TEST_ASSERT(mul(A,B,IntervalMatrix::MID_RAD)==A*B);
+	TEST_ASSERT(mul(IntervalMatrix::empty(9,11),B,IntervalMatrix::MID_RAD).is_empty());
+}
+
+void TestIntervalMatrix::mul_midrad03() {
+	IntervalMatrix A(big_mat(9,11,0.1));
+	IntervalMatrix B(big_mat(11,10,0.25));
+	IntervalMatrix C(mul(A,B,IntervalMatrix::MID_RAD));
+	TEST_ASSERT(C!=A*B);
+
+	IntervalMatrix::default_product_mode=IntervalMatrix::MID_RAD;
+	IntervalMatrix C2(A*B);
+	IntervalMatrix C3(A);
+	C3*=B;
+	IntervalMatrix::default_product_mode=IntervalMatrix::INF_SUP;
+
+	TEST_ASSERT(C2==C);
+	TEST_ASSERT(C3==C);
+}
+
+void TestIntervalMatrix::move01() {
+#if __cplusplus >= 201103L
+	IntervalMatrix A=big_mat(5,20,1);
+	IntervalMatrix B(A);
+	IntervalMatrix C(std::move(B));
+	TEST_ASSERT(C==A);
+	IntervalMatrix D(5,20);
+	D=A*IntervalMatrix(20,20,Interval(1));
+	IntervalMatrix E(5,20);
+	E=std::move(D);
+	TEST_ASSERT(E==A*IntervalMatrix(20,20,Interval(1)));
+#endif
+}
+
 void TestIntervalMatrix::put01() {
 
 	IntervalMatrix M1=2*Matrix::eye(3);
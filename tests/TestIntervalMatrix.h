@@ -69,6 +69,14 @@ public:
 
 		TEST_ADD(TestIntervalMatrix::mul01);
 		TEST_ADD(TestIntervalMatrix::mul02);
+		TEST_ADD(TestIntervalMatrix::mul03);
+		TEST_ADD(TestIntervalMatrix::mul04);
+		TEST_ADD(TestIntervalMatrix::mul05);
+		TEST_ADD(TestIntervalMatrix::mul_midrad01);
+		TEST_ADD(TestIntervalMatrix::mul_midrad02);
+		TEST_ADD(TestIntervalMatrix::mul_midrad03);
+
+		TEST_ADD(TestIntervalMatrix::move01);
 
 		TEST_ADD(TestIntervalMatrix::put01);
 	}
@@ -163,6 +171,25 @@ public:
 	//  operator*=(const IntervalMatrix& x)
 	void mul01();
 	void mul02();
+	void mul03(); // large matrices (see LinearKernel)
+	void mul04(); // large matrices with infinite bounds
+
+	// test:
+	//  operator*(const IntervalMatrix& m, const IntervalVector& x)
+	//  on a large matrix (see LinearKernel)
+	void mul05();
+
+	// test:
+	//  mul(const IntervalMatrix& m1, const IntervalMatrix& m2, IntervalMatrix::MID_RAD)
+	//  (and mixed forms with Matrix)
+	void mul_midrad01();
+	void mul_midrad02(); // with infinite bounds
+	void mul_midrad03(); // IntervalMatrix::default_product_mode
+
+	// test:
+	//  IntervalMatrix(IntervalMatrix&& m)
+	//  operator=(IntervalMatrix&& m)
+	void move01();
 
 	void put01();
 };
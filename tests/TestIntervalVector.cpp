@@ -114,6 +114,34 @@ void TestIntervalVector::resize04() {
 	check(x[1],Interval(3,4));
 }
 
+void TestIntervalVector::resize05() {
+	int n=IntervalVector::INLINE_SIZE;
+	IntervalVector x(n-2);
+	for (int i=0; i<n-2; i++) x[i]=Interval(i,i+1);
+	x.resize(n+2);
+	TEST_ASSERT(x.size()==n+2);
+	for (int i=0; i<n-2; i++) check(x[i],Interval(i,i+1));
+	for (int i=n-2; i<n+2; i++) TEST_ASSERT(x[i]==Interval::ALL_REALS);
+	x.resize(3);
+	TEST_ASSERT(x.size()==3);
+	for (int i=0; i<3; i++) check(x[i],Interval(i,i+1));
+	IntervalVector y(x);
+	y.resize(n);
+	TEST_ASSERT(y.subvector(0,2)==x);
+	TEST_ASSERT(y[n-1]==Interval::ALL_REALS);
+}
+
+void TestIntervalVector::resize06() {
+#if __cplusplus >= 201103L
+	// the inline storage must be aligned as an Interval,
+	// even when the vector itself is not
+	struct { char c; IntervalVector x; } s = { 'a', IntervalVector(2) };
+	TEST_ASSERT(((size_t) &s.x[0]) % alignof(Interval) == 0);
+	s.x.resize(IntervalVector::INLINE_SIZE);
+	TEST_ASSERT(((size_t) &s.x[0]) % alignof(Interval) == 0);
+#endif
+}
+
 static double _x[][2]={{0,1},{2,3},{4,5}};
 
 void TestIntervalVector::subvector01() {
@@ -555,6 +583,41 @@ void TestIntervalVector::sub01() {
 	check(IntervalVector(x2)-=x1,-x3);
 }
 
+static IntervalVector big_vec(int n, double shift) {
+	IntervalVector x(n);
+	for (int i=0; i<n; i++)
+		x[i]=Interval((i-n/2)/3.0-shift,(i-n/2)/3.0+shift+(i+1)/7.0);
+	return x;
+}
+
+void TestIntervalVector::mul01() {
+	IntervalVector x(big_vec(13,0.1));
+	IntervalVector y(big_vec(13,0.25));
+	Vector v(y.mid());
+
+	Interval d=Interval::ZERO;
+	Interval e=Interval::ZERO;
+	for (int i=0; i<13; i++) {
+		d+=x[i]*y[i];
+		e+=x[i]*v[i];
+	}
+	TEST_ASSERT((x*y)==d);
+	TEST_ASSERT((x*v)==e);
+	TEST_ASSERT((v*x)==e);
+}
+
+void TestIntervalVector::mul02() {
+	IntervalVector x(big_vec(13,0.1));
+	IntervalVector y(big_vec(13,0.25));
+	x[0]=Interval::POS_REALS;
+	y[0]=Interval::ZERO;
+	x[1]=Interval::ALL_REALS;
+
+	Interval d=Interval::ZERO;
+	for (int i=0; i<13; i++) d+=x[i]*y[i];
+	TEST_ASSERT((x*y)==d);
+}
+
 void TestIntervalVector::compl01() {
 	double _b[][2]={{0,1},{0,1}};
 	IntervalVector b(2,_b);
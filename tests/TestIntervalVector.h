@@ -38,6 +38,8 @@ public:
 		TEST_ADD(TestIntervalVector::resize02);
 		TEST_ADD(TestIntervalVector::resize03);
 		TEST_ADD(TestIntervalVector::resize04);
+		TEST_ADD(TestIntervalVector::resize05);
+		TEST_ADD(TestIntervalVector::resize06);
 
 		TEST_ADD(TestIntervalVector::subvector01);
 		TEST_ADD(TestIntervalVector::subvector02);
@@ -107,6 +109,9 @@ public:
 
 		TEST_ADD(TestIntervalVector::sub01);
 
+		TEST_ADD(TestIntervalVector::mul01);
+		TEST_ADD(TestIntervalVector::mul02);
+
 		TEST_ADD(TestIntervalVector::compl01);
 		TEST_ADD(TestIntervalVector::compl02);
 
@@ -148,6 +153,8 @@ public:
 	void resize02();
 	void resize03();
 	void resize04();
+	void resize05(); // across INLINE_SIZE
+	void resize06(); // alignment of the inline storage
 
 	// test: subvector(int start_index, int end_index)
 	void subvector01();
@@ -250,6 +257,13 @@ public:
 	//  operator-=(const IntervalVector& x)
 	void sub01();
 
+	// test:
+	//  operator*(const IntervalVector& x, const IntervalVector& y)
+	//  operator*(const IntervalVector& x, const Vector& y)
+	//  on large vectors (see LinearKernel)
+	void mul01();
+	void mul02(); // with infinite bounds
+
 	// test: complementary(IntervalVector*& result) const
 	void compl01();
 	void compl02();
@@ -93,4 +93,74 @@ void TestLinear::inflating_gauss_seidel03() {
 	TEST_ASSERT(!ret);
 }
 
+void TestLinear::sparse_gauss_seidel01() {
+	int n=5;
+	IntervalMatrix A(n,n,Interval::ZERO);
+	for (int i=0; i<n; i++) {
+		A[i][i]=Interval(3.9,4.1);
+		if (i>0) A[i][i-1]=Interval(-1.1,-0.9);
+		if (i<n-1) A[i][i+1]=Interval(0.9,1.1);
+	}
+	IntervalVector b(n,Interval(0.9,1.1));
+
+	SparseIntervalMatrix S(A);
+	TEST_ASSERT(S.nb_nonzeros()==3*n-2);
+	TEST_ASSERT(S.index(0,2)==-1);
+	check(S(2,1),Interval(-1.1,-0.9));
+	check(S(0,4),Interval::ZERO);
+
+	IntervalVector x1(n,Interval(-10,10));
+	IntervalVector x2(x1);
+	gauss_seidel(A,b,x1);
+	gauss_seidel(S,b,x2);
+	TEST_ASSERT(x1.is_strict_subset(IntervalVector(n,Interval(-10,10))));
+	check(x2,x1);
+}
+
+void TestLinear::sparse_precond01() {
+	double _A[4*4]={2,1,0,0,
+				    1,3,0,0,
+				    0,0,4,1,
+				    0,0,2,5};
+	IntervalMatrix A(4,4);
+	for (int i=0; i<4; i++)
+		for (int j=0; j<4; j++)
+			A[i][j]=_A[i*4+j]==0? Interval::ZERO : _A[i*4+j]+Interval(-0.01,0.01);
+
+	IntervalVector b(4,Interval(1,2));
+
+	SparseIntervalMatrix S(A);
+	IntervalVector c(b);
+	precond(A,b);
+	precond(S,c);
+
+	// the inverse of the midpoint matrix is block-diagonal
+	TEST_ASSERT(S.nb_nonzeros()==8);
+	for (int i=0; i<4; i++)
+		TEST_ASSERT(almost_eq(S.dense()[i],A[i],1e-12));
+	TEST_ASSERT(almost_eq(c,b,1e-12));
+}
+
+void TestLinear::sparse_mul01() {
+	double _A[3*4]={1,0,2,0,
+				    0,0,3,0,
+				    4,0,0,5};
+	IntervalMatrix A(3,4);
+	for (int i=0; i<3; i++)
+		for (int j=0; j<4; j++)
+			A[i][j]=_A[i*4+j]==0? Interval::ZERO : _A[i*4+j]+Interval(-0.1,0.1);
+
+	double _C[2*3]={1,-1,0,
+				    0.5,0,2};
+	Matrix C(2,3,_C);
+
+	SparseIntervalMatrix S(A);
+	SparseIntervalMatrix P=sparse_mul(C,S);
+
+	// the column 1 of A is zero, and also (C*A)[0][3]
+	TEST_ASSERT(P.nb_nonzeros()==5);
+	TEST_ASSERT(P.index(0,3)==-1);
+	TEST_ASSERT(P.dense()==C*S);
+}
+
 } // end namespace ibex
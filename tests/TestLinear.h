@@ -26,6 +26,9 @@ public:
 		TEST_ADD(TestLinear::inflating_gauss_seidel01);
 		TEST_ADD(TestLinear::inflating_gauss_seidel02);
 		TEST_ADD(TestLinear::inflating_gauss_seidel03);
+		TEST_ADD(TestLinear::sparse_gauss_seidel01);
+		TEST_ADD(TestLinear::sparse_precond01);
+		TEST_ADD(TestLinear::sparse_mul01);
 	}
 
 	void lu_partial_underctr();
@@ -38,6 +41,12 @@ public:
 	void inflating_gauss_seidel02();
 	// divergence, start with thick vector
 	void inflating_gauss_seidel03();
+	// same result as with the dense matrix (tridiagonal matrix)
+	void sparse_gauss_seidel01();
+	// the structure of a block-diagonal matrix is kept
+	void sparse_precond01();
+	// sparse product with zero columns and zero entries
+	void sparse_mul01();
 };
 
 } // end namespace ibex
@@ -0,0 +1,103 @@
+/* ============================================================================
+ * I B E X - Native Function Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 16, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestNativeFunction.h"
+#include "ibex_NativeFunction.h"
+#include "ibex_HC4Revise.h"
+
+#include <cstdio>
+
+using namespace std;
+
+namespace ibex {
+
+void TestNativeFunction::eval01() {
+	Variable x(2),y;
+	Function f(x,y,Return(x[0]*y+sqr(x[1])-exp(x[0])/(0.1+y),sqrt(x[1]-y),pow(atan2(y,x[0]),3)));
+	NativeFunction nf(f);
+
+	IntervalVector box(3);
+	box[0]=Interval(1,2);
+	box[1]=Interval(-1,3);
+	box[2]=Interval(2,4);
+
+	TEST_ASSERT(nf.eval_vector(box)==f.eval_vector(box));
+
+	box[1]=Interval(0,1); // sqrt of negative numbers
+	TEST_ASSERT(nf.eval_vector(box).is_empty());
+}
+
+void TestNativeFunction::proj01() {
+	Variable x,y;
+	Function f(x,y,x+sqr(y)-log(y));
+	NativeFunction nf(f);
+
+	IntervalVector box(2);
+	box[0]=Interval(0,1);
+	box[1]=Interval(-4,4);
+
+	IntervalVector box2(box);
+	Interval z(4,5);
+	Domain d(z);
+	TEST_ASSERT(!nf.proj(d,box));
+	HC4Revise().try_proj(f,d,box2);
+	TEST_ASSERT(box==box2);
+
+	box[1]=Interval(-4,0);
+	TEST_ASSERT(!nf.proj(d,box));
+	TEST_ASSERT(box.is_empty());
+}
+
+void TestNativeFunction::jac01() {
+	Variable x,y;
+	Function f(x,y,Return(x*y+sin(x),max(x,y)*cos(x*y),abs(x-y)/(1+sqr(y))));
+	NativeFunction nf(f);
+
+	IntervalVector box(2);
+	box[0]=Interval(1,2);
+	box[1]=Interval(-1,3);
+
+	TEST_ASSERT(nf.jacobian(box)==f.jacobian(box));
+
+	Function g(x,y,x*y+sin(x));
+	NativeFunction ng(g);
+	TEST_ASSERT(ng.gradient(box)==g.gradient(box));
+	TEST_ASSERT(ng.eval(box)==g.eval(box));
+}
+
+void TestNativeFunction::cache01() {
+	Variable x,y;
+	Function f(x,y,x*exp(y)-1);
+	Function g(x,y,x*exp(y)-1);
+
+	NativeFunction nf(f);
+	NativeFunction ng(g);
+	TEST_ASSERT(nf.library()==ng.library());
+
+	Function h(x,y,x*exp(y)-2);
+	NativeFunction nh(h);
+	TEST_ASSERT(nf.library()!=nh.library());
+}
+
+void TestNativeFunction::cache02() {
+	Variable x,y;
+	Function f(x,y,x*exp(y)-1);
+
+	bool thrown=false;
+	try {
+		NativeFunction nf(f,P_tmpdir);  // writable by all the users
+	} catch(NativeCodeException&) {
+		thrown=true;
+	}
+	TEST_ASSERT(thrown);
+}
+
+} // namespace ibex
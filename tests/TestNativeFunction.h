@@ -0,0 +1,46 @@
+/* ============================================================================
+ * I B E X - Native Function Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 16, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_NATIVE_FUNCTION_H__
+#define __TEST_NATIVE_FUNCTION_H__
+
+#include "cpptest.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestNativeFunction : public TestIbex {
+
+public:
+	TestNativeFunction() {
+
+		TEST_ADD(TestNativeFunction::eval01);
+		TEST_ADD(TestNativeFunction::proj01);
+		TEST_ADD(TestNativeFunction::jac01);
+		TEST_ADD(TestNativeFunction::cache01);
+		TEST_ADD(TestNativeFunction::cache02);
+	}
+
+	// vector-valued function with constants (same result as the tape)
+	void eval01();
+	// HC4Revise (same result as the tape), with an empty result
+	void proj01();
+	// gradient and Jacobian (same result as the tape)
+	void jac01();
+	// the library is reused by a second native function
+	void cache01();
+	// a shared cache directory is rejected
+	void cache02();
+};
+
+} // namespace ibex
+
+#endif // __TEST_NATIVE_FUNCTION_H__
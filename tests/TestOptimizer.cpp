@@ -12,7 +12,11 @@
 #include "TestOptimizer.h"
 #include "ibex_Optimizer.h"
 #include "ibex_DefaultOptimizer.h"
-#include "ibex_SystemFactory.h"
+#include "ibex_CtcHC4.h"
+#include "ibex_RoundRobin.h"
+#include "ExSystem.h"
+
+#include <stdio.h>
 
 using namespace std;
 
@@ -20,17 +24,14 @@ namespace ibex {
 
 // true minimum is 0.
 Optimizer::Status issue50(double init_loup, double prec) {
-	SystemFactory f;
-	const ExprSymbol& x=ExprSymbol::new_();
-	f.add_var(x);
-	f.add_ctr(x>=0);
-	f.add_goal(x);
-
-	System sys(f);
-	DefaultOptimizer o(sys,prec,prec);
+	System* sys=issue50_sys();
+	DefaultOptimizer* o=new DefaultOptimizer(*sys,prec,prec);
 
 	IntervalVector init_box(1,Interval::ALL_REALS);
-	return o.optimize(init_box,init_loup);
+	Optimizer::Status status=o->optimize(init_box,init_loup);
+	delete o;
+	delete sys;
+	return status;
 }
 
 void TestOptimizer::issue50_1() {
@@ -49,5 +50,64 @@ void TestOptimizer::issue50_4() {
 	TEST_ASSERT(issue50(-1e-10, 0)==Optimizer::INFEASIBLE);
 }
 
+void TestOptimizer::checkpoint01() {
+	IntervalVector init_box(2,Interval(-10,10));
+	double prec=1e-07;
+	string file=tmp_file();
+
+	System* sys1=quadratic_sys();
+	DefaultOptimizer* o1=new DefaultOptimizer(*sys1,prec,prec);
+	o1->cell_limit=20;
+	TEST_ASSERT(o1->optimize(init_box)==Optimizer::CELL_LIMIT);
+	TEST_ASSERT(o1->buffer.size()>0);
+	int nb_cells=o1->nb_cells;
+	double uplo=o1->uplo;
+	o1->save(file.c_str());
+	delete o1;
+	delete sys1;
+
+	System* sys2=quadratic_sys();
+	DefaultOptimizer* o2=new DefaultOptimizer(*sys2,prec,prec);
+	TEST_ASSERT(o2->resume(file.c_str())==Optimizer::SUCCESS);
+	TEST_ASSERT(o2->nb_cells>nb_cells);
+	TEST_ASSERT(o2->uplo>=uplo);
+	TEST_ASSERT(o2->uplo<=2 && o2->loup>=2);
+	TEST_ASSERT(o2->loup-o2->uplo<=1e-06);
+	TEST_ASSERT(o2->buffer.empty());
+	delete o2;
+	delete sys2;
+
+	remove(file.c_str());
+}
+
+void TestOptimizer::critpr01() {
+	System* sys=issue50_sys();
+	{
+		ExtendedSystem ext_sys(*sys,Optimizer::default_equ_eps);
+		CtcHC4 hc4(ext_sys.ctrs);
+		RoundRobin rr(1e-03);
+		// built with a single criterion
+		Optimizer o(*sys,hc4,rr,1e-03,1e-03,1e-03,1,Optimizer::default_equ_eps,false,0);
+		o.critpr=100;
+		TEST_ASSERT(o.optimize(IntervalVector(1,Interval(0,1)))==Optimizer::SUCCESS);
+		TEST_ASSERT(o.uplo<=0 && o.loup>=0);
+	}
+	delete sys;
+}
+
+void TestOptimizer::spill01() {
+	IntervalVector init_box(2,Interval(-10,10));
+	double prec=1e-07;
+
+	System* sys=quadratic_sys();
+	DefaultOptimizer* o=new DefaultOptimizer(*sys,prec,prec);
+	o->buffer.spill(tmp_file().c_str(),4); // the file is removed by the buffer
+	TEST_ASSERT(o->optimize(init_box)==Optimizer::SUCCESS);
+	TEST_ASSERT(o->uplo<=2 && o->loup>=2);
+	TEST_ASSERT(o->loup-o->uplo<=1e-06);
+	TEST_ASSERT(o->buffer.empty());
+	delete o;
+	delete sys;
+}
 
 } // end namespace
@@ -26,6 +26,9 @@ public:
 		TEST_ADD(TestOptimizer::issue50_2);
 		TEST_ADD(TestOptimizer::issue50_3);
 		TEST_ADD(TestOptimizer::issue50_4);
+		TEST_ADD(TestOptimizer::checkpoint01);
+		TEST_ADD(TestOptimizer::critpr01);
+		TEST_ADD(TestOptimizer::spill01);
 	}
 
 	// upperbounding with goal_prec=10% will remove everything (initial loup > true minimum) --> NO_FEASIBLE_FOUND
@@ -36,6 +39,12 @@ public:
 	void issue50_3();
 	// upperbounding with goal_prec=0 will make the optimizer fail (initial loup < true minimum) --> INFEASIBLE
 	void issue50_4();
+	// interrupted search saved into a file and resumed by another optimizer
+	void checkpoint01();
+	// critpr set after the construction of the optimizer
+	void critpr01();
+	// buffer with a bounded memory
+	void spill01();
 };
 
 } // namespace ibex
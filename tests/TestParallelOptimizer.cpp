@@ -0,0 +1,84 @@
+/* ============================================================================
+ * I B E X - Parallel Optimizer Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 16, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestParallelOptimizer.h"
+#include "ibex_ParallelOptimizer.h"
+#include "ibex_DefaultOptimizer.h"
+#include "ExSystem.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+Optimizer::Status par_optimize(System* (*build)(), const IntervalVector& init_box, int nb_threads, double prec, double init_loup,
+		double& loup, double& uplo, Vector& loup_point) {
+	vector<System*> sys(nb_threads);
+	Array<Optimizer> opt(nb_threads);
+	for (int i=0; i<nb_threads; i++) {
+		sys[i]=build();
+		opt.set_ref(i,*new DefaultOptimizer(*sys[i],prec,prec));
+	}
+	ParallelOptimizer o(opt);
+	Optimizer::Status status=o.optimize(init_box,init_loup);
+	loup=o.loup;
+	uplo=o.uplo;
+	loup_point=o.loup_point;
+
+	for (int i=0; i<nb_threads; i++) {
+		delete &opt[i];
+		delete sys[i];
+	}
+	return status;
+}
+
+Optimizer::Status par_issue50(double init_loup, double prec) {
+	double loup,uplo;
+	Vector loup_point(1);
+	return par_optimize(issue50_sys,IntervalVector(1,Interval::ALL_REALS),3,prec,init_loup,loup,uplo,loup_point);
+}
+
+Optimizer::Status par_quadratic(int nb_threads, double& loup, double& uplo, Vector& loup_point) {
+	return par_optimize(quadratic_sys,IntervalVector(2,Interval(-10,10)),nb_threads,1e-07,POS_INFINITY,loup,uplo,loup_point);
+}
+
+}
+
+void TestParallelOptimizer::issue50_1() {
+	TEST_ASSERT(par_issue50(1e-10, 0.1)==Optimizer::NO_FEASIBLE_FOUND);
+}
+
+void TestParallelOptimizer::issue50_4() {
+	TEST_ASSERT(par_issue50(-1e-10, 0)==Optimizer::INFEASIBLE);
+}
+
+void TestParallelOptimizer::quadratic01() {
+	double loup,uplo;
+	Vector loup_point(2);
+	TEST_ASSERT(par_quadratic(1,loup,uplo,loup_point)==Optimizer::SUCCESS);
+	TEST_ASSERT(uplo<=2 && 2<=loup);
+	TEST_ASSERT(loup-uplo<=1e-05);
+	TEST_ASSERT_DELTA(loup_point[0],0,1e-03);
+	TEST_ASSERT_DELTA(loup_point[1],1,1e-03);
+}
+
+void TestParallelOptimizer::quadratic02() {
+	double loup,uplo;
+	Vector loup_point(2);
+	TEST_ASSERT(par_quadratic(4,loup,uplo,loup_point)==Optimizer::SUCCESS);
+	TEST_ASSERT(uplo<=2 && 2<=loup);
+	TEST_ASSERT(loup-uplo<=1e-05);
+	TEST_ASSERT_DELTA(loup_point[0],0,1e-03);
+	TEST_ASSERT_DELTA(loup_point[1],1,1e-03);
+}
+
+} // end namespace
@@ -0,0 +1,42 @@
+/* ============================================================================
+ * I B E X - Parallel Optimizer Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 16, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_PARALLEL_OPTIMIZER_H__
+#define __TEST_PARALLEL_OPTIMIZER_H__
+
+#include "cpptest.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestParallelOptimizer : public TestIbex {
+
+public:
+	TestParallelOptimizer() {
+
+		TEST_ADD(TestParallelOptimizer::issue50_1);
+		TEST_ADD(TestParallelOptimizer::issue50_4);
+		TEST_ADD(TestParallelOptimizer::quadratic01);
+		TEST_ADD(TestParallelOptimizer::quadratic02);
+	}
+
+	// same as TestOptimizer::issue50_1 with 3 workers --> NO_FEASIBLE_FOUND
+	void issue50_1();
+	// same as TestOptimizer::issue50_4 with 3 workers --> INFEASIBLE
+	void issue50_4();
+	// constrained quadratic problem, 1 worker
+	void quadratic01();
+	// constrained quadratic problem, 4 workers
+	void quadratic02();
+};
+
+} // namespace ibex
+#endif // __TEST_PARALLEL_OPTIMIZER_H__
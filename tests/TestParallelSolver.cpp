@@ -0,0 +1,96 @@
+/* ============================================================================
+ * I B E X - Parallel Solver Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 16, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestParallelSolver.h"
+#include "ibex_ParallelSolver.h"
+#include "ibex_Solver.h"
+#include "ibex_CtcHC4.h"
+#include "ibex_RoundRobin.h"
+#include "ibex_CellStack.h"
+#include <algorithm>
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+// intersection of the unit circle and the line y=x
+class Circle {
+public:
+	Circle() : f("x","y","(x^2+y^2-1,y-x)"), c1(f[0],EQ), c2(f[1],EQ),
+	           ctrs(c1,c2), hc4(ctrs), bsc(1e-3) { }
+
+	Function f;
+	NumConstraint c1,c2;
+	Array<NumConstraint> ctrs;
+	CtcHC4 hc4;
+	RoundRobin bsc;
+};
+
+bool lex_lt(const IntervalVector& x, const IntervalVector& y) {
+	return x[0].lb()<y[0].lb();
+}
+
+vector<IntervalVector> par_solve(int nb_threads, long cell_limit=-1) {
+	vector<Circle*> c(nb_threads);
+	Array<Ctc> ctc(nb_threads);
+	Array<Bsc> bsc(nb_threads);
+	for (int i=0; i<nb_threads; i++) {
+		c[i]=new Circle();
+		ctc.set_ref(i,c[i]->hc4);
+		bsc.set_ref(i,c[i]->bsc);
+	}
+	ParallelSolver s(ctc,bsc);
+	s.cell_limit=cell_limit;
+	vector<IntervalVector> sols=s.solve(IntervalVector(2,Interval(-10,10)));
+	for (int i=0; i<nb_threads; i++) delete c[i];
+	sort(sols.begin(),sols.end(),lex_lt);
+	return sols;
+}
+
+vector<IntervalVector> seq_solve() {
+	Circle c;
+	CellStack buff;
+	Solver s(c.hc4,c.bsc,buff);
+	vector<IntervalVector> sols=s.solve(IntervalVector(2,Interval(-10,10)));
+	sort(sols.begin(),sols.end(),lex_lt);
+	return sols;
+}
+
+}
+
+void TestParallelSolver::circle01() {
+	vector<IntervalVector> ref=seq_solve();
+	vector<IntervalVector> sols=par_solve(1);
+	TEST_ASSERT(sols.size()==ref.size());
+	for (unsigned int i=0; i<sols.size(); i++)
+		TEST_ASSERT(sols[i]==ref[i]);
+}
+
+void TestParallelSolver::circle02() {
+	vector<IntervalVector> ref=seq_solve();
+	vector<IntervalVector> sols=par_solve(4);
+	TEST_ASSERT(sols.size()==ref.size());
+	for (unsigned int i=0; i<sols.size(); i++)
+		TEST_ASSERT(sols[i]==ref[i]);
+	double r=::sqrt(2)/2;
+	TEST_ASSERT(sols.size()>=2);
+	TEST_ASSERT(sols.front()[0].contains(-r));
+	TEST_ASSERT(sols.back()[0].contains(r));
+}
+
+void TestParallelSolver::cell_limit() {
+	vector<IntervalVector> sols=par_solve(3,10);
+	TEST_ASSERT(sols.size()<2);
+}
+
+} // end namespace
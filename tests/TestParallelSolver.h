@@ -0,0 +1,39 @@
+/* ============================================================================
+ * I B E X - Parallel Solver Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 16, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_PARALLEL_SOLVER_H__
+#define __TEST_PARALLEL_SOLVER_H__
+
+#include "cpptest.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestParallelSolver : public TestIbex {
+
+public:
+	TestParallelSolver() {
+
+		TEST_ADD(TestParallelSolver::circle01);
+		TEST_ADD(TestParallelSolver::circle02);
+		TEST_ADD(TestParallelSolver::cell_limit);
+	}
+
+	// 2 solutions, 1 worker
+	void circle01();
+	// 2 solutions, 4 workers
+	void circle02();
+	// search interrupted
+	void cell_limit();
+};
+
+} // namespace ibex
+#endif // __TEST_PARALLEL_SOLVER_H__
@@ -0,0 +1,81 @@
+/* ============================================================================
+ * I B E X - Portfolio Optimizer Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 16, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestPortfolioOptimizer.h"
+#include "ibex_PortfolioOptimizer.h"
+#include "ibex_DefaultOptimizer.h"
+#include "ibex_RoundRobin.h"
+#include "ExSystem.h"
+
+using namespace std;
+
+namespace ibex {
+
+namespace {
+
+/*
+ * Two configurations: the default optimizer and
+ * an optimizer with HC4 and a round-robin bisector.
+ */
+class Portfolio {
+public:
+	Portfolio(System* (*build)(), double prec) :
+		sys1(build()), sys2(build()),
+		ext_sys2(*sys2,Optimizer::default_equ_eps), hc4(ext_sys2.ctrs,0.01), rr(prec),
+		o1(*sys1,prec,prec), o2(*sys2,hc4,rr,prec,prec,prec), opt(o1,o2), p(opt) { }
+
+	~Portfolio() {
+		delete sys1;
+		delete sys2;
+	}
+
+	System* sys1;
+	System* sys2;
+	ExtendedSystem ext_sys2;
+	CtcHC4 hc4;
+	RoundRobin rr;
+	DefaultOptimizer o1;
+	Optimizer o2;
+	Array<Optimizer> opt;
+	PortfolioOptimizer p;
+};
+
+}
+
+void TestPortfolioOptimizer::issue50_4() {
+	Portfolio portfolio(issue50_sys,0);
+	PortfolioOptimizer& p=portfolio.p;
+	TEST_ASSERT(p.optimize(IntervalVector(1,Interval::ALL_REALS),-1e-10)==Optimizer::INFEASIBLE);
+	TEST_ASSERT(p.winner==0 || p.winner==1);
+}
+
+void TestPortfolioOptimizer::quadratic01() {
+	Portfolio portfolio(quadratic_sys,1e-07);
+	PortfolioOptimizer& p=portfolio.p;
+	TEST_ASSERT(p.optimize(IntervalVector(2,Interval(-10,10)))==Optimizer::SUCCESS);
+	TEST_ASSERT(p.winner==0 || p.winner==1);
+	TEST_ASSERT(p.uplo<=2 && 2<=p.loup);
+	TEST_ASSERT(p.loup-p.uplo<=1e-05);
+	TEST_ASSERT_DELTA(p.loup_point[0],0,1e-03);
+	TEST_ASSERT_DELTA(p.loup_point[1],1,1e-03);
+}
+
+void TestPortfolioOptimizer::timeout01() {
+	// the precision is too small to complete the search
+	Portfolio portfolio(quadratic_sys,1e-300);
+	PortfolioOptimizer& p=portfolio.p;
+	p.timeout=0.5;
+	TEST_ASSERT(p.optimize(IntervalVector(2,Interval(-10,10)))==Optimizer::TIME_OUT);
+	TEST_ASSERT(p.winner==-1);
+	TEST_ASSERT(p.uplo<=2 && 2<=p.loup);
+}
+
+} // namespace ibex
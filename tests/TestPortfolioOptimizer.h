@@ -0,0 +1,39 @@
+/* ============================================================================
+ * I B E X - Portfolio Optimizer Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 16, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_PORTFOLIO_OPTIMIZER_H__
+#define __TEST_PORTFOLIO_OPTIMIZER_H__
+
+#include "cpptest.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestPortfolioOptimizer : public TestIbex {
+
+public:
+	TestPortfolioOptimizer() {
+
+		TEST_ADD(TestPortfolioOptimizer::issue50_4);
+		TEST_ADD(TestPortfolioOptimizer::quadratic01);
+		TEST_ADD(TestPortfolioOptimizer::timeout01);
+	}
+
+	// same as TestOptimizer::issue50_4 with 2 configurations --> INFEASIBLE
+	void issue50_4();
+	// constrained quadratic problem, default optimizer vs HC4+round-robin
+	void quadratic01();
+	// no configuration completes the search in the time limit
+	void timeout01();
+};
+
+} // namespace ibex
+#endif // __TEST_PORTFOLIO_OPTIMIZER_H__
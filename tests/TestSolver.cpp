@@ -0,0 +1,63 @@
+/* ============================================================================
+ * I B E X - Solver Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestSolver.h"
+#include "ibex_Solver.h"
+#include "ExSystem.h"
+#include "ibex_CtcHC4.h"
+#include "ibex_RoundRobin.h"
+#include "ibex_CellStack.h"
+
+#include <stdio.h>
+
+using namespace std;
+
+namespace ibex {
+
+void TestSolver::checkpoint01() {
+	IntervalVector init_box(2,Interval(-10,10));
+	string file=tmp_file();
+
+	System* sys=circle_sys();
+	CtcHC4 hc4(sys->ctrs);
+	RoundRobin bsc(1e-03);
+
+	// reference: a single search
+	CellStack buff;
+	Solver s(hc4,bsc,buff);
+	vector<IntervalVector> ref=s.solve(init_box);
+
+	// the same search, saved and resumed
+	CellStack buff1;
+	Solver s1(hc4,bsc,buff1);
+	s1.cell_limit=10;
+	vector<IntervalVector> sols=s1.solve(init_box);
+	TEST_ASSERT(!buff1.empty());
+	s1.save(file.c_str());
+	TEST_ASSERT(buff1.size()>0); // the buffer is left unchanged
+
+	CellStack buff2;
+	Solver s2(hc4,bsc,buff2);
+	s2.resume(file.c_str());
+	TEST_ASSERT(s2.nb_cells==s1.nb_cells);
+	TEST_ASSERT(buff2.size()==buff1.size());
+	while (s2.next(sols)) { }
+
+	TEST_ASSERT(sols.size()==ref.size());
+	for (unsigned int i=0; i<sols.size() && i<ref.size(); i++)
+		TEST_ASSERT(sols[i]==ref[i]);
+	TEST_ASSERT(s2.nb_cells==s.nb_cells);
+
+	delete sys;
+	remove(file.c_str());
+}
+
+} // namespace ibex
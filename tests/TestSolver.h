@@ -0,0 +1,33 @@
+/* ============================================================================
+ * I B E X - Solver Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 17, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_SOLVER_H__
+#define __TEST_SOLVER_H__
+
+#include "cpptest.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestSolver : public TestIbex {
+
+public:
+	TestSolver() {
+
+		TEST_ADD(TestSolver::checkpoint01);
+	}
+
+	// search saved at the cell limit and resumed by another solver
+	void checkpoint01();
+};
+
+} // namespace ibex
+#endif // __TEST_SOLVER_H__
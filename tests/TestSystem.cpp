@@ -362,4 +362,35 @@ void TestSystem::merge04() {
 		TEST_ASSERT(sameExpr(sys3.ctrs[sys1.nb_ctr+i].f.expr(),sys2.ctrs[i].f.expr()));
 }
 
+void TestSystem::cse01() {
+	SystemFactory fac;
+	Variable x("x");
+	Variable y("y");
+
+	fac.add_var(x);
+	fac.add_var(y);
+	fac.add_ctr(x*y+sin(x)<=1);
+	fac.add_ctr(sin(x)-y*x>=0);
+	fac.add_ctr(exp(x*y)=2);
+	System sys(fac);
+
+	// x*y (also written y*x) and sin(x) appear only once in f
+	TEST_ASSERT(sameExpr(sys.f.expr(),"((((x*y)+sin(x))-1);(sin(x)-(x*y));(exp((x*y))-2))"));
+	TEST_ASSERT(sys.f.nb_nodes()==12);
+
+	IntervalVector box(2);
+	box[0]=Interval(1,2);
+	box[1]=Interval(-1,3);
+
+	IntervalVector y1=sys.f.eval_vector(box);
+	for (int i=0; i<3; i++) {
+		TEST_ASSERT(y1[i]==sys.ctrs[i].f.eval(box));
+	}
+
+	IntervalMatrix J=sys.f.jacobian(box);
+	for (int i=0; i<3; i++) {
+		TEST_ASSERT(J[i]==sys.ctrs[i].f.gradient(box));
+	}
+}
+
 } // end namespace
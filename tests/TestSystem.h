@@ -36,6 +36,7 @@ public:
 		TEST_ADD(TestSystem::merge02);
 		TEST_ADD(TestSystem::merge03);
 		TEST_ADD(TestSystem::merge04);
+		TEST_ADD(TestSystem::cse01);
 	}
 
 	void factory01();
@@ -53,6 +54,7 @@ public:
 	void merge02();
 	void merge03();
 	void merge04();
+	void cse01();
 };
 
 } // end namespace
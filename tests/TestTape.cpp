@@ -0,0 +1,396 @@
+/* ============================================================================
+ * I B E X - Tape Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 16, 2026
+ * ---------------------------------------------------------------------------- */
+
+#include "TestTape.h"
+#include "ibex_Function.h"
+#include "ibex_Eval.h"
+#include "ibex_Gradient.h"
+#include "ibex_Tape.h"
+#include <algorithm>
+
+using namespace std;
+
+namespace ibex {
+
+void TestTape::supported01() {
+	Variable x,y;
+	Function f(x,y,x*y+sin(x));
+	TEST_ASSERT(f.cf.tape!=NULL);
+	TEST_ASSERT(f.cf.tape->nb_var==2);
+
+	Variable u(2),v(2);
+	Function g(u,v,u+v);
+	TEST_ASSERT(g.cf.tape==NULL);
+
+	Function h(x,y,f(x,y)+1);
+	TEST_ASSERT(h.cf.tape==NULL);
+}
+
+void TestTape::eval01() {
+	Variable x(3),y;
+	Function f(x,y,x[0]*y+sqr(x[1])-exp(x[2])/(2+y)+pow(x[0],3));
+	TEST_ASSERT(f.cf.tape!=NULL);
+
+	IntervalVector box(4);
+	box[0]=Interval(1,2);
+	box[1]=Interval(-1,3);
+	box[2]=Interval(0,1);
+	box[3]=Interval(2,4);
+
+	Interval y_tape=Eval().eval_root(f,box).i();
+	Interval y_labels=Eval().eval(f,box).i();
+	TEST_ASSERT(y_tape==y_labels);
+	TEST_ASSERT(f.eval(box)==y_labels);
+}
+
+void TestTape::eval02() {
+	Variable x,y;
+	Function g(x,y,ExprVector::new_(Array<const ExprNode>(x+y,x*y,sqrt(x)),false));
+	TEST_ASSERT(g.cf.tape!=NULL);
+
+	IntervalVector box(2);
+	box[0]=Interval(1,4);
+	box[1]=Interval(-1,1);
+
+	IntervalVector y_tape=Eval().eval_root(g,box).v();
+	IntervalVector y_labels=Eval().eval(g,box).v();
+	TEST_ASSERT(y_tape==y_labels);
+	check(g.eval_vector(box),y_labels);
+}
+
+void TestTape::proj01() {
+	Variable x,y;
+	Function f(x,y,x+sqr(y));
+
+	IntervalVector box(2);
+	box[0]=Interval(0,1);
+	box[1]=Interval(-4,4);
+
+	f.backward(Interval(4,4),box);
+	check(box[0],Interval(0,1));
+	check(box[1],Interval(-2,2));
+}
+
+void TestTape::proj02() {
+	Variable x,y;
+	Function f(x,y,x*y);
+
+	IntervalVector box(2);
+	box[0]=Interval(1,2);
+	box[1]=Interval(1,2);
+
+	try {
+		f.backward(Interval(-1,0),box);
+		TEST_ASSERT(false);
+	} catch(EmptyBoxException&) {
+		TEST_ASSERT(box.is_empty());
+	}
+}
+
+void TestTape::proj03() {
+	Variable x,y,z;
+	Function f(x,y,z,sqr(x)+exp(y)*z+sqrt(z));
+
+	IntervalVector box(3);
+	box[0]=Interval(-2,2);
+	box[1]=Interval(0,1);
+	box[2]=Interval(1,4);
+
+	for (int k=0; k<5; k++) {
+		IntervalVector b1(box);
+		IntervalVector b2(box);
+		// only one variable differs from the previous call
+		b1[k%3]=b2[k%3]=Interval(1,2);
+		if (k==3) b1[2]=b2[2]=Interval(-2,-1); // sqrt is not defined
+
+		Variable x2,y2,z2;
+		Function g(x2,y2,z2,sqr(x2)+exp(y2)*z2+sqrt(z2)); // no previous evaluation
+		try {
+			f.backward(Interval(0,10),b1);
+			TEST_ASSERT(k!=3);
+		} catch(EmptyBoxException&) {
+			TEST_ASSERT(k==3);
+			continue;
+		}
+		g.backward(Interval(0,10),b2);
+		check(b1,b2);
+	}
+}
+
+void TestTape::grad01() {
+	Variable x(2),y;
+	Function f(x,y,x[0]*y+sqr(x[1])*x[0]-cos(y));
+	TEST_ASSERT(f.cf.tape!=NULL);
+
+	IntervalVector box(3);
+	box[0]=Interval(1,2);
+	box[1]=Interval(-1,3);
+	box[2]=Interval(0,1);
+
+	IntervalVector g(3);
+	f.gradient(box,g);
+
+	// with labels
+	Array<Domain> d(2);
+	d.set_ref(0,*new Domain(Dim::col_vec(2)));
+	d.set_ref(1,*new Domain(Dim::scalar()));
+	d[0].v()=box.subvector(0,1);
+	d[1].i()=box[2];
+	IntervalVector g2(3);
+	Gradient().gradient(f,d,g2);
+
+	TEST_ASSERT(g==g2);
+	check(g[0],box[2]+sqr(box[1]));
+
+	delete &d[0];
+	delete &d[1];
+}
+
+void TestTape::grad02() {
+	Variable x,y;
+	Function fmin(x,y,min(x,y));
+	Function fmax(x,y,max(x,y));
+
+	IntervalVector box(2);
+	box[0]=Interval(0,1);
+	box[1]=Interval(2,3);
+
+	IntervalVector g(2);
+	fmin.gradient(box,g);
+	check(g[0],Interval::ONE);
+	check(g[1],Interval::ZERO);
+
+	fmax.gradient(box,g);
+	check(g[0],Interval::ZERO);
+	check(g[1],Interval::ONE);
+}
+
+void TestTape::batch01() {
+	Variable x,y;
+	Function f(x,y,x*y+sqr(x-y)-x/y+exp(-x)-(-y));
+	TEST_ASSERT(f.cf.tape!=NULL);
+
+	int n=2*Eval::BATCH_SIZE+5;
+	Array<const IntervalVector> boxes(n);
+	for (int i=0; i<n; i++) {
+		IntervalVector* box=new IntervalVector(2);
+		(*box)[0]=Interval(-1+0.1*i,0.3*i);
+		(*box)[1]=Interval(-2+0.05*i,1+0.02*i); // contains 0 for the first boxes
+		boxes.set_ref(i,*box);
+	}
+	((IntervalVector&) boxes[3])[0]=Interval(1,POS_INFINITY);
+	((IntervalVector&) boxes[4])[1]=Interval::ALL_REALS;
+	((IntervalVector&) boxes[n-1]).set_empty();
+
+	IntervalMatrix res(n,1);
+	f.eval_batch(boxes,res);
+
+	for (int i=0; i<n; i++) {
+		Interval z=f.eval(boxes[i]);
+		TEST_ASSERT(res[i][0].is_superset(z));
+		// relative tolerance: x/y is huge when y is a tiny positive number
+		// (the lower bound of y is 0 or a few ulps away, depending on the rounding)
+		TEST_ASSERT(almost_eq(res[i][0],z,ERROR*(z.is_empty()? 1 : std::max(1.0,z.mag()))));
+	}
+	TEST_ASSERT(res[n-1].is_empty());
+
+	for (int i=0; i<n; i++) delete &boxes[i];
+}
+
+void TestTape::batch02() {
+	Variable x,y;
+	Function g(x,y,ExprVector::new_(Array<const ExprNode>(x-y,sqrt(x),x*y),false));
+	TEST_ASSERT(g.cf.tape!=NULL);
+
+	Variable u(2),v(2);
+	Function h(u,v,u+v);
+	TEST_ASSERT(h.cf.tape==NULL);
+
+	IntervalVector b1(2),b2(2),b3(2);
+	b1[0]=Interval(1,4);   b1[1]=Interval(-1,1);
+	b2[0]=Interval(-2,-1); b2[1]=Interval(0,1);  // sqrt(x) is empty
+	b3[0]=Interval(0,9);   b3[1]=Interval(2,3);
+
+	IntervalMatrix res(3,3);
+	g.eval_batch(Array<const IntervalVector>(b1,b2,b3),res);
+	TEST_ASSERT(almost_eq(res[0],g.eval_vector(b1),ERROR));
+	TEST_ASSERT(res[1].is_empty());
+	TEST_ASSERT(almost_eq(res[2],g.eval_vector(b3),ERROR));
+
+	IntervalVector c1(4),c2(4);
+	c1[0]=Interval(0,1); c1[1]=Interval(1,2); c1[2]=Interval(2,3); c1[3]=Interval(3,4);
+	c2[0]=Interval(-1,1); c2[1]=Interval(0,0); c2[2]=Interval(5,6); c2[3]=Interval(1,2);
+
+	IntervalMatrix z(2,2);
+	h.eval_batch(Array<const IntervalVector>(c1,c2),z);
+	TEST_ASSERT(z[0]==h.eval_vector(c1));
+	TEST_ASSERT(z[1]==h.eval_vector(c2));
+}
+
+void TestTape::point01() {
+	Variable x,y,z;
+	Function f(x,y,z,x*y-sqr(z)/y+exp(-x)*sin(z)+max(x,z)+atan2(y,x)+pow(z,3)+sqrt(y));
+	TEST_ASSERT(f.cf.tape!=NULL);
+
+	double _x[3]={1.5,2.0,-0.5};
+	Vector pt(3,_x);
+
+	double y_point=f.eval_point(pt);
+	Interval y_itv=f.eval(pt);
+	TEST_ASSERT_DELTA(y_point,y_itv.mid(),ERROR);
+
+	Vector g(3);
+	f.gradient_point(pt,g);
+	IntervalVector g_itv=f.gradient(pt);
+	for (int i=0; i<3; i++)
+		TEST_ASSERT_DELTA(g[i],g_itv[i].mid(),ERROR);
+}
+
+void TestTape::point02() {
+	Variable x,y;
+	Function f(x,y,log(x)+y);
+
+	double _x[2]={-1.0,2.0};
+	Vector pt(2,_x);
+	double y_point=f.eval_point(pt);
+	TEST_ASSERT(y_point!=y_point); // NaN
+
+	Variable u(2);
+	Function g(u,u*u); // no tape (dot product)
+	TEST_ASSERT(g.cf.tape==NULL);
+
+	double _u[2]={1.0,3.0};
+	Vector pu(2,_u);
+	TEST_ASSERT(g.eval_point(pu)==10);
+	Vector grad(2);
+	g.gradient_point(pu,grad);
+	TEST_ASSERT(grad[0]==2 && grad[1]==6);
+
+	// the interval evaluation is unbounded
+	double _v[2]={1e308,1e308};
+	Vector pv(2,_v);
+	y_point=g.eval_point(pv);
+	TEST_ASSERT(y_point!=y_point); // NaN
+	g.gradient_point(pv,grad);
+	TEST_ASSERT(grad[0]!=grad[0] && grad[1]!=grad[1]);
+}
+
+void TestTape::jac01() {
+	Variable x,y,z;
+	const ExprNode& e=sqr(x-y)*exp(z);
+	Function f(x,y,z,ExprVector::new_(Array<const ExprNode>(e+x,e*y,sin(z)),false));
+	TEST_ASSERT(f.cf.tape!=NULL);
+
+	IntervalVector box(3);
+	box[0]=Interval(1,2);
+	box[1]=Interval(-1,0);
+	box[2]=Interval(0,0.5);
+
+	IntervalMatrix J(3,3);
+	f.jacobian(box,J);
+
+	for (int i=0; i<3; i++) {
+		IntervalVector g(3);
+		f[i].gradient(box,g);
+		check(J[i],g);
+	}
+	check(J[2][0],Interval::ZERO);
+	check(J[2][2],cos(box[2]));
+}
+
+void TestTape::jac02() {
+	Variable x,y;
+	Function f(x,y,ExprVector::new_(Array<const ExprNode>(sqrt(x),x*y),false));
+
+	IntervalVector box(2);
+	box[0]=Interval(-2,-1);
+	box[1]=Interval(1,2);
+
+	IntervalMatrix J(2,2);
+	f.jacobian(box,J);
+	TEST_ASSERT(J[0].is_empty());
+	check(J[1][0],box[1]);
+	check(J[1][1],box[0]);
+}
+
+void TestTape::jac_sparse() {
+	Variable x(5);
+	Array<const ExprNode> c(4);
+	for (int i=0; i<4; i++)
+		c.set_ref(i, sqr(x[i])*x[i+1]-exp(x[i+1]));
+	Function f(x,ExprVector::new_(c,false));
+
+	SparseIntervalMatrix J=f.jacobian_structure();
+	TEST_ASSERT(J.nb_nonzeros()==8);
+	for (int i=0; i<4; i++) {
+		TEST_ASSERT(J.index(i,i)!=-1);
+		TEST_ASSERT(J.index(i,i+1)!=-1);
+	}
+	TEST_ASSERT(J.index(0,2)==-1);
+
+	IntervalVector box(5,Interval(1,2));
+	f.jacobian(box,J);
+	IntervalMatrix dense=f.jacobian(box);
+	for (int i=0; i<4; i++)
+		check(J.dense()[i],dense[i]);
+
+	// a component is not defined on the box
+	box[1]=Interval(-2,-1);
+	Function g(x,ExprVector::new_(Array<const ExprNode>(sqrt(x[1])+x[0],x[2]*x[3]),false));
+	SparseIntervalMatrix Jg=g.jacobian_structure();
+	g.jacobian(box,Jg);
+	TEST_ASSERT(Jg.is_empty());
+}
+
+void TestTape::hess01() {
+	Variable x,y;
+	Function f(x,y,sqr(x)*y+sin(x)*exp(y)+x/y);
+	TEST_ASSERT(f.cf.tape!=NULL);
+
+	double a=0.5, b=2.0;
+	IntervalVector pt(2);
+	pt[0]=a;
+	pt[1]=b;
+
+	IntervalMatrix H=f.hessian(pt);
+	check(H[0][0],Interval(2*b-::sin(a)*::exp(b)));
+	check(H[0][1],Interval(2*a+::cos(a)*::exp(b)-1/(b*b)));
+	check(H[1][0],H[0][1]);
+	check(H[1][1],Interval(::sin(a)*::exp(b)+2*a/(b*b*b)));
+
+	// the Hessian on a box contains the Hessian at its midpoint
+	IntervalVector box(2);
+	box[0]=Interval(0,1);
+	box[1]=Interval(1,2);
+	f.hessian(box,H);
+	IntervalMatrix Hmid=f.hessian(box.mid());
+	TEST_ASSERT(Hmid.is_subset(H));
+}
+
+void TestTape::hess02() {
+	Variable x,y;
+	Function f(x,y,abs(x)*y+sqr(y));
+
+	IntervalVector box(2);
+	box[0]=Interval(-1,1);
+	box[1]=Interval(1,2);
+
+	IntervalMatrix H=f.hessian(box);
+	TEST_ASSERT(H[0][0]==Interval::ALL_REALS);
+	check(H[1][1],Interval(2));
+
+	box[0]=Interval(1,2);
+	f.hessian(box,H);
+	check(H[0][0],Interval::ZERO);
+	check(H[0][1],Interval::ONE);
+}
+
+} // namespace ibex
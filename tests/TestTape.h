@@ -0,0 +1,81 @@
+/* ============================================================================
+ * I B E X - Tape Tests
+ * ============================================================================
+ * Copyright   : Ecole des Mines de Nantes (FRANCE)
+ * License     : This program can be distributed under the terms of the GNU LGPL.
+ *               See the file COPYING.LESSER.
+ *
+ * Author(s)   : agent
+ * Created     : Oct 16, 2026
+ * ---------------------------------------------------------------------------- */
+
+#ifndef __TEST_TAPE_H__
+#define __TEST_TAPE_H__
+
+#include "cpptest.h"
+#include "utils.h"
+
+namespace ibex {
+
+class TestTape : public TestIbex {
+
+public:
+	TestTape() {
+
+		TEST_ADD(TestTape::supported01);
+		TEST_ADD(TestTape::eval01);
+		TEST_ADD(TestTape::eval02);
+		TEST_ADD(TestTape::proj01);
+		TEST_ADD(TestTape::proj02);
+		TEST_ADD(TestTape::proj03);
+		TEST_ADD(TestTape::grad01);
+		TEST_ADD(TestTape::grad02);
+		TEST_ADD(TestTape::batch01);
+		TEST_ADD(TestTape::batch02);
+		TEST_ADD(TestTape::point01);
+		TEST_ADD(TestTape::point02);
+		TEST_ADD(TestTape::jac01);
+		TEST_ADD(TestTape::jac02);
+		TEST_ADD(TestTape::jac_sparse);
+		TEST_ADD(TestTape::hess01);
+		TEST_ADD(TestTape::hess02);
+	}
+
+	// only functions with scalar operators are taped
+	void supported01();
+	// scalar function with indexed symbols and constants (same result as with labels)
+	void eval01();
+	// vector-valued function (same result as with labels)
+	void eval02();
+	// HC4Revise contraction
+	void proj01();
+	// HC4Revise with empty result
+	void proj02();
+	// successive HC4Revise contractions with incremental forward evaluation
+	void proj03();
+	// gradient (same result as with labels)
+	void grad01();
+	// gradient of min/max
+	void grad02();
+	// batch evaluation with infinite bounds, empty boxes and division by zero
+	void batch01();
+	// batch evaluation of a vector-valued function (with and without tape)
+	void batch02();
+	// point evaluation and gradient (close to the interval ones)
+	void point01();
+	// point evaluation outside of the domain and without tape
+	void point02();
+	// Jacobian with shared subexpressions (same result as component by component)
+	void jac01();
+	// Jacobian with an empty component
+	void jac02();
+	// sparse Jacobian (same entries as the dense one)
+	void jac_sparse();
+	// Hessian at a point and on a box
+	void hess01();
+	// Hessian of a non-smooth function
+	void hess02();
+};
+
+} // namespace ibex
+#endif // __TEST_TAPE_H__
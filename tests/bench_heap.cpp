@@ -0,0 +1,95 @@
+//============================================================================
+//                                  I B E X
+// File        : Heap contraction benchmark
+// Author      : agent
+// Copyright   : Ecole des Mines de Nantes (France)
+// License     : See the LICENSE file
+// Created     : Oct 16, 2026
+//============================================================================
+
+// Compares the contraction of an ibex::Heap (min-max heap, only the
+// removed elements are visited) with the former implementation (the
+// whole heap was sorted and rebuilt at each contraction).
+//
+// Usage: bench_heap [size] [nb_contractions]
+
+#include "ibex.h"
+#include <stdlib.h>
+
+using namespace std;
+using namespace ibex;
+
+namespace {
+
+class DoubleHeap : public Heap<double> {
+public:
+	~DoubleHeap() { flush(); }
+
+	double cost(const double& x) const { return x; }
+};
+
+struct Comparator {
+	bool operator()(const pair<double*,double>& c1, const pair<double*,double>& c2) {
+		return c1.second >= c2.second;
+	}
+};
+
+// the former Heap::contract
+void sort_contract(vector<pair<double*,double> >& l, double loup) {
+	sort_heap(l.begin(),l.end(),Comparator());
+	vector<pair<double*,double> >::iterator it0=l.begin();
+
+	int k=0;
+	while (it0!=l.end() && it0->second > loup) { it0++; k++; }
+
+	for (int i=0;i<k;i++) {
+		delete l[i].first;
+	}
+
+	if (k>0) l.erase(l.begin(),it0);
+
+	make_heap(l.begin(), l.end() ,Comparator());
+}
+
+}
+
+int main(int argc, char** argv) {
+	int size = argc>1 ? atoi(argv[1]) : 1000000;
+	int nb   = argc>2 ? atoi(argv[2]) : 100;
+
+	// the threshold decreases slowly, as the loup in an optimization:
+	// each contraction removes a few elements
+	vector<double> costs(size);
+	srand(1);
+	for (int i=0; i<size; i++) costs[i]=((double) rand())/RAND_MAX;
+
+	vector<pair<double*,double> > l;
+	for (int i=0; i<size; i++) {
+		l.push_back(pair<double*,double>(new double(costs[i]),costs[i]));
+		push_heap(l.begin(), l.end(), Comparator());
+	}
+
+	Timer::start();
+	for (int i=0; i<nb; i++)
+		sort_contract(l, 1.0-((double) i+1)/(2*nb));
+	Timer::stop();
+	double t_sort=Timer::VIRTUAL_TIMELAPSE();
+	int size_sort=l.size();
+	for (unsigned int i=0; i<l.size(); i++) delete l[i].first;
+
+	DoubleHeap heap;
+	for (int i=0; i<size; i++)
+		heap.push(new double(costs[i]));
+
+	Timer::start();
+	for (int i=0; i<nb; i++)
+		heap.contract(1.0-((double) i+1)/(2*nb));
+	Timer::stop();
+	double t_heap=Timer::VIRTUAL_TIMELAPSE();
+
+	cout << "heap size=" << size << " contractions=" << nb << endl;
+	cout << "\tsort and rebuild: " << t_sort << "s (remaining: " << size_sort << ")" << endl;
+	cout << "\tmin-max heap:     " << t_heap << "s (remaining: " << heap.size() << ")" << endl;
+
+	return size_sort==heap.size() ? 0 : 1;
+}
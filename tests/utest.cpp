@@ -16,6 +16,7 @@
 // ================ tools ===============
 #include "TestString.h"
 #include "TestBitSet.h"
+#include "TestHeap.h"
 #include "TestSymbolMap.h"
 #include "TestPixelMap.h"
 
@@ -38,6 +39,8 @@
 #include "TestNumConstraint.h"
 #include "TestEval.h"
 #include "TestGradient.h"
+#include "TestTape.h"
+#include "TestNativeFunction.h"
 #include "TestHC4Revise.h"
 #include "TestInHC4Revise.h"
 
@@ -70,6 +73,14 @@
 
 // ================ strategy ===============
 #include "TestOptimizer.h"
+#include "TestSolver.h"
+#include "TestParallelSolver.h"
+#include "TestParallelOptimizer.h"
+#include "TestPortfolioOptimizer.h"
+#include "TestEvalContext.h"
+#include "TestCellArena.h"
+#include "TestCellDiskHeap.h"
+#include "TestCellDoubleHeap.h"
 
 // ================ set ===============
 #include "TestSeparator.h"
@@ -89,6 +100,7 @@ int main() {
 
     ts.add(auto_ptr<Test::Suite>(new TestString()));
     ts.add(auto_ptr<Test::Suite>(new TestBitSet()));
+    ts.add(auto_ptr<Test::Suite>(new TestHeap()));
     ts.add(auto_ptr<Test::Suite>(new TestSymbolMap()));
     ts.add(auto_ptr<Test::Suite>(new TestPixelMap()));
 
@@ -116,6 +128,8 @@ int main() {
     ts.add(auto_ptr<Test::Suite>(new TestHC4Revise()));
     ts.add(auto_ptr<Test::Suite>(new TestInHC4Revise()));
     ts.add(auto_ptr<Test::Suite>(new TestGradient()));
+    ts.add(auto_ptr<Test::Suite>(new TestTape()));
+    ts.add(auto_ptr<Test::Suite>(new TestNativeFunction()));
 
     ts.add(auto_ptr<Test::Suite>(new TestLinear()));
     ts.add(auto_ptr<Test::Suite>(new TestNewton()));
@@ -135,6 +149,14 @@ int main() {
     ts.add(auto_ptr<Test::Suite>(new TestFritzJohn()));
 
     ts.add(auto_ptr<Test::Suite>(new TestOptimizer()));
+    ts.add(auto_ptr<Test::Suite>(new TestSolver()));
+    ts.add(auto_ptr<Test::Suite>(new TestParallelSolver()));
+    ts.add(auto_ptr<Test::Suite>(new TestParallelOptimizer()));
+    ts.add(auto_ptr<Test::Suite>(new TestPortfolioOptimizer()));
+    ts.add(auto_ptr<Test::Suite>(new TestEvalContext()));
+    ts.add(auto_ptr<Test::Suite>(new TestCellArena()));
+    ts.add(auto_ptr<Test::Suite>(new TestCellDiskHeap()));
+    ts.add(auto_ptr<Test::Suite>(new TestCellDoubleHeap()));
     ts.add(auto_ptr<Test::Suite>(new TestSeparator()));
     ts.add(auto_ptr<Test::Suite>(new TestSepPolygon()));
 
@@ -12,6 +12,8 @@
 #include "utils.h"
 #include <math.h>
 #include <sstream>
+#include <stdlib.h>
+#include <unistd.h>
 
 const double TestIbex::ERROR = 1e-10;
 
@@ -101,4 +103,9 @@ bool TestIbex::almost_eq(const IntervalVector& y_actual, const IntervalVector& y
 	return true;
 }
 
-
+std::string TestIbex::tmp_file() {
+	char name[]="/tmp/ibex_testXXXXXX";
+	int fd=mkstemp(name);
+	if (fd!=-1) close(fd);
+	return name;
+}
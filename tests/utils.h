@@ -16,6 +16,7 @@
 #include "ibex_Interval.h"
 #include "ibex_IntervalVector.h"
 #include "ibex_Expr.h"
+#include <string>
 
 using namespace ibex;
 
@@ -29,6 +30,9 @@ public:
 	bool almost_eq(const Interval& y_actual, const Interval& y_expected, double err);
 	bool almost_eq(const IntervalVector& y_actual, const IntervalVector& y_expected, double err);
 
+	// name of a new (empty) temporary file, to be removed by the test
+	static std::string tmp_file();
+
 	static const double ERROR;
 };
 